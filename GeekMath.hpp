@@ -24,6 +24,8 @@ Created on: Feb 19, 2015
 #ifndef GEEKMATH_H_
 #define GEEKMATH_H_
 
+#include "Math/UInt64.hpp"
+
 #include "Math/Vec2d.hpp"
 #include "Math/Vec3d.hpp"
 #include "Math/Vec4d.hpp"
@@ -35,16 +37,72 @@ Created on: Feb 19, 2015
 #include "Math/Quaternion.hpp"
 
 #include "Math/Vec2i.hpp"
+#include "Math/Vec3i.hpp"
+#include "Math/Vec2h.hpp"
+#include "Math/Vec3h.hpp"
+#include "Math/Vec4h.hpp"
+#include "Math/Quaternionh.hpp"
 
 #include "Math/Mat3d.hpp"
 #include "Math/Mat4d.hpp"
 
 #include "Math/Mat3f.hpp"
 #include "Math/Mat4f.hpp"
+#include "Math/Vec3fRef.hpp"
+#include "Math/Vec3fConstRef.hpp"
+#include "Math/Mat4fView.hpp"
+#include "Math/Mat4fConstView.hpp"
+#include "Math/Mat4fSpan.hpp"
+#include "Math/Mat4fConstSpan.hpp"
 
 #include "Math/Mat3i.hpp"
 #include "Math/Mat4i.hpp"
 
+#include "Math/Affine3f.hpp"
+#include "Math/Affine3d.hpp"
+
+#include "Math/TrackFloat.hpp"
+#include "Math/TrackVec3f.hpp"
+#include "Math/TrackQuaternion.hpp"
+#include "Math/TrackSampler.hpp"
+#include "Math/CompressedClip.hpp"
+
+#include "Math/Aabb2f.hpp"
+#include "Math/Aabb3f.hpp"
+#include "Math/Aabb3d.hpp"
+#include "Math/Frustum.hpp"
+#include "Math/Bvh.hpp"
+#include "Math/Bvh4.hpp"
+#include "Math/BvhRebuild.hpp"
+#include "Math/Triangles.hpp"
+#include "Math/Trianglesd.hpp"
+#include "Math/Ray3f.hpp"
+#include "Math/Ray3d.hpp"
+#include "Math/Unproject.hpp"
+#include "Math/Unprojectd.hpp"
+#include "Math/SweepAndPrune.hpp"
+#include "Math/HashGrid2f.hpp"
+#include "Math/HashGrid3f.hpp"
+#include "Math/KdTree3f.hpp"
+#include "Math/KdTree3d.hpp"
+#include "Math/SpatialSort.hpp"
+#include "Math/ConvexShape.hpp"
+#include "Math/ConvexSphere.hpp"
+#include "Math/ConvexBox.hpp"
+#include "Math/ConvexCapsule.hpp"
+#include "Math/ConvexHull.hpp"
+#include "Math/Gjk.hpp"
+#include "Math/EyeRelative.hpp"
+#include "Math/Precision.hpp"
+#include "Math/Packing.hpp"
+#include "Math/Interleaved.hpp"
+#include "Math/Upload.hpp"
+#include "Math/Archive.hpp"
+#include "Math/ArchiveWriter.hpp"
+#include "Math/ArchiveReader.hpp"
+#include "Math/Text.hpp"
+#include "Math/Profile.hpp"
+
 #include "GeekMathConstants.hpp"
 
 #endif /* GEEKMATH_H_ */
@@ -0,0 +1,411 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb2f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Aabb2f.hpp"
+
+#include "Vec2f.hpp"
+#include "Mat3f.hpp"
+
+#include <cfloat>
+#include <cstdio>
+
+#define PARALLEL_CHUNKS 64
+#define PARALLEL_MINIMUM 4096
+
+/*
+ * Bounds of count positions, each two floats, stride bytes apart. The
+ * input is split into chunks whose partial bounds are reduced afterwards,
+ * the chunks run on all threads when built with OpenMP.
+ */
+static void
+StridedBounds( const char* base, const unsigned int stride, const unsigned int count,
+               float* minimum, float* maximum )
+{
+  float              partial[ PARALLEL_CHUNKS ][ 4 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    float minX =  FLT_MAX, minY =  FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      const float* p = reinterpret_cast< const float* >( base + (unsigned long)i * stride );
+
+      minX = p[ 0 ] < minX ? p[ 0 ] : minX; maxX = p[ 0 ] > maxX ? p[ 0 ] : maxX;
+      minY = p[ 1 ] < minY ? p[ 1 ] : minY; maxY = p[ 1 ] > maxY ? p[ 1 ] : maxY;
+    }
+
+    partial[ c ][ 0 ] = minX; partial[ c ][ 1 ] = minY;
+    partial[ c ][ 2 ] = maxX; partial[ c ][ 3 ] = maxY;
+  }
+
+  minimum[ 0 ] = minimum[ 1 ] =  FLT_MAX;
+  maximum[ 0 ] = maximum[ 1 ] = -FLT_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+    for ( unsigned int i = 0; i < 2; i++ )
+    {
+      if ( partial[ c ][ i ]     < minimum[ i ] ) minimum[ i ] = partial[ c ][ i ];
+      if ( partial[ c ][ 2 + i ] > maximum[ i ] ) maximum[ i ] = partial[ c ][ 2 + i ];
+    }
+}
+
+static void
+ArrayBounds( const float* values, const unsigned int count, float& minimum, float& maximum )
+{
+  float              partial[ PARALLEL_CHUNKS ][ 2 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    float localMin =  FLT_MAX;
+    float localMax = -FLT_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      localMin = values[ i ] < localMin ? values[ i ] : localMin;
+      localMax = values[ i ] > localMax ? values[ i ] : localMax;
+    }
+
+    partial[ c ][ 0 ] = localMin;
+    partial[ c ][ 1 ] = localMax;
+  }
+
+  minimum =  FLT_MAX;
+  maximum = -FLT_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+  {
+    if ( partial[ c ][ 0 ] < minimum ) minimum = partial[ c ][ 0 ];
+    if ( partial[ c ][ 1 ] > maximum ) maximum = partial[ c ][ 1 ];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Aabb2f::Aabb2f( void )
+{
+  Clear();
+}
+
+Aabb2f::Aabb2f( const Aabb2f& other )
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    m_Values[ 0 ][ i ] = other.m_Values[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = other.m_Values[ 1 ][ i ];
+  }
+}
+
+Aabb2f::Aabb2f( const Vec2f& min, const Vec2f& max )
+{
+  Set( min, max );
+}
+
+Aabb2f::~Aabb2f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Aabb2f::Set( const Vec2f& min, const Vec2f& max )
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    m_Values[ 0 ][ i ] = min[ i ];
+    m_Values[ 1 ][ i ] = max[ i ];
+  }
+}
+
+void
+Aabb2f::Clear( void )
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    m_Values[ 0 ][ i ] =  FLT_MAX;
+    m_Values[ 1 ][ i ] = -FLT_MAX;
+  }
+}
+
+bool
+Aabb2f::Empty( void ) const
+{
+  return m_Values[ 0 ][ 0 ] > m_Values[ 1 ][ 0 ] ||
+         m_Values[ 0 ][ 1 ] > m_Values[ 1 ][ 1 ];
+}
+
+Vec2f
+Aabb2f::Min( void ) const
+{
+  return Vec2f( m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ] );
+}
+
+Vec2f
+Aabb2f::Max( void ) const
+{
+  return Vec2f( m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ] );
+}
+
+Vec2f
+Aabb2f::Center( void ) const
+{
+  return Vec2f( ( m_Values[ 0 ][ 0 ] + m_Values[ 1 ][ 0 ] ) * 0.5f,
+                ( m_Values[ 0 ][ 1 ] + m_Values[ 1 ][ 1 ] ) * 0.5f );
+}
+
+Vec2f
+Aabb2f::Size( void ) const
+{
+  if ( Empty() ) return Vec2f();
+
+  return Vec2f( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ],
+                m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ] );
+}
+
+float
+Aabb2f::Perimeter( void ) const
+{
+  if ( Empty() ) return 0.0f;
+
+  return 2.0f * ( ( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ] ) +
+                  ( m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ] ) );
+}
+
+float
+Aabb2f::Area( void ) const
+{
+  if ( Empty() ) return 0.0f;
+
+  return ( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ] ) *
+         ( m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ] );
+}
+
+Aabb2f&
+Aabb2f::Extend( const Vec2f& point )
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    if ( point[ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = point[ i ];
+    if ( point[ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = point[ i ];
+  }
+
+  return *this;
+}
+
+Aabb2f&
+Aabb2f::Extend( const Aabb2f& box )
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    if ( box.m_Values[ 0 ][ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = box.m_Values[ 0 ][ i ];
+    if ( box.m_Values[ 1 ][ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = box.m_Values[ 1 ][ i ];
+  }
+
+  return *this;
+}
+
+Aabb2f
+Aabb2f::Union( const Vec2f& point ) const
+{
+  return Aabb2f( *this ).Extend( point );
+}
+
+Aabb2f
+Aabb2f::Union( const Aabb2f& box ) const
+{
+  return Aabb2f( *this ).Extend( box );
+}
+
+Aabb2f
+Aabb2f::Intersection( const Aabb2f& box ) const
+{
+  Aabb2f result;
+
+  for ( unsigned int i = 0; i < 2; i++ )
+  {
+    result.m_Values[ 0 ][ i ] = m_Values[ 0 ][ i ] > box.m_Values[ 0 ][ i ] ? m_Values[ 0 ][ i ] : box.m_Values[ 0 ][ i ];
+    result.m_Values[ 1 ][ i ] = m_Values[ 1 ][ i ] < box.m_Values[ 1 ][ i ] ? m_Values[ 1 ][ i ] : box.m_Values[ 1 ][ i ];
+  }
+
+  if ( result.Empty() ) result.Clear();
+
+  return result;
+}
+
+bool
+Aabb2f::Intersects( const Aabb2f& box ) const
+{
+  return m_Values[ 0 ][ 0 ] <= box.m_Values[ 1 ][ 0 ] && m_Values[ 1 ][ 0 ] >= box.m_Values[ 0 ][ 0 ] &&
+         m_Values[ 0 ][ 1 ] <= box.m_Values[ 1 ][ 1 ] && m_Values[ 1 ][ 1 ] >= box.m_Values[ 0 ][ 1 ];
+}
+
+bool
+Aabb2f::Contains( const Vec2f& point ) const
+{
+  return point[ 0 ] >= m_Values[ 0 ][ 0 ] && point[ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         point[ 1 ] >= m_Values[ 0 ][ 1 ] && point[ 1 ] <= m_Values[ 1 ][ 1 ];
+}
+
+bool
+Aabb2f::Contains( const Aabb2f& box ) const
+{
+  return box.m_Values[ 0 ][ 0 ] >= m_Values[ 0 ][ 0 ] && box.m_Values[ 1 ][ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         box.m_Values[ 0 ][ 1 ] >= m_Values[ 0 ][ 1 ] && box.m_Values[ 1 ][ 1 ] <= m_Values[ 1 ][ 1 ];
+}
+
+/*
+ * Arvo's method on the 2D affine part of a Mat3f, see Aabb3f::Transform.
+ */
+Aabb2f
+Aabb2f::Transform( const Mat3f& matrix ) const
+{
+  if ( Empty() ) return *this;
+
+  Aabb2f result;
+
+  for ( unsigned int row = 0; row < 2; row++ )
+  {
+    float minimum = matrix[ row ][ 2 ];
+    float maximum = matrix[ row ][ 2 ];
+
+    for ( unsigned int col = 0; col < 2; col++ )
+    {
+      const float a = matrix[ row ][ col ] * m_Values[ 0 ][ col ];
+      const float b = matrix[ row ][ col ] * m_Values[ 1 ][ col ];
+
+      minimum += a < b ? a : b;
+      maximum += a < b ? b : a;
+    }
+
+    result.m_Values[ 0 ][ row ] = minimum;
+    result.m_Values[ 1 ][ row ] = maximum;
+  }
+
+  return result;
+}
+
+Aabb2f
+Aabb2f::Bounds( const Vec2f* points, const unsigned int count )
+{
+  Aabb2f result;
+
+  if ( count == 0 ) return result;
+
+  /* Vec2f carries a vtable pointer, so its values sit at a fixed offset */
+  StridedBounds( reinterpret_cast< const char* >( points[ 0 ].Values() ), sizeof( Vec2f ), count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+Aabb2f
+Aabb2f::Bounds( const float* x, const float* y, const unsigned int count )
+{
+  Aabb2f result;
+
+  ArrayBounds( x, count, result.m_Values[ 0 ][ 0 ], result.m_Values[ 1 ][ 0 ] );
+  ArrayBounds( y, count, result.m_Values[ 0 ][ 1 ], result.m_Values[ 1 ][ 1 ] );
+
+  return result;
+}
+
+Aabb2f
+Aabb2f::Bounds( const float* positions, const unsigned int count, const unsigned int stride )
+{
+  Aabb2f result;
+
+  StridedBounds( reinterpret_cast< const char* >( positions ), stride, count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+bool
+Aabb2f::operator ==( const Aabb2f& expr ) const
+{
+  for ( unsigned int i = 0; i < 2; i++ )
+    if ( m_Values[ 0 ][ i ] != expr.m_Values[ 0 ][ i ] ||
+         m_Values[ 1 ][ i ] != expr.m_Values[ 1 ][ i ] )
+      return false;
+
+  return true;
+}
+
+bool
+Aabb2f::operator !=( const Aabb2f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float*
+Aabb2f::operator []( const unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+const float*
+Aabb2f::operator []( const unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Aabb2f::Print( void ) const
+{
+  printf( "[ ( %f | %f ) - ( %f | %f ) ]\n",
+          m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ],
+          m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,112 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb2f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_AABB2F_HPP_
+#define MATH_AABB2F_HPP_
+
+class Vec2f;
+class Mat3f;
+
+/*
+ * GeekEngine::Aabb2f
+ *
+ * Axis aligned bounding rectangle. A default constructed box is empty
+ * ( min = +FLT_MAX, max = -FLT_MAX ) so it can be grown point by point.
+ */
+class Aabb2f
+{
+public:
+  Aabb2f( void );
+  Aabb2f( const Aabb2f& );
+  Aabb2f( const Vec2f& min, const Vec2f& max );
+  virtual
+  ~Aabb2f( void );
+
+  void
+  Set( const Vec2f& min, const Vec2f& max );
+  void
+  Clear( void );
+
+  bool
+  Empty( void ) const;
+  Vec2f
+  Min( void ) const;
+  Vec2f
+  Max( void ) const;
+  Vec2f
+  Center( void ) const;
+  Vec2f
+  Size( void ) const;
+  float
+  Perimeter( void ) const;
+  float
+  Area( void ) const;
+
+  Aabb2f&
+  Extend( const Vec2f& point );
+  Aabb2f&
+  Extend( const Aabb2f& box );
+
+  Aabb2f
+  Union( const Vec2f& point ) const;
+  Aabb2f
+  Union( const Aabb2f& box ) const;
+  Aabb2f
+  Intersection( const Aabb2f& box ) const;
+  bool
+  Intersects( const Aabb2f& box ) const;
+  bool
+  Contains( const Vec2f& point ) const;
+  bool
+  Contains( const Aabb2f& box ) const;
+
+  Aabb2f
+  Transform( const Mat3f& matrix ) const;
+
+  static Aabb2f
+  Bounds( const Vec2f* points, const unsigned int count );
+  static Aabb2f
+  Bounds( const float* x, const float* y, const unsigned int count );
+  static Aabb2f
+  Bounds( const float* positions, const unsigned int count, const unsigned int stride );
+
+  bool
+  operator ==( const Aabb2f& expr ) const;
+  bool
+  operator !=( const Aabb2f& expr ) const;
+
+  float*
+  operator []( const unsigned int );
+  const float*
+  operator []( const unsigned int ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  float m_Values[ 2 ][ 2 ];
+
+};
+
+#endif /* MATH_AABB2F_HPP_ */
@@ -0,0 +1,435 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb3d.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Aabb3d.hpp"
+
+#include "Vec3d.hpp"
+#include "Mat4d.hpp"
+#include "Aabb3f.hpp"
+
+#include <cfloat>
+#include <cstdio>
+
+#define PARALLEL_CHUNKS 64
+#define PARALLEL_MINIMUM 4096
+
+/*
+ * Bounds of count positions, each three floats, stride bytes apart. The
+ * input is split into chunks whose partial bounds are reduced afterwards,
+ * the chunks run on all threads when built with OpenMP.
+ */
+static void
+StridedBounds( const char* base, const unsigned int stride, const unsigned int count,
+               double* minimum, double* maximum )
+{
+  double             partial[ PARALLEL_CHUNKS ][ 6 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    double minX =  DBL_MAX, minY =  DBL_MAX, minZ =  DBL_MAX;
+    double maxX = -DBL_MAX, maxY = -DBL_MAX, maxZ = -DBL_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      const double* p = reinterpret_cast< const double* >( base + (unsigned long)i * stride );
+
+      minX = p[ 0 ] < minX ? p[ 0 ] : minX; maxX = p[ 0 ] > maxX ? p[ 0 ] : maxX;
+      minY = p[ 1 ] < minY ? p[ 1 ] : minY; maxY = p[ 1 ] > maxY ? p[ 1 ] : maxY;
+      minZ = p[ 2 ] < minZ ? p[ 2 ] : minZ; maxZ = p[ 2 ] > maxZ ? p[ 2 ] : maxZ;
+    }
+
+    partial[ c ][ 0 ] = minX; partial[ c ][ 1 ] = minY; partial[ c ][ 2 ] = minZ;
+    partial[ c ][ 3 ] = maxX; partial[ c ][ 4 ] = maxY; partial[ c ][ 5 ] = maxZ;
+  }
+
+  minimum[ 0 ] = minimum[ 1 ] = minimum[ 2 ] =  DBL_MAX;
+  maximum[ 0 ] = maximum[ 1 ] = maximum[ 2 ] = -DBL_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+    for ( unsigned int i = 0; i < 3; i++ )
+    {
+      if ( partial[ c ][ i ]     < minimum[ i ] ) minimum[ i ] = partial[ c ][ i ];
+      if ( partial[ c ][ 3 + i ] > maximum[ i ] ) maximum[ i ] = partial[ c ][ 3 + i ];
+    }
+}
+
+static void
+ArrayBounds( const double* values, const unsigned int count, double& minimum, double& maximum )
+{
+  double             partial[ PARALLEL_CHUNKS ][ 2 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    double localMin =  DBL_MAX;
+    double localMax = -DBL_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      localMin = values[ i ] < localMin ? values[ i ] : localMin;
+      localMax = values[ i ] > localMax ? values[ i ] : localMax;
+    }
+
+    partial[ c ][ 0 ] = localMin;
+    partial[ c ][ 1 ] = localMax;
+  }
+
+  minimum =  DBL_MAX;
+  maximum = -DBL_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+  {
+    if ( partial[ c ][ 0 ] < minimum ) minimum = partial[ c ][ 0 ];
+    if ( partial[ c ][ 1 ] > maximum ) maximum = partial[ c ][ 1 ];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Aabb3d::Aabb3d( void )
+{
+  Clear();
+}
+
+Aabb3d::Aabb3d( const Aabb3d& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = other.m_Values[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = other.m_Values[ 1 ][ i ];
+  }
+}
+
+Aabb3d::Aabb3d( const Aabb3f& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = other[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = other[ 1 ][ i ];
+  }
+}
+
+Aabb3d::Aabb3d( const Vec3d& min, const Vec3d& max )
+{
+  Set( min, max );
+}
+
+Aabb3d::~Aabb3d( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Aabb3d::Set( const Vec3d& min, const Vec3d& max )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = min[ i ];
+    m_Values[ 1 ][ i ] = max[ i ];
+  }
+}
+
+void
+Aabb3d::Clear( void )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] =  DBL_MAX;
+    m_Values[ 1 ][ i ] = -DBL_MAX;
+  }
+}
+
+bool
+Aabb3d::Empty( void ) const
+{
+  return m_Values[ 0 ][ 0 ] > m_Values[ 1 ][ 0 ] ||
+         m_Values[ 0 ][ 1 ] > m_Values[ 1 ][ 1 ] ||
+         m_Values[ 0 ][ 2 ] > m_Values[ 1 ][ 2 ];
+}
+
+Vec3d
+Aabb3d::Min( void ) const
+{
+  return Vec3d( m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+}
+
+Vec3d
+Aabb3d::Max( void ) const
+{
+  return Vec3d( m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+Vec3d
+Aabb3d::Center( void ) const
+{
+  return Vec3d( ( m_Values[ 0 ][ 0 ] + m_Values[ 1 ][ 0 ] ) * 0.5,
+                ( m_Values[ 0 ][ 1 ] + m_Values[ 1 ][ 1 ] ) * 0.5,
+                ( m_Values[ 0 ][ 2 ] + m_Values[ 1 ][ 2 ] ) * 0.5 );
+}
+
+Vec3d
+Aabb3d::Size( void ) const
+{
+  if ( Empty() ) return Vec3d();
+
+  return Vec3d( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ],
+                m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ],
+                m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ] );
+}
+
+double
+Aabb3d::SurfaceArea( void ) const
+{
+  if ( Empty() ) return 0.0;
+
+  const double x = m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ];
+  const double y = m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ];
+  const double z = m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ];
+
+  return 2.0 * ( x * y + y * z + z * x );
+}
+
+double
+Aabb3d::Volume( void ) const
+{
+  if ( Empty() ) return 0.0;
+
+  return ( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ] ) *
+         ( m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ] ) *
+         ( m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ] );
+}
+
+Aabb3d&
+Aabb3d::Extend( const Vec3d& point )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if ( point[ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = point[ i ];
+    if ( point[ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = point[ i ];
+  }
+
+  return *this;
+}
+
+Aabb3d&
+Aabb3d::Extend( const Aabb3d& box )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if ( box.m_Values[ 0 ][ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = box.m_Values[ 0 ][ i ];
+    if ( box.m_Values[ 1 ][ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = box.m_Values[ 1 ][ i ];
+  }
+
+  return *this;
+}
+
+Aabb3d
+Aabb3d::Union( const Vec3d& point ) const
+{
+  return Aabb3d( *this ).Extend( point );
+}
+
+Aabb3d
+Aabb3d::Union( const Aabb3d& box ) const
+{
+  return Aabb3d( *this ).Extend( box );
+}
+
+Aabb3d
+Aabb3d::Intersection( const Aabb3d& box ) const
+{
+  Aabb3d result;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    result.m_Values[ 0 ][ i ] = m_Values[ 0 ][ i ] > box.m_Values[ 0 ][ i ] ? m_Values[ 0 ][ i ] : box.m_Values[ 0 ][ i ];
+    result.m_Values[ 1 ][ i ] = m_Values[ 1 ][ i ] < box.m_Values[ 1 ][ i ] ? m_Values[ 1 ][ i ] : box.m_Values[ 1 ][ i ];
+  }
+
+  if ( result.Empty() ) result.Clear();
+
+  return result;
+}
+
+bool
+Aabb3d::Intersects( const Aabb3d& box ) const
+{
+  return m_Values[ 0 ][ 0 ] <= box.m_Values[ 1 ][ 0 ] && m_Values[ 1 ][ 0 ] >= box.m_Values[ 0 ][ 0 ] &&
+         m_Values[ 0 ][ 1 ] <= box.m_Values[ 1 ][ 1 ] && m_Values[ 1 ][ 1 ] >= box.m_Values[ 0 ][ 1 ] &&
+         m_Values[ 0 ][ 2 ] <= box.m_Values[ 1 ][ 2 ] && m_Values[ 1 ][ 2 ] >= box.m_Values[ 0 ][ 2 ];
+}
+
+bool
+Aabb3d::Contains( const Vec3d& point ) const
+{
+  return point[ 0 ] >= m_Values[ 0 ][ 0 ] && point[ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         point[ 1 ] >= m_Values[ 0 ][ 1 ] && point[ 1 ] <= m_Values[ 1 ][ 1 ] &&
+         point[ 2 ] >= m_Values[ 0 ][ 2 ] && point[ 2 ] <= m_Values[ 1 ][ 2 ];
+}
+
+bool
+Aabb3d::Contains( const Aabb3d& box ) const
+{
+  return box.m_Values[ 0 ][ 0 ] >= m_Values[ 0 ][ 0 ] && box.m_Values[ 1 ][ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         box.m_Values[ 0 ][ 1 ] >= m_Values[ 0 ][ 1 ] && box.m_Values[ 1 ][ 1 ] <= m_Values[ 1 ][ 1 ] &&
+         box.m_Values[ 0 ][ 2 ] >= m_Values[ 0 ][ 2 ] && box.m_Values[ 1 ][ 2 ] <= m_Values[ 1 ][ 2 ];
+}
+
+/*
+ * Arvo, "Transforming Axis-Aligned Bounding Boxes", Graphics Gems 1990.
+ * Each output extent is the sum of the smaller and larger product of the
+ * matrix element with the input extent, so no corner is transformed.
+ */
+Aabb3d
+Aabb3d::Transform( const Mat4d& matrix ) const
+{
+  if ( Empty() ) return *this;
+
+  Aabb3d result;
+
+  for ( unsigned int row = 0; row < 3; row++ )
+  {
+    double minimum = matrix[ row ][ 3 ];
+    double maximum = matrix[ row ][ 3 ];
+
+    for ( unsigned int col = 0; col < 3; col++ )
+    {
+      const double a = matrix[ row ][ col ] * m_Values[ 0 ][ col ];
+      const double b = matrix[ row ][ col ] * m_Values[ 1 ][ col ];
+
+      minimum += a < b ? a : b;
+      maximum += a < b ? b : a;
+    }
+
+    result.m_Values[ 0 ][ row ] = minimum;
+    result.m_Values[ 1 ][ row ] = maximum;
+  }
+
+  return result;
+}
+
+Aabb3d
+Aabb3d::Bounds( const Vec3d* points, const unsigned int count )
+{
+  Aabb3d result;
+
+  if ( count == 0 ) return result;
+
+  /* Vec3d carries a vtable pointer, so its values sit at a fixed offset */
+  StridedBounds( reinterpret_cast< const char* >( points[ 0 ].Values() ), sizeof( Vec3d ), count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+Aabb3d
+Aabb3d::Bounds( const double* x, const double* y, const double* z, const unsigned int count )
+{
+  Aabb3d result;
+
+  ArrayBounds( x, count, result.m_Values[ 0 ][ 0 ], result.m_Values[ 1 ][ 0 ] );
+  ArrayBounds( y, count, result.m_Values[ 0 ][ 1 ], result.m_Values[ 1 ][ 1 ] );
+  ArrayBounds( z, count, result.m_Values[ 0 ][ 2 ], result.m_Values[ 1 ][ 2 ] );
+
+  return result;
+}
+
+Aabb3d
+Aabb3d::Bounds( const double* positions, const unsigned int count, const unsigned int stride )
+{
+  Aabb3d result;
+
+  StridedBounds( reinterpret_cast< const char* >( positions ), stride, count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+bool
+Aabb3d::operator ==( const Aabb3d& expr ) const
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    if ( m_Values[ 0 ][ i ] != expr.m_Values[ 0 ][ i ] ||
+         m_Values[ 1 ][ i ] != expr.m_Values[ 1 ][ i ] )
+      return false;
+
+  return true;
+}
+
+bool
+Aabb3d::operator !=( const Aabb3d& expr ) const
+{
+  return !( *this == expr );
+}
+
+double*
+Aabb3d::operator []( const unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+const double*
+Aabb3d::operator []( const unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Aabb3d::Print( void ) const
+{
+  printf( "[ ( %f | %f | %f ) - ( %f | %f | %f ) ]\n",
+          m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ],
+          m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
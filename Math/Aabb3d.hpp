@@ -0,0 +1,115 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb3d.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_AABB3D_HPP_
+#define MATH_AABB3D_HPP_
+
+class Vec3d;
+class Mat4d;
+class Aabb3f;
+
+/*
+ * GeekEngine::Aabb3d
+ *
+ * Axis aligned bounding box. A default constructed box is empty
+ * ( min = +DBL_MAX, max = -DBL_MAX ) so it can be grown point by point.
+ */
+class Aabb3d
+{
+public:
+  Aabb3d( void );
+  Aabb3d( const Aabb3d& );
+  explicit
+  Aabb3d( const Aabb3f& other );
+  Aabb3d( const Vec3d& min, const Vec3d& max );
+  virtual
+  ~Aabb3d( void );
+
+  void
+  Set( const Vec3d& min, const Vec3d& max );
+  void
+  Clear( void );
+
+  bool
+  Empty( void ) const;
+  Vec3d
+  Min( void ) const;
+  Vec3d
+  Max( void ) const;
+  Vec3d
+  Center( void ) const;
+  Vec3d
+  Size( void ) const;
+  double
+  SurfaceArea( void ) const;
+  double
+  Volume( void ) const;
+
+  Aabb3d&
+  Extend( const Vec3d& point );
+  Aabb3d&
+  Extend( const Aabb3d& box );
+
+  Aabb3d
+  Union( const Vec3d& point ) const;
+  Aabb3d
+  Union( const Aabb3d& box ) const;
+  Aabb3d
+  Intersection( const Aabb3d& box ) const;
+  bool
+  Intersects( const Aabb3d& box ) const;
+  bool
+  Contains( const Vec3d& point ) const;
+  bool
+  Contains( const Aabb3d& box ) const;
+
+  Aabb3d
+  Transform( const Mat4d& matrix ) const;
+
+  static Aabb3d
+  Bounds( const Vec3d* points, const unsigned int count );
+  static Aabb3d
+  Bounds( const double* x, const double* y, const double* z, const unsigned int count );
+  static Aabb3d
+  Bounds( const double* positions, const unsigned int count, const unsigned int stride );
+
+  bool
+  operator ==( const Aabb3d& expr ) const;
+  bool
+  operator !=( const Aabb3d& expr ) const;
+
+  double*
+  operator []( const unsigned int );
+  const double*
+  operator []( const unsigned int ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  double m_Values[ 2 ][ 3 ];
+
+};
+
+#endif /* MATH_AABB3D_HPP_ */
@@ -0,0 +1,435 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Aabb3f.hpp"
+
+#include "Vec3f.hpp"
+#include "Mat4f.hpp"
+#include "Aabb3d.hpp"
+
+#include <cfloat>
+#include <cstdio>
+
+#define PARALLEL_CHUNKS 64
+#define PARALLEL_MINIMUM 4096
+
+/*
+ * Bounds of count positions, each three floats, stride bytes apart. The
+ * input is split into chunks whose partial bounds are reduced afterwards,
+ * the chunks run on all threads when built with OpenMP.
+ */
+static void
+StridedBounds( const char* base, const unsigned int stride, const unsigned int count,
+               float* minimum, float* maximum )
+{
+  float              partial[ PARALLEL_CHUNKS ][ 6 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    float minX =  FLT_MAX, minY =  FLT_MAX, minZ =  FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX, maxZ = -FLT_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      const float* p = reinterpret_cast< const float* >( base + (unsigned long)i * stride );
+
+      minX = p[ 0 ] < minX ? p[ 0 ] : minX; maxX = p[ 0 ] > maxX ? p[ 0 ] : maxX;
+      minY = p[ 1 ] < minY ? p[ 1 ] : minY; maxY = p[ 1 ] > maxY ? p[ 1 ] : maxY;
+      minZ = p[ 2 ] < minZ ? p[ 2 ] : minZ; maxZ = p[ 2 ] > maxZ ? p[ 2 ] : maxZ;
+    }
+
+    partial[ c ][ 0 ] = minX; partial[ c ][ 1 ] = minY; partial[ c ][ 2 ] = minZ;
+    partial[ c ][ 3 ] = maxX; partial[ c ][ 4 ] = maxY; partial[ c ][ 5 ] = maxZ;
+  }
+
+  minimum[ 0 ] = minimum[ 1 ] = minimum[ 2 ] =  FLT_MAX;
+  maximum[ 0 ] = maximum[ 1 ] = maximum[ 2 ] = -FLT_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+    for ( unsigned int i = 0; i < 3; i++ )
+    {
+      if ( partial[ c ][ i ]     < minimum[ i ] ) minimum[ i ] = partial[ c ][ i ];
+      if ( partial[ c ][ 3 + i ] > maximum[ i ] ) maximum[ i ] = partial[ c ][ 3 + i ];
+    }
+}
+
+static void
+ArrayBounds( const float* values, const unsigned int count, float& minimum, float& maximum )
+{
+  float              partial[ PARALLEL_CHUNKS ][ 2 ];
+  const unsigned int chunk  = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int          chunks = chunk > 0 ? ( count + chunk - 1 ) / chunk : 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int c = 0; c < chunks; c++ )
+  {
+    const unsigned int first = c * chunk;
+    const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+    float localMin =  FLT_MAX;
+    float localMax = -FLT_MAX;
+
+    for ( unsigned int i = first; i < last; i++ )
+    {
+      localMin = values[ i ] < localMin ? values[ i ] : localMin;
+      localMax = values[ i ] > localMax ? values[ i ] : localMax;
+    }
+
+    partial[ c ][ 0 ] = localMin;
+    partial[ c ][ 1 ] = localMax;
+  }
+
+  minimum =  FLT_MAX;
+  maximum = -FLT_MAX;
+
+  for ( int c = 0; c < chunks; c++ )
+  {
+    if ( partial[ c ][ 0 ] < minimum ) minimum = partial[ c ][ 0 ];
+    if ( partial[ c ][ 1 ] > maximum ) maximum = partial[ c ][ 1 ];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Aabb3f::Aabb3f( void )
+{
+  Clear();
+}
+
+Aabb3f::Aabb3f( const Aabb3f& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = other.m_Values[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = other.m_Values[ 1 ][ i ];
+  }
+}
+
+Aabb3f::Aabb3f( const Aabb3d& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = (float)other[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = (float)other[ 1 ][ i ];
+  }
+}
+
+Aabb3f::Aabb3f( const Vec3f& min, const Vec3f& max )
+{
+  Set( min, max );
+}
+
+Aabb3f::~Aabb3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Aabb3f::Set( const Vec3f& min, const Vec3f& max )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = min[ i ];
+    m_Values[ 1 ][ i ] = max[ i ];
+  }
+}
+
+void
+Aabb3f::Clear( void )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] =  FLT_MAX;
+    m_Values[ 1 ][ i ] = -FLT_MAX;
+  }
+}
+
+bool
+Aabb3f::Empty( void ) const
+{
+  return m_Values[ 0 ][ 0 ] > m_Values[ 1 ][ 0 ] ||
+         m_Values[ 0 ][ 1 ] > m_Values[ 1 ][ 1 ] ||
+         m_Values[ 0 ][ 2 ] > m_Values[ 1 ][ 2 ];
+}
+
+Vec3f
+Aabb3f::Min( void ) const
+{
+  return Vec3f( m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+}
+
+Vec3f
+Aabb3f::Max( void ) const
+{
+  return Vec3f( m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+Vec3f
+Aabb3f::Center( void ) const
+{
+  return Vec3f( ( m_Values[ 0 ][ 0 ] + m_Values[ 1 ][ 0 ] ) * 0.5f,
+                ( m_Values[ 0 ][ 1 ] + m_Values[ 1 ][ 1 ] ) * 0.5f,
+                ( m_Values[ 0 ][ 2 ] + m_Values[ 1 ][ 2 ] ) * 0.5f );
+}
+
+Vec3f
+Aabb3f::Size( void ) const
+{
+  if ( Empty() ) return Vec3f();
+
+  return Vec3f( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ],
+                m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ],
+                m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ] );
+}
+
+float
+Aabb3f::SurfaceArea( void ) const
+{
+  if ( Empty() ) return 0.0f;
+
+  const float x = m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ];
+  const float y = m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ];
+  const float z = m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ];
+
+  return 2.0f * ( x * y + y * z + z * x );
+}
+
+float
+Aabb3f::Volume( void ) const
+{
+  if ( Empty() ) return 0.0f;
+
+  return ( m_Values[ 1 ][ 0 ] - m_Values[ 0 ][ 0 ] ) *
+         ( m_Values[ 1 ][ 1 ] - m_Values[ 0 ][ 1 ] ) *
+         ( m_Values[ 1 ][ 2 ] - m_Values[ 0 ][ 2 ] );
+}
+
+Aabb3f&
+Aabb3f::Extend( const Vec3f& point )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if ( point[ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = point[ i ];
+    if ( point[ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = point[ i ];
+  }
+
+  return *this;
+}
+
+Aabb3f&
+Aabb3f::Extend( const Aabb3f& box )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if ( box.m_Values[ 0 ][ i ] < m_Values[ 0 ][ i ] ) m_Values[ 0 ][ i ] = box.m_Values[ 0 ][ i ];
+    if ( box.m_Values[ 1 ][ i ] > m_Values[ 1 ][ i ] ) m_Values[ 1 ][ i ] = box.m_Values[ 1 ][ i ];
+  }
+
+  return *this;
+}
+
+Aabb3f
+Aabb3f::Union( const Vec3f& point ) const
+{
+  return Aabb3f( *this ).Extend( point );
+}
+
+Aabb3f
+Aabb3f::Union( const Aabb3f& box ) const
+{
+  return Aabb3f( *this ).Extend( box );
+}
+
+Aabb3f
+Aabb3f::Intersection( const Aabb3f& box ) const
+{
+  Aabb3f result;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    result.m_Values[ 0 ][ i ] = m_Values[ 0 ][ i ] > box.m_Values[ 0 ][ i ] ? m_Values[ 0 ][ i ] : box.m_Values[ 0 ][ i ];
+    result.m_Values[ 1 ][ i ] = m_Values[ 1 ][ i ] < box.m_Values[ 1 ][ i ] ? m_Values[ 1 ][ i ] : box.m_Values[ 1 ][ i ];
+  }
+
+  if ( result.Empty() ) result.Clear();
+
+  return result;
+}
+
+bool
+Aabb3f::Intersects( const Aabb3f& box ) const
+{
+  return m_Values[ 0 ][ 0 ] <= box.m_Values[ 1 ][ 0 ] && m_Values[ 1 ][ 0 ] >= box.m_Values[ 0 ][ 0 ] &&
+         m_Values[ 0 ][ 1 ] <= box.m_Values[ 1 ][ 1 ] && m_Values[ 1 ][ 1 ] >= box.m_Values[ 0 ][ 1 ] &&
+         m_Values[ 0 ][ 2 ] <= box.m_Values[ 1 ][ 2 ] && m_Values[ 1 ][ 2 ] >= box.m_Values[ 0 ][ 2 ];
+}
+
+bool
+Aabb3f::Contains( const Vec3f& point ) const
+{
+  return point[ 0 ] >= m_Values[ 0 ][ 0 ] && point[ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         point[ 1 ] >= m_Values[ 0 ][ 1 ] && point[ 1 ] <= m_Values[ 1 ][ 1 ] &&
+         point[ 2 ] >= m_Values[ 0 ][ 2 ] && point[ 2 ] <= m_Values[ 1 ][ 2 ];
+}
+
+bool
+Aabb3f::Contains( const Aabb3f& box ) const
+{
+  return box.m_Values[ 0 ][ 0 ] >= m_Values[ 0 ][ 0 ] && box.m_Values[ 1 ][ 0 ] <= m_Values[ 1 ][ 0 ] &&
+         box.m_Values[ 0 ][ 1 ] >= m_Values[ 0 ][ 1 ] && box.m_Values[ 1 ][ 1 ] <= m_Values[ 1 ][ 1 ] &&
+         box.m_Values[ 0 ][ 2 ] >= m_Values[ 0 ][ 2 ] && box.m_Values[ 1 ][ 2 ] <= m_Values[ 1 ][ 2 ];
+}
+
+/*
+ * Arvo, "Transforming Axis-Aligned Bounding Boxes", Graphics Gems 1990.
+ * Each output extent is the sum of the smaller and larger product of the
+ * matrix element with the input extent, so no corner is transformed.
+ */
+Aabb3f
+Aabb3f::Transform( const Mat4f& matrix ) const
+{
+  if ( Empty() ) return *this;
+
+  Aabb3f result;
+
+  for ( unsigned int row = 0; row < 3; row++ )
+  {
+    float minimum = matrix[ row ][ 3 ];
+    float maximum = matrix[ row ][ 3 ];
+
+    for ( unsigned int col = 0; col < 3; col++ )
+    {
+      const float a = matrix[ row ][ col ] * m_Values[ 0 ][ col ];
+      const float b = matrix[ row ][ col ] * m_Values[ 1 ][ col ];
+
+      minimum += a < b ? a : b;
+      maximum += a < b ? b : a;
+    }
+
+    result.m_Values[ 0 ][ row ] = minimum;
+    result.m_Values[ 1 ][ row ] = maximum;
+  }
+
+  return result;
+}
+
+Aabb3f
+Aabb3f::Bounds( const Vec3f* points, const unsigned int count )
+{
+  Aabb3f result;
+
+  if ( count == 0 ) return result;
+
+  /* Vec3f carries a vtable pointer, so its values sit at a fixed offset */
+  StridedBounds( reinterpret_cast< const char* >( points[ 0 ].Values() ), sizeof( Vec3f ), count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+Aabb3f
+Aabb3f::Bounds( const float* x, const float* y, const float* z, const unsigned int count )
+{
+  Aabb3f result;
+
+  ArrayBounds( x, count, result.m_Values[ 0 ][ 0 ], result.m_Values[ 1 ][ 0 ] );
+  ArrayBounds( y, count, result.m_Values[ 0 ][ 1 ], result.m_Values[ 1 ][ 1 ] );
+  ArrayBounds( z, count, result.m_Values[ 0 ][ 2 ], result.m_Values[ 1 ][ 2 ] );
+
+  return result;
+}
+
+Aabb3f
+Aabb3f::Bounds( const float* positions, const unsigned int count, const unsigned int stride )
+{
+  Aabb3f result;
+
+  StridedBounds( reinterpret_cast< const char* >( positions ), stride, count,
+                 result.m_Values[ 0 ], result.m_Values[ 1 ] );
+
+  return result;
+}
+
+bool
+Aabb3f::operator ==( const Aabb3f& expr ) const
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    if ( m_Values[ 0 ][ i ] != expr.m_Values[ 0 ][ i ] ||
+         m_Values[ 1 ][ i ] != expr.m_Values[ 1 ][ i ] )
+      return false;
+
+  return true;
+}
+
+bool
+Aabb3f::operator !=( const Aabb3f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float*
+Aabb3f::operator []( const unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+const float*
+Aabb3f::operator []( const unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Aabb3f::Print( void ) const
+{
+  printf( "[ ( %f | %f | %f ) - ( %f | %f | %f ) ]\n",
+          m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ],
+          m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,115 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Aabb3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_AABB3F_HPP_
+#define MATH_AABB3F_HPP_
+
+class Vec3f;
+class Mat4f;
+class Aabb3d;
+
+/*
+ * GeekEngine::Aabb3f
+ *
+ * Axis aligned bounding box. A default constructed box is empty
+ * ( min = +FLT_MAX, max = -FLT_MAX ) so it can be grown point by point.
+ */
+class Aabb3f
+{
+public:
+  Aabb3f( void );
+  Aabb3f( const Aabb3f& );
+  explicit
+  Aabb3f( const Aabb3d& other );
+  Aabb3f( const Vec3f& min, const Vec3f& max );
+  virtual
+  ~Aabb3f( void );
+
+  void
+  Set( const Vec3f& min, const Vec3f& max );
+  void
+  Clear( void );
+
+  bool
+  Empty( void ) const;
+  Vec3f
+  Min( void ) const;
+  Vec3f
+  Max( void ) const;
+  Vec3f
+  Center( void ) const;
+  Vec3f
+  Size( void ) const;
+  float
+  SurfaceArea( void ) const;
+  float
+  Volume( void ) const;
+
+  Aabb3f&
+  Extend( const Vec3f& point );
+  Aabb3f&
+  Extend( const Aabb3f& box );
+
+  Aabb3f
+  Union( const Vec3f& point ) const;
+  Aabb3f
+  Union( const Aabb3f& box ) const;
+  Aabb3f
+  Intersection( const Aabb3f& box ) const;
+  bool
+  Intersects( const Aabb3f& box ) const;
+  bool
+  Contains( const Vec3f& point ) const;
+  bool
+  Contains( const Aabb3f& box ) const;
+
+  Aabb3f
+  Transform( const Mat4f& matrix ) const;
+
+  static Aabb3f
+  Bounds( const Vec3f* points, const unsigned int count );
+  static Aabb3f
+  Bounds( const float* x, const float* y, const float* z, const unsigned int count );
+  static Aabb3f
+  Bounds( const float* positions, const unsigned int count, const unsigned int stride );
+
+  bool
+  operator ==( const Aabb3f& expr ) const;
+  bool
+  operator !=( const Aabb3f& expr ) const;
+
+  float*
+  operator []( const unsigned int );
+  const float*
+  operator []( const unsigned int ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  float m_Values[ 2 ][ 3 ];
+
+};
+
+#endif /* MATH_AABB3F_HPP_ */
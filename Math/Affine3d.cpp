@@ -0,0 +1,476 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Affine3d.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Affine3d.hpp"
+#include "Profile.hpp"
+
+#include "Vec3d.hpp"
+#include "Quaterniond.hpp"
+#include "Mat4d.hpp"
+#include "Affine3f.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined( __AVX__ )
+  #include <immintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+
+static const unsigned int AFFINE_SIZE = sizeof( double ) * 12;
+
+typedef char Affine3dPacked[ sizeof( Affine3d ) == 12 * sizeof( double ) ? 1 : -1 ];
+
+/* result = left * right on 12 row major doubles each, result may alias either */
+static inline void
+Multiply( const double* left, const double* right, double* result )
+{
+#if defined( __AVX__ )
+  const __m256d row0        = _mm256_loadu_pd( right + 0 );
+  const __m256d row1        = _mm256_loadu_pd( right + 4 );
+  const __m256d row2        = _mm256_loadu_pd( right + 8 );
+  const __m256d translation = _mm256_castsi256_pd( _mm256_setr_epi64x( 0, 0, 0, -1 ) );
+  __m256d       rows[ 3 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+  {
+    const __m256d l = _mm256_loadu_pd( left + row * 4 );
+
+    rows[ row ] = _mm256_add_pd( _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( _mm256_set1_pd( left[ row * 4 + 0 ] ), row0 ),
+                                                               _mm256_mul_pd( _mm256_set1_pd( left[ row * 4 + 1 ] ), row1 ) ),
+                                                _mm256_mul_pd( _mm256_set1_pd( left[ row * 4 + 2 ] ), row2 ) ),
+                                 _mm256_and_pd( l, translation ) );
+  }
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    _mm256_storeu_pd( result + row * 4, rows[ row ] );
+#else
+  double values[ 12 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      values[ row * 4 + col ] = left[ row * 4 + 0 ] * right[ 0 * 4 + col ] +
+                                left[ row * 4 + 1 ] * right[ 1 * 4 + col ] +
+                                left[ row * 4 + 2 ] * right[ 2 * 4 + col ] +
+                                ( col == 3 ? left[ row * 4 + 3 ] : 0.0 );
+
+  memcpy( result, values, AFFINE_SIZE );
+#endif
+}
+
+/* w = 1 adds the translation, w = 0 leaves it out, result may alias vector */
+static inline void
+Transform( const double* m, const Vec3d& vector, const double w, Vec3d& result )
+{
+  const double x = vector.X();
+  const double y = vector.Y();
+  const double z = vector.Z();
+
+  result.Set( m[ 0 ] * x + m[ 1 ] * y + m[ 2 ]  * z + m[ 3 ]  * w,
+              m[ 4 ] * x + m[ 5 ] * y + m[ 6 ]  * z + m[ 7 ]  * w,
+              m[ 8 ] * x + m[ 9 ] * y + m[ 10 ] * z + m[ 11 ] * w );
+}
+
+static void
+Transform( const double* m, const Vec3d* vectors, const unsigned int count, const double w, Vec3d* result )
+{
+  const int blocks = ( count + 3 ) / 4;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * 4;
+    unsigned int       i     = first;
+
+#if defined( __AVX__ )
+    if ( first + 4 <= count )
+    {
+      const Vec3d*  v = vectors + first;
+      const __m256d x = _mm256_setr_pd( v[ 0 ].X(), v[ 1 ].X(), v[ 2 ].X(), v[ 3 ].X() );
+      const __m256d y = _mm256_setr_pd( v[ 0 ].Y(), v[ 1 ].Y(), v[ 2 ].Y(), v[ 3 ].Y() );
+      const __m256d z = _mm256_setr_pd( v[ 0 ].Z(), v[ 1 ].Z(), v[ 2 ].Z(), v[ 3 ].Z() );
+      double        values[ 3 ][ 4 ];
+
+      for ( unsigned int row = 0; row < 3; row++ )
+      {
+        const double* r = m + row * 4;
+
+        _mm256_storeu_pd( values[ row ],
+                          _mm256_add_pd( _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( _mm256_set1_pd( r[ 0 ] ), x ),
+                                                                       _mm256_mul_pd( _mm256_set1_pd( r[ 1 ] ), y ) ),
+                                                        _mm256_mul_pd( _mm256_set1_pd( r[ 2 ] ), z ) ),
+                                         _mm256_set1_pd( r[ 3 ] * w ) ) );
+      }
+
+      for ( unsigned int k = 0; k < 4; k++ )
+        result[ first + k ].Set( values[ 0 ][ k ], values[ 1 ][ k ], values[ 2 ][ k ] );
+
+      i += 4;
+    }
+#endif
+
+    for ( ; i < first + 4 && i < count; i++ )
+      Transform( m, vectors[ i ], w, result[ i ] );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Affine3d::Affine3d( void )
+{
+  Identity();
+}
+
+Affine3d::Affine3d( const Affine3d& affine )
+{
+  memcpy( m_Values, affine.m_Values, AFFINE_SIZE );
+}
+
+Affine3d::Affine3d( const Affine3f& affine )
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      m_Values[ row ][ col ] = affine[ row ][ col ];
+}
+
+Affine3d::Affine3d( const Mat4d& matrix )
+{
+  memcpy( m_Values, matrix.Values(), AFFINE_SIZE );
+}
+
+Affine3d::Affine3d( const double* values )
+{
+  memcpy( m_Values, values, AFFINE_SIZE );
+}
+
+Affine3d::Affine3d( const Quaterniond& rotation, const Vec3d& translation )
+{
+  Set( rotation, translation, Vec3d( 1.0, 1.0, 1.0 ) );
+}
+
+Affine3d::Affine3d( const Quaterniond& rotation, const Vec3d& translation, const Vec3d& scale )
+{
+  Set( rotation, translation, scale );
+}
+
+Affine3d::~Affine3d( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Affine3d
+Affine3d::Identity( void )
+{
+  memset( m_Values, 0, AFFINE_SIZE );
+
+  m_Values[ 0 ][ 0 ] = 1.0;
+  m_Values[ 1 ][ 1 ] = 1.0;
+  m_Values[ 2 ][ 2 ] = 1.0;
+
+  return *this;
+}
+
+void
+Affine3d::Set( const Quaterniond& rotation, const Vec3d& translation, const Vec3d& scale )
+{
+  const double x = rotation.X();
+  const double y = rotation.Y();
+  const double z = rotation.Z();
+  const double w = rotation.W();
+
+  /* the rotation of Mat4d::Rotation( quaternion ), each column scaled */
+  m_Values[ 0 ][ 0 ] = ( 1.0 - 2.0 * ( y * y + z * z ) ) * scale.X();
+  m_Values[ 0 ][ 1 ] = (        2.0 * ( x * y - w * z ) ) * scale.Y();
+  m_Values[ 0 ][ 2 ] = (        2.0 * ( x * z + w * y ) ) * scale.Z();
+  m_Values[ 1 ][ 0 ] = (        2.0 * ( x * y + w * z ) ) * scale.X();
+  m_Values[ 1 ][ 1 ] = ( 1.0 - 2.0 * ( x * x + z * z ) ) * scale.Y();
+  m_Values[ 1 ][ 2 ] = (        2.0 * ( y * z - w * x ) ) * scale.Z();
+  m_Values[ 2 ][ 0 ] = (        2.0 * ( x * z - w * y ) ) * scale.X();
+  m_Values[ 2 ][ 1 ] = (        2.0 * ( y * z + w * x ) ) * scale.Y();
+  m_Values[ 2 ][ 2 ] = ( 1.0 - 2.0 * ( x * x + y * y ) ) * scale.Z();
+
+  m_Values[ 0 ][ 3 ] = translation.X();
+  m_Values[ 1 ][ 3 ] = translation.Y();
+  m_Values[ 2 ][ 3 ] = translation.Z();
+}
+
+Mat4d
+Affine3d::Matrix( void ) const
+{
+  Mat4d result;
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      result.Set( row, col, m_Values[ row ][ col ] );
+
+  result.Set( 3, 3, 1.0 );
+
+  return result;
+}
+
+Quaterniond
+Affine3d::Rotation( void ) const
+{
+  const Vec3d scale = Scale();
+  double       m[ 3 ][ 3 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 3; col++ )
+      m[ row ][ col ] = scale[ col ] != 0.0 ? m_Values[ row ][ col ] / scale[ col ] : 0.0;
+
+  const double trace = m[ 0 ][ 0 ] + m[ 1 ][ 1 ] + m[ 2 ][ 2 ];
+  Quaterniond  result;
+
+  if      ( trace > 0 )
+  {
+    const double s = 0.5 / sqrt( trace + 1.0 );
+
+    result.Set( ( m[ 2 ][ 1 ] - m[ 1 ][ 2 ] ) * s, ( m[ 0 ][ 2 ] - m[ 2 ][ 0 ] ) * s,
+                ( m[ 1 ][ 0 ] - m[ 0 ][ 1 ] ) * s, 0.25 / s );
+  }
+  else if ( m[ 0 ][ 0 ] > m[ 1 ][ 1 ] && m[ 0 ][ 0 ] > m[ 2 ][ 2 ] )
+  {
+    const double s = 2.0 * sqrt( 1.0 + m[ 0 ][ 0 ] - m[ 1 ][ 1 ] - m[ 2 ][ 2 ] );
+
+    result.Set( 0.25 * s, ( m[ 0 ][ 1 ] + m[ 1 ][ 0 ] ) / s,
+                ( m[ 0 ][ 2 ] + m[ 2 ][ 0 ] ) / s, ( m[ 2 ][ 1 ] - m[ 1 ][ 2 ] ) / s );
+  }
+  else if ( m[ 1 ][ 1 ] > m[ 2 ][ 2 ] )
+  {
+    const double s = 2.0 * sqrt( 1.0 + m[ 1 ][ 1 ] - m[ 0 ][ 0 ] - m[ 2 ][ 2 ] );
+
+    result.Set( ( m[ 0 ][ 1 ] + m[ 1 ][ 0 ] ) / s, 0.25 * s,
+                ( m[ 1 ][ 2 ] + m[ 2 ][ 1 ] ) / s, ( m[ 0 ][ 2 ] - m[ 2 ][ 0 ] ) / s );
+  }
+  else
+  {
+    const double s = 2.0 * sqrt( 1.0 + m[ 2 ][ 2 ] - m[ 0 ][ 0 ] - m[ 1 ][ 1 ] );
+
+    result.Set( ( m[ 0 ][ 2 ] + m[ 2 ][ 0 ] ) / s, ( m[ 1 ][ 2 ] + m[ 2 ][ 1 ] ) / s,
+                0.25 * s, ( m[ 1 ][ 0 ] - m[ 0 ][ 1 ] ) / s );
+  }
+
+  return result / sqrt( result.LengthSq() );
+}
+
+Vec3d
+Affine3d::Translation( void ) const
+{
+  return Vec3d( m_Values[ 0 ][ 3 ], m_Values[ 1 ][ 3 ], m_Values[ 2 ][ 3 ] );
+}
+
+Vec3d
+Affine3d::Scale( void ) const
+{
+  const double ( *m )[ 4 ] = m_Values;
+
+  return Vec3d( sqrt( m[ 0 ][ 0 ] * m[ 0 ][ 0 ] + m[ 1 ][ 0 ] * m[ 1 ][ 0 ] + m[ 2 ][ 0 ] * m[ 2 ][ 0 ] ),
+                sqrt( m[ 0 ][ 1 ] * m[ 0 ][ 1 ] + m[ 1 ][ 1 ] * m[ 1 ][ 1 ] + m[ 2 ][ 1 ] * m[ 2 ][ 1 ] ),
+                sqrt( m[ 0 ][ 2 ] * m[ 0 ][ 2 ] + m[ 1 ][ 2 ] * m[ 1 ][ 2 ] + m[ 2 ][ 2 ] * m[ 2 ][ 2 ] ) );
+}
+
+Vec3d
+Affine3d::TransformPoint( const Vec3d& point ) const
+{
+  Vec3d result;
+
+  Transform( *m_Values, point, 1.0, result );
+
+  return result;
+}
+
+Vec3d
+Affine3d::TransformDirection( const Vec3d& direction ) const
+{
+  Vec3d result;
+
+  Transform( *m_Values, direction, 0.0, result );
+
+  return result;
+}
+
+double
+Affine3d::Determinant( void ) const
+{
+  return m_Values[ 0 ][ 0 ] * ( m_Values[ 1 ][ 1 ] * m_Values[ 2 ][ 2 ] - m_Values[ 1 ][ 2 ] * m_Values[ 2 ][ 1 ] ) -
+         m_Values[ 0 ][ 1 ] * ( m_Values[ 1 ][ 0 ] * m_Values[ 2 ][ 2 ] - m_Values[ 1 ][ 2 ] * m_Values[ 2 ][ 0 ] ) +
+         m_Values[ 0 ][ 2 ] * ( m_Values[ 1 ][ 0 ] * m_Values[ 2 ][ 1 ] - m_Values[ 1 ][ 1 ] * m_Values[ 2 ][ 0 ] );
+}
+
+Affine3d
+Affine3d::Inverse( void ) const
+{
+  double det = Determinant();
+
+  if ( det == 0 ) return *this;
+
+  det = 1.0 / det;
+
+  const double ( *m )[ 4 ] = m_Values;
+  Affine3d    result;
+
+  result.m_Values[ 0 ][ 0 ] = ( m[ 1 ][ 1 ] * m[ 2 ][ 2 ] - m[ 1 ][ 2 ] * m[ 2 ][ 1 ] ) * det;
+  result.m_Values[ 0 ][ 1 ] = ( m[ 0 ][ 2 ] * m[ 2 ][ 1 ] - m[ 0 ][ 1 ] * m[ 2 ][ 2 ] ) * det;
+  result.m_Values[ 0 ][ 2 ] = ( m[ 0 ][ 1 ] * m[ 1 ][ 2 ] - m[ 0 ][ 2 ] * m[ 1 ][ 1 ] ) * det;
+  result.m_Values[ 1 ][ 0 ] = ( m[ 1 ][ 2 ] * m[ 2 ][ 0 ] - m[ 1 ][ 0 ] * m[ 2 ][ 2 ] ) * det;
+  result.m_Values[ 1 ][ 1 ] = ( m[ 0 ][ 0 ] * m[ 2 ][ 2 ] - m[ 0 ][ 2 ] * m[ 2 ][ 0 ] ) * det;
+  result.m_Values[ 1 ][ 2 ] = ( m[ 0 ][ 2 ] * m[ 1 ][ 0 ] - m[ 0 ][ 0 ] * m[ 1 ][ 2 ] ) * det;
+  result.m_Values[ 2 ][ 0 ] = ( m[ 1 ][ 0 ] * m[ 2 ][ 1 ] - m[ 1 ][ 1 ] * m[ 2 ][ 0 ] ) * det;
+  result.m_Values[ 2 ][ 1 ] = ( m[ 0 ][ 1 ] * m[ 2 ][ 0 ] - m[ 0 ][ 0 ] * m[ 2 ][ 1 ] ) * det;
+  result.m_Values[ 2 ][ 2 ] = ( m[ 0 ][ 0 ] * m[ 1 ][ 1 ] - m[ 0 ][ 1 ] * m[ 1 ][ 0 ] ) * det;
+
+  /* the inverse translation is -R^-1 * t */
+  for ( unsigned int row = 0; row < 3; row++ )
+    result.m_Values[ row ][ 3 ] = -( result.m_Values[ row ][ 0 ] * m[ 0 ][ 3 ] +
+                                     result.m_Values[ row ][ 1 ] * m[ 1 ][ 3 ] +
+                                     result.m_Values[ row ][ 2 ] * m[ 2 ][ 3 ] );
+
+  return result;
+}
+
+void
+Affine3d::TransformPoints( const Vec3d* points, const unsigned int count, Vec3d* result ) const
+{
+  Transform( *m_Values, points, count, 1.0, result );
+}
+
+void
+Affine3d::TransformDirections( const Vec3d* directions, const unsigned int count, Vec3d* result ) const
+{
+  Transform( *m_Values, directions, count, 0.0, result );
+}
+
+void
+Affine3d::Multiply( const Affine3d* left, const Affine3d* right, const unsigned int count, Affine3d* result )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_AFFINE3D_MULTIPLY, count );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    ::Multiply( *left[ i ].m_Values, *right[ i ].m_Values, *result[ i ].m_Values );
+}
+
+void
+Affine3d::Multiply( const Affine3d& left, const Affine3d* right, const unsigned int count, Affine3d* result )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_AFFINE3D_MULTIPLY, count );
+
+  /* left may be one of the results */
+  const Affine3d parent( left );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    ::Multiply( *parent.m_Values, *right[ i ].m_Values, *result[ i ].m_Values );
+}
+
+Affine3d
+Affine3d::operator *( const Affine3d& factor ) const
+{
+  Affine3d result;
+
+  ::Multiply( *m_Values, *factor.m_Values, *result.m_Values );
+
+  return result;
+}
+
+Affine3d&
+Affine3d::operator *=( const Affine3d& factor )
+{
+  ::Multiply( *m_Values, *factor.m_Values, *m_Values );
+
+  return *this;
+}
+
+bool
+Affine3d::operator ==( const Affine3d& expr ) const
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      if ( m_Values[ row ][ col ] != expr.m_Values[ row ][ col ] )
+        return false;
+
+  return true;
+}
+
+bool
+Affine3d::operator !=( const Affine3d& expr ) const
+{
+  return !( *this == expr );
+}
+
+double*
+Affine3d::operator []( const unsigned int row )
+{
+  return m_Values[ row ];
+}
+
+const double*
+Affine3d::operator []( const unsigned int row ) const
+{
+  return m_Values[ row ];
+}
+
+const double*
+Affine3d::Values( void ) const
+{
+  return *m_Values;
+}
+
+void
+Affine3d::Set( const unsigned int row, const unsigned int col, const double& value )
+{
+  m_Values[ row ][ col ] = value;
+}
+
+void
+Affine3d::Print( void ) const
+{
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ], m_Values[ 0 ][ 3 ] );
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ], m_Values[ 1 ][ 3 ] );
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ], m_Values[ 2 ][ 3 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,125 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Affine3d.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_AFFINE3D_HPP_
+#define MATH_AFFINE3D_HPP_
+
+class Vec3d;
+class Quaterniond;
+class Mat4d;
+class Affine3f;
+
+/*
+ * GeekEngine::Affine3d
+ *
+ * An affine transform stored as the first three rows of a 4x4 matrix,
+ * 12 doubles in row major order with the translation in the last column.
+ * The fourth row is always ( 0, 0, 0, 1 ) and neither stored nor
+ * multiplied, a product takes 36 multiplies instead of the 64 of Mat4d.
+ * There is no virtual destructor so an array stays packed at 96 bytes.
+ *
+ * Points and directions are column vectors, TransformPoint gives the xyz
+ * of Mat4d * ( x, y, z, 1 ) and a * b applies b first. A default
+ * constructed transform is the identity. Rotation and Scale decompose a
+ * rotation followed by a positive scale per axis, shear and mirroring are
+ * not recovered. The batch functions use AVX and run in parallel when
+ * compiled with OpenMP.
+ */
+class Affine3d
+{
+public:
+  Affine3d( void );
+  Affine3d( const Affine3d& affine );
+  explicit
+  Affine3d( const Affine3f& affine );
+  explicit
+  Affine3d( const Mat4d& matrix );
+  explicit
+  Affine3d( const double* values );
+  Affine3d( const Quaterniond& rotation, const Vec3d& translation );
+  Affine3d( const Quaterniond& rotation, const Vec3d& translation, const Vec3d& scale );
+  ~Affine3d( void );
+
+  Affine3d
+  Identity( void );
+  void
+  Set( const Quaterniond& rotation, const Vec3d& translation, const Vec3d& scale );
+
+  Mat4d
+  Matrix( void ) const;
+  Quaterniond
+  Rotation( void ) const;
+  Vec3d
+  Translation( void ) const;
+  Vec3d
+  Scale( void ) const;
+
+  Vec3d
+  TransformPoint( const Vec3d& point ) const;
+  Vec3d
+  TransformDirection( const Vec3d& direction ) const;
+  double
+  Determinant( void ) const;
+  Affine3d
+  Inverse( void ) const;
+
+  void
+  TransformPoints( const Vec3d* points, const unsigned int count, Vec3d* result ) const;
+  void
+  TransformDirections( const Vec3d* directions, const unsigned int count, Vec3d* result ) const;
+
+  static void
+  Multiply( const Affine3d* left, const Affine3d* right, const unsigned int count, Affine3d* result );
+  static void
+  Multiply( const Affine3d& left, const Affine3d* right, const unsigned int count, Affine3d* result );
+
+  Affine3d
+  operator *( const Affine3d& ) const;
+  Affine3d&
+  operator *=( const Affine3d& );
+
+  bool
+  operator ==( const Affine3d& expr ) const;
+  bool
+  operator !=( const Affine3d& expr ) const;
+
+  double*
+  operator []( const unsigned int );
+  const double*
+  operator []( const unsigned int ) const;
+
+  const double*
+  Values( void ) const;
+
+  void
+  Set( const unsigned int row, const unsigned int col, const double& );
+  void
+  Print( void ) const;
+
+protected:
+private:
+  double m_Values[ 3 ][ 4 ];
+
+};
+
+#endif /* MATH_AFFINE3D_HPP_ */
@@ -0,0 +1,476 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Affine3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Affine3f.hpp"
+#include "Profile.hpp"
+
+#include "Vec3f.hpp"
+#include "Quaternion.hpp"
+#include "Mat4f.hpp"
+#include "Affine3d.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+
+static const unsigned int AFFINE_SIZE = sizeof( float ) * 12;
+
+typedef char Affine3fPacked[ sizeof( Affine3f ) == 12 * sizeof( float ) ? 1 : -1 ];
+
+/* result = left * right on 12 row major floats each, result may alias either */
+static inline void
+Multiply( const float* left, const float* right, float* result )
+{
+#if defined( __SSE2__ )
+  const __m128 row0        = _mm_loadu_ps( right + 0 );
+  const __m128 row1        = _mm_loadu_ps( right + 4 );
+  const __m128 row2        = _mm_loadu_ps( right + 8 );
+  const __m128 translation = _mm_castsi128_ps( _mm_setr_epi32( 0, 0, 0, -1 ) );
+  __m128       rows[ 3 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+  {
+    const __m128 l = _mm_loadu_ps( left + row * 4 );
+
+    rows[ row ] = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( left[ row * 4 + 0 ] ), row0 ),
+                                                      _mm_mul_ps( _mm_set1_ps( left[ row * 4 + 1 ] ), row1 ) ),
+                                          _mm_mul_ps( _mm_set1_ps( left[ row * 4 + 2 ] ), row2 ) ),
+                              _mm_and_ps( l, translation ) );
+  }
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    _mm_storeu_ps( result + row * 4, rows[ row ] );
+#else
+  float values[ 12 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      values[ row * 4 + col ] = left[ row * 4 + 0 ] * right[ 0 * 4 + col ] +
+                                left[ row * 4 + 1 ] * right[ 1 * 4 + col ] +
+                                left[ row * 4 + 2 ] * right[ 2 * 4 + col ] +
+                                ( col == 3 ? left[ row * 4 + 3 ] : 0.0f );
+
+  memcpy( result, values, AFFINE_SIZE );
+#endif
+}
+
+/* w = 1 adds the translation, w = 0 leaves it out, result may alias vector */
+static inline void
+Transform( const float* m, const Vec3f& vector, const float w, Vec3f& result )
+{
+  const float x = vector.X();
+  const float y = vector.Y();
+  const float z = vector.Z();
+
+  result.Set( m[ 0 ] * x + m[ 1 ] * y + m[ 2 ]  * z + m[ 3 ]  * w,
+              m[ 4 ] * x + m[ 5 ] * y + m[ 6 ]  * z + m[ 7 ]  * w,
+              m[ 8 ] * x + m[ 9 ] * y + m[ 10 ] * z + m[ 11 ] * w );
+}
+
+static void
+Transform( const float* m, const Vec3f* vectors, const unsigned int count, const float w, Vec3f* result )
+{
+  const int blocks = ( count + 3 ) / 4;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * 4;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    if ( first + 4 <= count )
+    {
+      const Vec3f* v = vectors + first;
+      const __m128 x = _mm_setr_ps( v[ 0 ].X(), v[ 1 ].X(), v[ 2 ].X(), v[ 3 ].X() );
+      const __m128 y = _mm_setr_ps( v[ 0 ].Y(), v[ 1 ].Y(), v[ 2 ].Y(), v[ 3 ].Y() );
+      const __m128 z = _mm_setr_ps( v[ 0 ].Z(), v[ 1 ].Z(), v[ 2 ].Z(), v[ 3 ].Z() );
+      float        values[ 3 ][ 4 ];
+
+      for ( unsigned int row = 0; row < 3; row++ )
+      {
+        const float* r = m + row * 4;
+
+        _mm_storeu_ps( values[ row ],
+                       _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( r[ 0 ] ), x ),
+                                                           _mm_mul_ps( _mm_set1_ps( r[ 1 ] ), y ) ),
+                                               _mm_mul_ps( _mm_set1_ps( r[ 2 ] ), z ) ),
+                                   _mm_set1_ps( r[ 3 ] * w ) ) );
+      }
+
+      for ( unsigned int k = 0; k < 4; k++ )
+        result[ first + k ].Set( values[ 0 ][ k ], values[ 1 ][ k ], values[ 2 ][ k ] );
+
+      i += 4;
+    }
+#endif
+
+    for ( ; i < first + 4 && i < count; i++ )
+      Transform( m, vectors[ i ], w, result[ i ] );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Affine3f::Affine3f( void )
+{
+  Identity();
+}
+
+Affine3f::Affine3f( const Affine3f& affine )
+{
+  memcpy( m_Values, affine.m_Values, AFFINE_SIZE );
+}
+
+Affine3f::Affine3f( const Affine3d& affine )
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      m_Values[ row ][ col ] = (float)affine[ row ][ col ];
+}
+
+Affine3f::Affine3f( const Mat4f& matrix )
+{
+  memcpy( m_Values, matrix.Values(), AFFINE_SIZE );
+}
+
+Affine3f::Affine3f( const float* values )
+{
+  memcpy( m_Values, values, AFFINE_SIZE );
+}
+
+Affine3f::Affine3f( const Quaternion& rotation, const Vec3f& translation )
+{
+  Set( rotation, translation, Vec3f( 1.0f, 1.0f, 1.0f ) );
+}
+
+Affine3f::Affine3f( const Quaternion& rotation, const Vec3f& translation, const Vec3f& scale )
+{
+  Set( rotation, translation, scale );
+}
+
+Affine3f::~Affine3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Affine3f
+Affine3f::Identity( void )
+{
+  memset( m_Values, 0, AFFINE_SIZE );
+
+  m_Values[ 0 ][ 0 ] = 1.0f;
+  m_Values[ 1 ][ 1 ] = 1.0f;
+  m_Values[ 2 ][ 2 ] = 1.0f;
+
+  return *this;
+}
+
+void
+Affine3f::Set( const Quaternion& rotation, const Vec3f& translation, const Vec3f& scale )
+{
+  const float x = rotation.X();
+  const float y = rotation.Y();
+  const float z = rotation.Z();
+  const float w = rotation.W();
+
+  /* the rotation of Mat4f::Rotation( quaternion ), each column scaled */
+  m_Values[ 0 ][ 0 ] = ( 1.0f - 2.0f * ( y * y + z * z ) ) * scale.X();
+  m_Values[ 0 ][ 1 ] = (        2.0f * ( x * y - w * z ) ) * scale.Y();
+  m_Values[ 0 ][ 2 ] = (        2.0f * ( x * z + w * y ) ) * scale.Z();
+  m_Values[ 1 ][ 0 ] = (        2.0f * ( x * y + w * z ) ) * scale.X();
+  m_Values[ 1 ][ 1 ] = ( 1.0f - 2.0f * ( x * x + z * z ) ) * scale.Y();
+  m_Values[ 1 ][ 2 ] = (        2.0f * ( y * z - w * x ) ) * scale.Z();
+  m_Values[ 2 ][ 0 ] = (        2.0f * ( x * z - w * y ) ) * scale.X();
+  m_Values[ 2 ][ 1 ] = (        2.0f * ( y * z + w * x ) ) * scale.Y();
+  m_Values[ 2 ][ 2 ] = ( 1.0f - 2.0f * ( x * x + y * y ) ) * scale.Z();
+
+  m_Values[ 0 ][ 3 ] = translation.X();
+  m_Values[ 1 ][ 3 ] = translation.Y();
+  m_Values[ 2 ][ 3 ] = translation.Z();
+}
+
+Mat4f
+Affine3f::Matrix( void ) const
+{
+  Mat4f result;
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      result.Set( row, col, m_Values[ row ][ col ] );
+
+  result.Set( 3, 3, 1.0f );
+
+  return result;
+}
+
+Quaternion
+Affine3f::Rotation( void ) const
+{
+  const Vec3f scale = Scale();
+  float       m[ 3 ][ 3 ];
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 3; col++ )
+      m[ row ][ col ] = scale[ col ] != 0.0f ? m_Values[ row ][ col ] / scale[ col ] : 0.0f;
+
+  const float trace = m[ 0 ][ 0 ] + m[ 1 ][ 1 ] + m[ 2 ][ 2 ];
+  Quaternion  result;
+
+  if      ( trace > 0 )
+  {
+    const float s = 0.5f / sqrtf( trace + 1.0f );
+
+    result.Set( ( m[ 2 ][ 1 ] - m[ 1 ][ 2 ] ) * s, ( m[ 0 ][ 2 ] - m[ 2 ][ 0 ] ) * s,
+                ( m[ 1 ][ 0 ] - m[ 0 ][ 1 ] ) * s, 0.25f / s );
+  }
+  else if ( m[ 0 ][ 0 ] > m[ 1 ][ 1 ] && m[ 0 ][ 0 ] > m[ 2 ][ 2 ] )
+  {
+    const float s = 2.0f * sqrtf( 1.0f + m[ 0 ][ 0 ] - m[ 1 ][ 1 ] - m[ 2 ][ 2 ] );
+
+    result.Set( 0.25f * s, ( m[ 0 ][ 1 ] + m[ 1 ][ 0 ] ) / s,
+                ( m[ 0 ][ 2 ] + m[ 2 ][ 0 ] ) / s, ( m[ 2 ][ 1 ] - m[ 1 ][ 2 ] ) / s );
+  }
+  else if ( m[ 1 ][ 1 ] > m[ 2 ][ 2 ] )
+  {
+    const float s = 2.0f * sqrtf( 1.0f + m[ 1 ][ 1 ] - m[ 0 ][ 0 ] - m[ 2 ][ 2 ] );
+
+    result.Set( ( m[ 0 ][ 1 ] + m[ 1 ][ 0 ] ) / s, 0.25f * s,
+                ( m[ 1 ][ 2 ] + m[ 2 ][ 1 ] ) / s, ( m[ 0 ][ 2 ] - m[ 2 ][ 0 ] ) / s );
+  }
+  else
+  {
+    const float s = 2.0f * sqrtf( 1.0f + m[ 2 ][ 2 ] - m[ 0 ][ 0 ] - m[ 1 ][ 1 ] );
+
+    result.Set( ( m[ 0 ][ 2 ] + m[ 2 ][ 0 ] ) / s, ( m[ 1 ][ 2 ] + m[ 2 ][ 1 ] ) / s,
+                0.25f * s, ( m[ 1 ][ 0 ] - m[ 0 ][ 1 ] ) / s );
+  }
+
+  return result / sqrtf( result.LengthSq() );
+}
+
+Vec3f
+Affine3f::Translation( void ) const
+{
+  return Vec3f( m_Values[ 0 ][ 3 ], m_Values[ 1 ][ 3 ], m_Values[ 2 ][ 3 ] );
+}
+
+Vec3f
+Affine3f::Scale( void ) const
+{
+  const float ( *m )[ 4 ] = m_Values;
+
+  return Vec3f( sqrtf( m[ 0 ][ 0 ] * m[ 0 ][ 0 ] + m[ 1 ][ 0 ] * m[ 1 ][ 0 ] + m[ 2 ][ 0 ] * m[ 2 ][ 0 ] ),
+                sqrtf( m[ 0 ][ 1 ] * m[ 0 ][ 1 ] + m[ 1 ][ 1 ] * m[ 1 ][ 1 ] + m[ 2 ][ 1 ] * m[ 2 ][ 1 ] ),
+                sqrtf( m[ 0 ][ 2 ] * m[ 0 ][ 2 ] + m[ 1 ][ 2 ] * m[ 1 ][ 2 ] + m[ 2 ][ 2 ] * m[ 2 ][ 2 ] ) );
+}
+
+Vec3f
+Affine3f::TransformPoint( const Vec3f& point ) const
+{
+  Vec3f result;
+
+  Transform( *m_Values, point, 1.0f, result );
+
+  return result;
+}
+
+Vec3f
+Affine3f::TransformDirection( const Vec3f& direction ) const
+{
+  Vec3f result;
+
+  Transform( *m_Values, direction, 0.0f, result );
+
+  return result;
+}
+
+float
+Affine3f::Determinant( void ) const
+{
+  return m_Values[ 0 ][ 0 ] * ( m_Values[ 1 ][ 1 ] * m_Values[ 2 ][ 2 ] - m_Values[ 1 ][ 2 ] * m_Values[ 2 ][ 1 ] ) -
+         m_Values[ 0 ][ 1 ] * ( m_Values[ 1 ][ 0 ] * m_Values[ 2 ][ 2 ] - m_Values[ 1 ][ 2 ] * m_Values[ 2 ][ 0 ] ) +
+         m_Values[ 0 ][ 2 ] * ( m_Values[ 1 ][ 0 ] * m_Values[ 2 ][ 1 ] - m_Values[ 1 ][ 1 ] * m_Values[ 2 ][ 0 ] );
+}
+
+Affine3f
+Affine3f::Inverse( void ) const
+{
+  float det = Determinant();
+
+  if ( det == 0 ) return *this;
+
+  det = 1.0f / det;
+
+  const float ( *m )[ 4 ] = m_Values;
+  Affine3f    result;
+
+  result.m_Values[ 0 ][ 0 ] = ( m[ 1 ][ 1 ] * m[ 2 ][ 2 ] - m[ 1 ][ 2 ] * m[ 2 ][ 1 ] ) * det;
+  result.m_Values[ 0 ][ 1 ] = ( m[ 0 ][ 2 ] * m[ 2 ][ 1 ] - m[ 0 ][ 1 ] * m[ 2 ][ 2 ] ) * det;
+  result.m_Values[ 0 ][ 2 ] = ( m[ 0 ][ 1 ] * m[ 1 ][ 2 ] - m[ 0 ][ 2 ] * m[ 1 ][ 1 ] ) * det;
+  result.m_Values[ 1 ][ 0 ] = ( m[ 1 ][ 2 ] * m[ 2 ][ 0 ] - m[ 1 ][ 0 ] * m[ 2 ][ 2 ] ) * det;
+  result.m_Values[ 1 ][ 1 ] = ( m[ 0 ][ 0 ] * m[ 2 ][ 2 ] - m[ 0 ][ 2 ] * m[ 2 ][ 0 ] ) * det;
+  result.m_Values[ 1 ][ 2 ] = ( m[ 0 ][ 2 ] * m[ 1 ][ 0 ] - m[ 0 ][ 0 ] * m[ 1 ][ 2 ] ) * det;
+  result.m_Values[ 2 ][ 0 ] = ( m[ 1 ][ 0 ] * m[ 2 ][ 1 ] - m[ 1 ][ 1 ] * m[ 2 ][ 0 ] ) * det;
+  result.m_Values[ 2 ][ 1 ] = ( m[ 0 ][ 1 ] * m[ 2 ][ 0 ] - m[ 0 ][ 0 ] * m[ 2 ][ 1 ] ) * det;
+  result.m_Values[ 2 ][ 2 ] = ( m[ 0 ][ 0 ] * m[ 1 ][ 1 ] - m[ 0 ][ 1 ] * m[ 1 ][ 0 ] ) * det;
+
+  /* the inverse translation is -R^-1 * t */
+  for ( unsigned int row = 0; row < 3; row++ )
+    result.m_Values[ row ][ 3 ] = -( result.m_Values[ row ][ 0 ] * m[ 0 ][ 3 ] +
+                                     result.m_Values[ row ][ 1 ] * m[ 1 ][ 3 ] +
+                                     result.m_Values[ row ][ 2 ] * m[ 2 ][ 3 ] );
+
+  return result;
+}
+
+void
+Affine3f::TransformPoints( const Vec3f* points, const unsigned int count, Vec3f* result ) const
+{
+  Transform( *m_Values, points, count, 1.0f, result );
+}
+
+void
+Affine3f::TransformDirections( const Vec3f* directions, const unsigned int count, Vec3f* result ) const
+{
+  Transform( *m_Values, directions, count, 0.0f, result );
+}
+
+void
+Affine3f::Multiply( const Affine3f* left, const Affine3f* right, const unsigned int count, Affine3f* result )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_AFFINE3F_MULTIPLY, count );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    ::Multiply( *left[ i ].m_Values, *right[ i ].m_Values, *result[ i ].m_Values );
+}
+
+void
+Affine3f::Multiply( const Affine3f& left, const Affine3f* right, const unsigned int count, Affine3f* result )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_AFFINE3F_MULTIPLY, count );
+
+  /* left may be one of the results */
+  const Affine3f parent( left );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    ::Multiply( *parent.m_Values, *right[ i ].m_Values, *result[ i ].m_Values );
+}
+
+Affine3f
+Affine3f::operator *( const Affine3f& factor ) const
+{
+  Affine3f result;
+
+  ::Multiply( *m_Values, *factor.m_Values, *result.m_Values );
+
+  return result;
+}
+
+Affine3f&
+Affine3f::operator *=( const Affine3f& factor )
+{
+  ::Multiply( *m_Values, *factor.m_Values, *m_Values );
+
+  return *this;
+}
+
+bool
+Affine3f::operator ==( const Affine3f& expr ) const
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      if ( m_Values[ row ][ col ] != expr.m_Values[ row ][ col ] )
+        return false;
+
+  return true;
+}
+
+bool
+Affine3f::operator !=( const Affine3f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float*
+Affine3f::operator []( const unsigned int row )
+{
+  return m_Values[ row ];
+}
+
+const float*
+Affine3f::operator []( const unsigned int row ) const
+{
+  return m_Values[ row ];
+}
+
+const float*
+Affine3f::Values( void ) const
+{
+  return *m_Values;
+}
+
+void
+Affine3f::Set( const unsigned int row, const unsigned int col, const float& value )
+{
+  m_Values[ row ][ col ] = value;
+}
+
+void
+Affine3f::Print( void ) const
+{
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ], m_Values[ 0 ][ 3 ] );
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ], m_Values[ 1 ][ 3 ] );
+  printf( "( %f | %f | %f | %f )\n", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ], m_Values[ 2 ][ 3 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,126 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Affine3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_AFFINE3F_HPP_
+#define MATH_AFFINE3F_HPP_
+
+class Vec3f;
+class Quaternion;
+class Mat4f;
+class Affine3d;
+
+/*
+ * GeekEngine::Affine3f
+ *
+ * An affine transform stored as the first three rows of a 4x4 matrix,
+ * 12 floats in row major order with the translation in the last column.
+ * The fourth row is always ( 0, 0, 0, 1 ) and neither stored nor
+ * multiplied, a product takes 36 multiplies instead of the 64 of Mat4f.
+ * There is no virtual destructor so an array stays packed at 48 bytes
+ * and matches UPLOAD_ROW_MAJOR_3X4.
+ *
+ * Points and directions are column vectors, TransformPoint gives the xyz
+ * of Mat4f * ( x, y, z, 1 ) and a * b applies b first. A default
+ * constructed transform is the identity. Rotation and Scale decompose a
+ * rotation followed by a positive scale per axis, shear and mirroring are
+ * not recovered. The batch functions use SSE2 and run in parallel when
+ * compiled with OpenMP.
+ */
+class Affine3f
+{
+public:
+  Affine3f( void );
+  Affine3f( const Affine3f& affine );
+  explicit
+  Affine3f( const Affine3d& affine );
+  explicit
+  Affine3f( const Mat4f& matrix );
+  explicit
+  Affine3f( const float* values );
+  Affine3f( const Quaternion& rotation, const Vec3f& translation );
+  Affine3f( const Quaternion& rotation, const Vec3f& translation, const Vec3f& scale );
+  ~Affine3f( void );
+
+  Affine3f
+  Identity( void );
+  void
+  Set( const Quaternion& rotation, const Vec3f& translation, const Vec3f& scale );
+
+  Mat4f
+  Matrix( void ) const;
+  Quaternion
+  Rotation( void ) const;
+  Vec3f
+  Translation( void ) const;
+  Vec3f
+  Scale( void ) const;
+
+  Vec3f
+  TransformPoint( const Vec3f& point ) const;
+  Vec3f
+  TransformDirection( const Vec3f& direction ) const;
+  float
+  Determinant( void ) const;
+  Affine3f
+  Inverse( void ) const;
+
+  void
+  TransformPoints( const Vec3f* points, const unsigned int count, Vec3f* result ) const;
+  void
+  TransformDirections( const Vec3f* directions, const unsigned int count, Vec3f* result ) const;
+
+  static void
+  Multiply( const Affine3f* left, const Affine3f* right, const unsigned int count, Affine3f* result );
+  static void
+  Multiply( const Affine3f& left, const Affine3f* right, const unsigned int count, Affine3f* result );
+
+  Affine3f
+  operator *( const Affine3f& ) const;
+  Affine3f&
+  operator *=( const Affine3f& );
+
+  bool
+  operator ==( const Affine3f& expr ) const;
+  bool
+  operator !=( const Affine3f& expr ) const;
+
+  float*
+  operator []( const unsigned int );
+  const float*
+  operator []( const unsigned int ) const;
+
+  const float*
+  Values( void ) const;
+
+  void
+  Set( const unsigned int row, const unsigned int col, const float& );
+  void
+  Print( void ) const;
+
+protected:
+private:
+  float m_Values[ 3 ][ 4 ];
+
+};
+
+#endif /* MATH_AFFINE3F_HPP_ */
@@ -0,0 +1,167 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Archive.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Archive.hpp"
+
+#include <cstring>
+
+/*
+ * The tens of a tag select the stored scalar.
+ */
+static const unsigned int SCALAR_SIZES[ 4 ] = { 4, 8, 4, 2 };
+
+/*
+ * CRC-32 of the polynomial 0xEDB88320 a nibble at a time, a constant table
+ * small enough to need no initialization.
+ */
+static const unsigned int CRC_NIBBLES[ 16 ] =
+{
+  0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+  0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+  0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+  0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Archive::Archive( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+Archive::Components( const unsigned int type )
+{
+  switch ( type )
+  {
+    case ARCHIVE_FLOAT:
+    case ARCHIVE_DOUBLE:
+      return 1;
+    case ARCHIVE_VEC2F:
+    case ARCHIVE_VEC2D:
+    case ARCHIVE_VEC2I:
+    case ARCHIVE_VEC2H:
+      return 2;
+    case ARCHIVE_VEC3F:
+    case ARCHIVE_VEC3D:
+    case ARCHIVE_VEC3I:
+    case ARCHIVE_VEC3H:
+      return 3;
+    case ARCHIVE_VEC4F:
+    case ARCHIVE_QUATERNION:
+    case ARCHIVE_AABB2F:
+    case ARCHIVE_VEC4D:
+    case ARCHIVE_QUATERNIOND:
+    case ARCHIVE_VEC4H:
+    case ARCHIVE_QUATERNIONH:
+      return 4;
+    case ARCHIVE_AABB3F:
+    case ARCHIVE_RAY3F:
+    case ARCHIVE_AABB3D:
+    case ARCHIVE_RAY3D:
+      return 6;
+    case ARCHIVE_MAT3F:
+    case ARCHIVE_MAT3D:
+    case ARCHIVE_MAT3I:
+      return 9;
+    case ARCHIVE_AFFINE3F:
+    case ARCHIVE_AFFINE3D:
+      return 12;
+    case ARCHIVE_MAT4F:
+    case ARCHIVE_MAT4D:
+    case ARCHIVE_MAT4I:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+unsigned int
+Archive::ElementSize( const unsigned int type )
+{
+  return Components( type ) * SCALAR_SIZES[ ( type / 20 ) & 3 ];
+}
+
+unsigned int
+Archive::Checksum( const void* data, const unsigned int size, const unsigned int crc )
+{
+  const unsigned char* bytes = static_cast< const unsigned char* >( data );
+  unsigned int         c     = ~crc;
+
+  for ( unsigned int i = 0; i < size; i++ )
+  {
+    c = CRC_NIBBLES[ ( c ^ bytes[ i ] ) & 15 ] ^ ( c >> 4 );
+    c = CRC_NIBBLES[ ( c ^ ( bytes[ i ] >> 4 ) ) & 15 ] ^ ( c >> 4 );
+  }
+
+  return ~c;
+}
+
+bool
+Archive::LittleEndian( void )
+{
+  const unsigned int one = 1;
+
+  return *reinterpret_cast< const unsigned char* >( &one ) == 1;
+}
+
+void
+Archive::Encode( const void* value, const unsigned int size, unsigned char* target )
+{
+  const unsigned char* bytes = static_cast< const unsigned char* >( value );
+
+  if ( LittleEndian() )
+    memcpy( target, bytes, size );
+  else
+    for ( unsigned int i = 0; i < size; i++ )
+      target[ i ] = bytes[ size - 1 - i ];
+}
+
+void
+Archive::Decode( const unsigned char* source, const unsigned int size, void* value )
+{
+  unsigned char* bytes = static_cast< unsigned char* >( value );
+
+  if ( LittleEndian() )
+    memcpy( bytes, source, size );
+  else
+    for ( unsigned int i = 0; i < size; i++ )
+      bytes[ i ] = source[ size - 1 - i ];
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,126 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Archive.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_ARCHIVE_HPP_
+#define MATH_ARCHIVE_HPP_
+
+/*
+ * Chunk type tags. The values are part of the file format and never change,
+ * the tens give the stored scalar: 0 float, 1 double, 2 int, 3 half.
+ */
+enum ArchiveType
+{
+  ARCHIVE_FLOAT       = 1,
+  ARCHIVE_VEC2F       = 2,
+  ARCHIVE_VEC3F       = 3,
+  ARCHIVE_VEC4F       = 4,
+  ARCHIVE_QUATERNION  = 5,
+  ARCHIVE_MAT3F       = 6,
+  ARCHIVE_MAT4F       = 7,
+  ARCHIVE_AABB2F      = 8,
+  ARCHIVE_AABB3F      = 9,
+  ARCHIVE_RAY3F       = 10,
+  ARCHIVE_AFFINE3F    = 11,
+
+  ARCHIVE_DOUBLE      = 21,
+  ARCHIVE_VEC2D       = 22,
+  ARCHIVE_VEC3D       = 23,
+  ARCHIVE_VEC4D       = 24,
+  ARCHIVE_QUATERNIOND = 25,
+  ARCHIVE_MAT3D       = 26,
+  ARCHIVE_MAT4D       = 27,
+  ARCHIVE_AABB3D      = 29,
+  ARCHIVE_RAY3D       = 30,
+  ARCHIVE_AFFINE3D    = 31,
+
+  ARCHIVE_VEC2I       = 42,
+  ARCHIVE_VEC3I       = 43,
+  ARCHIVE_MAT3I       = 46,
+  ARCHIVE_MAT4I       = 47,
+
+  ARCHIVE_VEC2H       = 62,
+  ARCHIVE_VEC3H       = 63,
+  ARCHIVE_VEC4H       = 64,
+  ARCHIVE_QUATERNIONH = 65
+};
+
+/*
+ * Fixed sizes of the format in bytes.
+ */
+enum ArchiveLayout
+{
+  ARCHIVE_VERSION   = 1,
+  ARCHIVE_ALIGNMENT = 64,
+  ARCHIVE_HEADER    = 64,
+  ARCHIVE_ENTRY     = 64,
+  ARCHIVE_NAME      = 48
+};
+
+/*
+ * GeekEngine::Archive
+ *
+ * Binary container for arrays of GeekMath types, written by ArchiveWriter
+ * and read in place by ArchiveReader. All fields are little endian 32 bit
+ * unsigned integers:
+ *
+ *   header    magic "GMAR", version, chunk count, total size, CRC-32 of
+ *             everything after the header, zero padding to 64 bytes
+ *   table     one 64 byte entry per chunk: type, element count, payload
+ *             offset, payload size, NUL terminated name of up to 47 chars
+ *   payloads  components of each element packed in their member order,
+ *             every payload starting on a 64 byte boundary
+ *
+ * Payloads hold only the values, without the vtable pointers or padding of
+ * the in-memory types, so they can be uploaded or mapped directly. Vec4d
+ * is stored as four doubles although it computes in float.
+ *
+ * Components and ElementSize give the scalars and bytes per element of a
+ * type tag, 0 for unknown tags. Checksum continues a CRC-32 (IEEE) over
+ * size bytes from crc, start with 0. Encode and Decode copy one scalar of
+ * size bytes between native and little endian order; only on little endian
+ * hosts can payloads be used in place.
+ */
+class Archive
+{
+public:
+  static unsigned int
+  Components( const unsigned int type );
+  static unsigned int
+  ElementSize( const unsigned int type );
+  static unsigned int
+  Checksum( const void* data, const unsigned int size, const unsigned int crc = 0 );
+
+  static bool
+  LittleEndian( void );
+  static void
+  Encode( const void* value, const unsigned int size, unsigned char* target );
+  static void
+  Decode( const unsigned char* source, const unsigned int size, void* value );
+
+protected:
+private:
+  Archive( void );
+
+};
+
+#endif /* MATH_ARCHIVE_HPP_ */
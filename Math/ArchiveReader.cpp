@@ -0,0 +1,678 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ArchiveReader.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ArchiveReader.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Vec4f.hpp"
+#include "Quaternion.hpp"
+#include "Mat3f.hpp"
+#include "Mat4f.hpp"
+#include "Aabb2f.hpp"
+#include "Aabb3f.hpp"
+#include "Ray3f.hpp"
+#include "Affine3f.hpp"
+#include "Vec2d.hpp"
+#include "Vec3d.hpp"
+#include "Vec4d.hpp"
+#include "Quaterniond.hpp"
+#include "Mat3d.hpp"
+#include "Mat4d.hpp"
+#include "Aabb3d.hpp"
+#include "Ray3d.hpp"
+#include "Affine3d.hpp"
+#include "Vec2i.hpp"
+#include "Vec3i.hpp"
+#include "Mat3i.hpp"
+#include "Mat4i.hpp"
+#include "Vec2h.hpp"
+#include "Vec3h.hpp"
+#include "Vec4h.hpp"
+#include "Quaternionh.hpp"
+
+#include <cstring>
+
+/*
+ * Component pointers of every archived type, in member order.
+ */
+static inline float*
+Data( float& value )
+{
+  return &value;
+}
+
+static inline double*
+Data( double& value )
+{
+  return &value;
+}
+
+static inline float*
+Data( Vec2f& value )
+{
+  return &value[ 0 ];
+}
+
+static inline float*
+Data( Vec3f& value )
+{
+  return &value[ 0 ];
+}
+
+static inline float*
+Data( Vec4f& value )
+{
+  return &value[ 0 ];
+}
+
+static inline float*
+Data( Quaternion& value )
+{
+  return &value[ 0 ];
+}
+
+static inline float*
+Data( Mat3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline float*
+Data( Mat4f& value )
+{
+  return value[ 0 ];
+}
+
+static inline float*
+Data( Aabb2f& value )
+{
+  return value[ 0 ];
+}
+
+static inline float*
+Data( Aabb3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline float*
+Data( Ray3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline float*
+Data( Affine3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline double*
+Data( Vec2d& value )
+{
+  return &value[ 0 ];
+}
+
+static inline double*
+Data( Vec3d& value )
+{
+  return &value[ 0 ];
+}
+
+static inline float*
+Data( Vec4d& value )
+{
+  return &value[ 0 ];
+}
+
+static inline double*
+Data( Quaterniond& value )
+{
+  return &value[ 0 ];
+}
+
+static inline double*
+Data( Mat3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline double*
+Data( Mat4d& value )
+{
+  return value[ 0 ];
+}
+
+static inline double*
+Data( Aabb3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline double*
+Data( Ray3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline double*
+Data( Affine3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline int*
+Data( Vec2i& value )
+{
+  return &value[ 0 ];
+}
+
+static inline int*
+Data( Vec3i& value )
+{
+  return &value[ 0 ];
+}
+
+static inline int*
+Data( Mat3i& value )
+{
+  return value[ 0 ];
+}
+
+static inline int*
+Data( Mat4i& value )
+{
+  return value[ 0 ];
+}
+
+static inline unsigned short*
+Data( Vec2h& value )
+{
+  return &value[ 0 ];
+}
+
+static inline unsigned short*
+Data( Vec3h& value )
+{
+  return &value[ 0 ];
+}
+
+static inline unsigned short*
+Data( Vec4h& value )
+{
+  return &value[ 0 ];
+}
+
+static inline unsigned short*
+Data( Quaternionh& value )
+{
+  return &value[ 0 ];
+}
+
+template< class Stored, class Target >
+static inline const unsigned char*
+Unpack( const unsigned char* source, const unsigned int components, Target* target )
+{
+  for ( unsigned int i = 0; i < components; i++ )
+  {
+    Stored value;
+
+    Archive::Decode( source, sizeof( Stored ), &value );
+    target[ i ] = static_cast< Target >( value );
+    source += sizeof( Stored );
+  }
+
+  return source;
+}
+
+template< class Stored, class Value >
+static bool
+UnpackAll( const unsigned char* source, const unsigned int count, const unsigned int type, Value* values )
+{
+  if ( source == NULL )
+    return false;
+
+  const unsigned int components = Archive::Components( type );
+
+  for ( unsigned int i = 0; i < count; i++ )
+    source = Unpack< Stored >( source, components, Data( values[ i ] ) );
+
+  return true;
+}
+
+static inline unsigned int
+Load( const unsigned char* source )
+{
+  unsigned int value;
+
+  Archive::Decode( source, 4, &value );
+
+  return value;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ArchiveReader::ArchiveReader( void )
+  : m_Data( NULL ), m_Size( 0 ), m_Chunks( 0 )
+{
+  return;
+}
+
+ArchiveReader::~ArchiveReader( void )
+{
+  return;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+bool
+ArchiveReader::Open( const void* data, const unsigned int size, const bool verify )
+{
+  const unsigned char* bytes = static_cast< const unsigned char* >( data );
+
+  Close();
+
+  if ( bytes == NULL || size < ARCHIVE_HEADER || memcmp( bytes, "GMAR", 4 ) != 0 ||
+       Load( bytes + 4 ) != ARCHIVE_VERSION )
+    return false;
+
+  const unsigned int chunks = Load( bytes + 8 );
+  const unsigned int total  = Load( bytes + 12 );
+
+  if ( total < ARCHIVE_HEADER || total > size || chunks > ( total - ARCHIVE_HEADER ) / ARCHIVE_ENTRY )
+    return false;
+
+  const unsigned int base = ARCHIVE_HEADER + chunks * ARCHIVE_ENTRY;
+
+  for ( unsigned int i = 0; i < chunks; i++ )
+  {
+    const unsigned char* entry   = bytes + ARCHIVE_HEADER + i * ARCHIVE_ENTRY;
+    const unsigned int   element = Archive::ElementSize( Load( entry ) );
+    const unsigned int   count   = Load( entry + 4 );
+    const unsigned int   offset  = Load( entry + 8 );
+    const unsigned int   payload = Load( entry + 12 );
+
+    if ( element == 0 || count > 0xFFFFFFFFu / element || payload != count * element ||
+         offset % ARCHIVE_ALIGNMENT != 0 || offset < base || offset > total ||
+         payload > total - offset || entry[ 16 + ARCHIVE_NAME - 1 ] != 0 )
+      return false;
+  }
+
+  m_Data   = bytes;
+  m_Size   = total;
+  m_Chunks = chunks;
+
+  if ( verify && !Verify() )
+  {
+    Close();
+
+    return false;
+  }
+
+  return true;
+}
+
+bool
+ArchiveReader::Verify( void ) const
+{
+  return m_Data != NULL &&
+         Archive::Checksum( m_Data + ARCHIVE_HEADER, m_Size - ARCHIVE_HEADER ) == Load( m_Data + 16 );
+}
+
+void
+ArchiveReader::Close( void )
+{
+  m_Data   = NULL;
+  m_Size   = 0;
+  m_Chunks = 0;
+}
+
+unsigned int
+ArchiveReader::Chunks( void ) const
+{
+  return m_Chunks;
+}
+
+int
+ArchiveReader::Find( const char* name ) const
+{
+  for ( unsigned int i = 0; i < m_Chunks; i++ )
+    if ( strncmp( Name( i ), name, ARCHIVE_NAME ) == 0 )
+      return i;
+
+  return -1;
+}
+
+const char*
+ArchiveReader::Name( const unsigned int chunk ) const
+{
+  const unsigned char* entry = Entry( chunk );
+
+  return entry != NULL ? reinterpret_cast< const char* >( entry + 16 ) : NULL;
+}
+
+unsigned int
+ArchiveReader::Type( const unsigned int chunk ) const
+{
+  const unsigned char* entry = Entry( chunk );
+
+  return entry != NULL ? Load( entry ) : 0;
+}
+
+unsigned int
+ArchiveReader::Count( const unsigned int chunk ) const
+{
+  const unsigned char* entry = Entry( chunk );
+
+  return entry != NULL ? Load( entry + 4 ) : 0;
+}
+
+const void*
+ArchiveReader::Data( const unsigned int chunk ) const
+{
+  return Payload( chunk, Type( chunk ) );
+}
+
+Mat4fConstSpan
+ArchiveReader::Matrices( const unsigned int chunk ) const
+{
+  const float* values = reinterpret_cast< const float* >( InPlace( chunk, ARCHIVE_MAT4F, sizeof( float ) ) );
+
+  return values != NULL ? Mat4fConstSpan( values, Count( chunk ) ) : Mat4fConstSpan( NULL, 0 );
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const float*& values ) const
+{
+  values = reinterpret_cast< const float* >( InPlace( chunk, ARCHIVE_FLOAT, sizeof( float ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Affine3f*& values ) const
+{
+  values = reinterpret_cast< const Affine3f* >( InPlace( chunk, ARCHIVE_AFFINE3F, sizeof( float ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Affine3d*& values ) const
+{
+  values = reinterpret_cast< const Affine3d* >( InPlace( chunk, ARCHIVE_AFFINE3D, sizeof( double ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Vec2h*& values ) const
+{
+  values = reinterpret_cast< const Vec2h* >( InPlace( chunk, ARCHIVE_VEC2H, sizeof( unsigned short ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Vec3h*& values ) const
+{
+  values = reinterpret_cast< const Vec3h* >( InPlace( chunk, ARCHIVE_VEC3H, sizeof( unsigned short ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Vec4h*& values ) const
+{
+  values = reinterpret_cast< const Vec4h* >( InPlace( chunk, ARCHIVE_VEC4H, sizeof( unsigned short ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::View( const unsigned int chunk, const Quaternionh*& values ) const
+{
+  values = reinterpret_cast< const Quaternionh* >( InPlace( chunk, ARCHIVE_QUATERNIONH, sizeof( unsigned short ) ) );
+
+  return values != NULL;
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, float* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_FLOAT ), Count( chunk ), ARCHIVE_FLOAT, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec2f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_VEC2F ), Count( chunk ), ARCHIVE_VEC2F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec3f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_VEC3F ), Count( chunk ), ARCHIVE_VEC3F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec4f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_VEC4F ), Count( chunk ), ARCHIVE_VEC4F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Quaternion* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_QUATERNION ), Count( chunk ), ARCHIVE_QUATERNION, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat3f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_MAT3F ), Count( chunk ), ARCHIVE_MAT3F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat4f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_MAT4F ), Count( chunk ), ARCHIVE_MAT4F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Aabb2f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_AABB2F ), Count( chunk ), ARCHIVE_AABB2F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Aabb3f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_AABB3F ), Count( chunk ), ARCHIVE_AABB3F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Ray3f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_RAY3F ), Count( chunk ), ARCHIVE_RAY3F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Affine3f* values ) const
+{
+  return UnpackAll< float >( Payload( chunk, ARCHIVE_AFFINE3F ), Count( chunk ), ARCHIVE_AFFINE3F, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, double* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_DOUBLE ), Count( chunk ), ARCHIVE_DOUBLE, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec2d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_VEC2D ), Count( chunk ), ARCHIVE_VEC2D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec3d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_VEC3D ), Count( chunk ), ARCHIVE_VEC3D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec4d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_VEC4D ), Count( chunk ), ARCHIVE_VEC4D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Quaterniond* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_QUATERNIOND ), Count( chunk ), ARCHIVE_QUATERNIOND, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat3d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_MAT3D ), Count( chunk ), ARCHIVE_MAT3D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat4d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_MAT4D ), Count( chunk ), ARCHIVE_MAT4D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Aabb3d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_AABB3D ), Count( chunk ), ARCHIVE_AABB3D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Ray3d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_RAY3D ), Count( chunk ), ARCHIVE_RAY3D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Affine3d* values ) const
+{
+  return UnpackAll< double >( Payload( chunk, ARCHIVE_AFFINE3D ), Count( chunk ), ARCHIVE_AFFINE3D, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec2i* values ) const
+{
+  return UnpackAll< int >( Payload( chunk, ARCHIVE_VEC2I ), Count( chunk ), ARCHIVE_VEC2I, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec3i* values ) const
+{
+  return UnpackAll< int >( Payload( chunk, ARCHIVE_VEC3I ), Count( chunk ), ARCHIVE_VEC3I, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat3i* values ) const
+{
+  return UnpackAll< int >( Payload( chunk, ARCHIVE_MAT3I ), Count( chunk ), ARCHIVE_MAT3I, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Mat4i* values ) const
+{
+  return UnpackAll< int >( Payload( chunk, ARCHIVE_MAT4I ), Count( chunk ), ARCHIVE_MAT4I, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec2h* values ) const
+{
+  return UnpackAll< unsigned short >( Payload( chunk, ARCHIVE_VEC2H ), Count( chunk ), ARCHIVE_VEC2H, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec3h* values ) const
+{
+  return UnpackAll< unsigned short >( Payload( chunk, ARCHIVE_VEC3H ), Count( chunk ), ARCHIVE_VEC3H, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Vec4h* values ) const
+{
+  return UnpackAll< unsigned short >( Payload( chunk, ARCHIVE_VEC4H ), Count( chunk ), ARCHIVE_VEC4H, values );
+}
+
+bool
+ArchiveReader::Get( const unsigned int chunk, Quaternionh* values ) const
+{
+  return UnpackAll< unsigned short >( Payload( chunk, ARCHIVE_QUATERNIONH ), Count( chunk ), ARCHIVE_QUATERNIONH, values );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+const unsigned char*
+ArchiveReader::Entry( const unsigned int chunk ) const
+{
+  return chunk < m_Chunks ? m_Data + ARCHIVE_HEADER + chunk * ARCHIVE_ENTRY : NULL;
+}
+
+const unsigned char*
+ArchiveReader::Payload( const unsigned int chunk, const unsigned int type ) const
+{
+  const unsigned char* entry = Entry( chunk );
+
+  if ( entry == NULL || Load( entry ) != type )
+    return NULL;
+
+  return m_Data + Load( entry + 8 );
+}
+
+const unsigned char*
+ArchiveReader::InPlace( const unsigned int chunk, const unsigned int type, const unsigned int alignment ) const
+{
+  const unsigned char* payload = Payload( chunk, type );
+
+  if ( payload == NULL || !Archive::LittleEndian() || (unsigned long)payload % alignment != 0 )
+    return NULL;
+
+  return payload;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
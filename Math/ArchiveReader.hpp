@@ -0,0 +1,198 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ArchiveReader.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_ARCHIVEREADER_HPP_
+#define MATH_ARCHIVEREADER_HPP_
+
+#include "Archive.hpp"
+#include "Mat4fConstSpan.hpp"
+
+class Vec2f;
+class Vec3f;
+class Vec4f;
+class Quaternion;
+class Mat3f;
+class Mat4f;
+class Aabb2f;
+class Aabb3f;
+class Ray3f;
+class Affine3f;
+class Vec2d;
+class Vec3d;
+class Vec4d;
+class Quaterniond;
+class Mat3d;
+class Mat4d;
+class Aabb3d;
+class Ray3d;
+class Affine3d;
+class Vec2i;
+class Vec3i;
+class Mat3i;
+class Mat4i;
+class Vec2h;
+class Vec3h;
+class Vec4h;
+class Quaternionh;
+
+/*
+ * GeekEngine::ArchiveReader
+ *
+ * Reads an Archive image in place, typically a file the caller mapped
+ * into memory, read only mappings included. Open checks the header,
+ * version, size and every table entry against size, which touches the
+ * table only, so opening a large mapping does not page in its payloads.
+ * With verify, or a later call to Verify, the checksum is compared as
+ * well, which reads the whole image once. Nothing is copied, the reader
+ * keeps pointing into data until Close or the next Open.
+ *
+ * Find returns the index of the first chunk with the given name or -1.
+ * Data returns the raw little endian payload of a chunk. Matrices, and
+ * View for the types without virtual table, alias the payload read only,
+ * Matrices and View require a chunk of exactly that type, a little endian
+ * host and payloads aligned for their scalar, which holds for 64 byte
+ * aligned data such as mapped files. The payload of a Vec3f chunk can be
+ * used in place through Vec3fConstRef. Get copies a chunk into count
+ * values of the matching type on any host. All fail with an empty span,
+ * false or NULL when the chunk is missing or of another type.
+ */
+class ArchiveReader
+{
+public:
+  ArchiveReader( void );
+  virtual
+  ~ArchiveReader( void );
+
+  bool
+  Open( const void* data, const unsigned int size, const bool verify = false );
+  bool
+  Verify( void ) const;
+  void
+  Close( void );
+
+  unsigned int
+  Chunks( void ) const;
+  int
+  Find( const char* name ) const;
+  const char*
+  Name( const unsigned int chunk ) const;
+  unsigned int
+  Type( const unsigned int chunk ) const;
+  unsigned int
+  Count( const unsigned int chunk ) const;
+  const void*
+  Data( const unsigned int chunk ) const;
+
+  Mat4fConstSpan
+  Matrices( const unsigned int chunk ) const;
+  bool
+  View( const unsigned int chunk, const float*& values ) const;
+  bool
+  View( const unsigned int chunk, const Affine3f*& values ) const;
+  bool
+  View( const unsigned int chunk, const Affine3d*& values ) const;
+  bool
+  View( const unsigned int chunk, const Vec2h*& values ) const;
+  bool
+  View( const unsigned int chunk, const Vec3h*& values ) const;
+  bool
+  View( const unsigned int chunk, const Vec4h*& values ) const;
+  bool
+  View( const unsigned int chunk, const Quaternionh*& values ) const;
+
+  bool
+  Get( const unsigned int chunk, float* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec2f* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec3f* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec4f* values ) const;
+  bool
+  Get( const unsigned int chunk, Quaternion* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat3f* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat4f* values ) const;
+  bool
+  Get( const unsigned int chunk, Aabb2f* values ) const;
+  bool
+  Get( const unsigned int chunk, Aabb3f* values ) const;
+  bool
+  Get( const unsigned int chunk, Ray3f* values ) const;
+  bool
+  Get( const unsigned int chunk, Affine3f* values ) const;
+  bool
+  Get( const unsigned int chunk, double* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec2d* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec3d* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec4d* values ) const;
+  bool
+  Get( const unsigned int chunk, Quaterniond* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat3d* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat4d* values ) const;
+  bool
+  Get( const unsigned int chunk, Aabb3d* values ) const;
+  bool
+  Get( const unsigned int chunk, Ray3d* values ) const;
+  bool
+  Get( const unsigned int chunk, Affine3d* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec2i* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec3i* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat3i* values ) const;
+  bool
+  Get( const unsigned int chunk, Mat4i* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec2h* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec3h* values ) const;
+  bool
+  Get( const unsigned int chunk, Vec4h* values ) const;
+  bool
+  Get( const unsigned int chunk, Quaternionh* values ) const;
+
+protected:
+  const unsigned char*
+  Entry( const unsigned int chunk ) const;
+  const unsigned char*
+  Payload( const unsigned int chunk, const unsigned int type ) const;
+  const unsigned char*
+  InPlace( const unsigned int chunk, const unsigned int type, const unsigned int alignment ) const;
+
+  const unsigned char* m_Data;
+  unsigned int         m_Size;
+  unsigned int         m_Chunks;
+
+private:
+
+};
+
+#endif /* MATH_ARCHIVEREADER_HPP_ */
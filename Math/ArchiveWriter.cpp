@@ -0,0 +1,606 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ArchiveWriter.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ArchiveWriter.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Vec4f.hpp"
+#include "Quaternion.hpp"
+#include "Mat3f.hpp"
+#include "Mat4f.hpp"
+#include "Aabb2f.hpp"
+#include "Aabb3f.hpp"
+#include "Ray3f.hpp"
+#include "Affine3f.hpp"
+#include "Vec2d.hpp"
+#include "Vec3d.hpp"
+#include "Vec4d.hpp"
+#include "Quaterniond.hpp"
+#include "Mat3d.hpp"
+#include "Mat4d.hpp"
+#include "Aabb3d.hpp"
+#include "Ray3d.hpp"
+#include "Affine3d.hpp"
+#include "Vec2i.hpp"
+#include "Vec3i.hpp"
+#include "Mat3i.hpp"
+#include "Mat4i.hpp"
+#include "Vec2h.hpp"
+#include "Vec3h.hpp"
+#include "Vec4h.hpp"
+#include "Quaternionh.hpp"
+
+#include <cstring>
+
+/*
+ * Component pointers of every archived type, in member order.
+ */
+static inline const float*
+Data( const float& value )
+{
+  return &value;
+}
+
+static inline const double*
+Data( const double& value )
+{
+  return &value;
+}
+
+static inline const float*
+Data( const Vec2f& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Vec3f& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Vec4f& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Quaternion& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Mat3f& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Mat4f& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Aabb2f& value )
+{
+  return value[ 0 ];
+}
+
+static inline const float*
+Data( const Aabb3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline const float*
+Data( const Ray3f& value )
+{
+  return value[ 0 ];
+}
+
+static inline const float*
+Data( const Affine3f& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Vec2d& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Vec3d& value )
+{
+  return value.Values();
+}
+
+static inline const float*
+Data( const Vec4d& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Quaterniond& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Mat3d& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Mat4d& value )
+{
+  return value.Values();
+}
+
+static inline const double*
+Data( const Aabb3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline const double*
+Data( const Ray3d& value )
+{
+  return value[ 0 ];
+}
+
+static inline const double*
+Data( const Affine3d& value )
+{
+  return value.Values();
+}
+
+static inline const int*
+Data( const Vec2i& value )
+{
+  return value.Values();
+}
+
+static inline const int*
+Data( const Vec3i& value )
+{
+  return value.Values();
+}
+
+static inline const int*
+Data( const Mat3i& value )
+{
+  return value.Values();
+}
+
+static inline const int*
+Data( const Mat4i& value )
+{
+  return value.Values();
+}
+
+static inline const unsigned short*
+Data( const Vec2h& value )
+{
+  return value.Values();
+}
+
+static inline const unsigned short*
+Data( const Vec3h& value )
+{
+  return value.Values();
+}
+
+static inline const unsigned short*
+Data( const Vec4h& value )
+{
+  return value.Values();
+}
+
+static inline const unsigned short*
+Data( const Quaternionh& value )
+{
+  return value.Values();
+}
+
+template< class Stored, class Source >
+static inline unsigned char*
+Pack( const Source* source, const unsigned int components, unsigned char* target )
+{
+  for ( unsigned int i = 0; i < components; i++ )
+  {
+    const Stored value = static_cast< Stored >( source[ i ] );
+
+    Archive::Encode( &value, sizeof( Stored ), target );
+    target += sizeof( Stored );
+  }
+
+  return target;
+}
+
+template< class Stored, class Value >
+static void
+PackAll( const Value* values, const unsigned int count, const unsigned int type, unsigned char* target )
+{
+  const unsigned int components = Archive::Components( type );
+
+  for ( unsigned int i = 0; i < count; i++ )
+    target = Pack< Stored >( Data( values[ i ] ), components, target );
+}
+
+static inline void
+Store( unsigned char* target, const unsigned int value )
+{
+  Archive::Encode( &value, 4, target );
+}
+
+static inline unsigned int
+Aligned( const unsigned int size )
+{
+  return ( size + ARCHIVE_ALIGNMENT - 1 ) & ~( ARCHIVE_ALIGNMENT - 1 );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ArchiveWriter::ArchiveWriter( void )
+{
+  return;
+}
+
+ArchiveWriter::~ArchiveWriter( void )
+{
+  return;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+ArchiveWriter::Add( const char* name, const float* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_FLOAT, Reserve( name, ARCHIVE_FLOAT, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec2f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_VEC2F, Reserve( name, ARCHIVE_VEC2F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec3f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_VEC3F, Reserve( name, ARCHIVE_VEC3F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec4f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_VEC4F, Reserve( name, ARCHIVE_VEC4F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Quaternion* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_QUATERNION, Reserve( name, ARCHIVE_QUATERNION, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat3f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_MAT3F, Reserve( name, ARCHIVE_MAT3F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat4f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_MAT4F, Reserve( name, ARCHIVE_MAT4F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Aabb2f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_AABB2F, Reserve( name, ARCHIVE_AABB2F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Aabb3f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_AABB3F, Reserve( name, ARCHIVE_AABB3F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Ray3f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_RAY3F, Reserve( name, ARCHIVE_RAY3F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Affine3f* values, const unsigned int count )
+{
+  PackAll< float >( values, count, ARCHIVE_AFFINE3F, Reserve( name, ARCHIVE_AFFINE3F, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const double* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_DOUBLE, Reserve( name, ARCHIVE_DOUBLE, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec2d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_VEC2D, Reserve( name, ARCHIVE_VEC2D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec3d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_VEC3D, Reserve( name, ARCHIVE_VEC3D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec4d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_VEC4D, Reserve( name, ARCHIVE_VEC4D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Quaterniond* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_QUATERNIOND, Reserve( name, ARCHIVE_QUATERNIOND, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat3d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_MAT3D, Reserve( name, ARCHIVE_MAT3D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat4d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_MAT4D, Reserve( name, ARCHIVE_MAT4D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Aabb3d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_AABB3D, Reserve( name, ARCHIVE_AABB3D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Ray3d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_RAY3D, Reserve( name, ARCHIVE_RAY3D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Affine3d* values, const unsigned int count )
+{
+  PackAll< double >( values, count, ARCHIVE_AFFINE3D, Reserve( name, ARCHIVE_AFFINE3D, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec2i* values, const unsigned int count )
+{
+  PackAll< int >( values, count, ARCHIVE_VEC2I, Reserve( name, ARCHIVE_VEC2I, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec3i* values, const unsigned int count )
+{
+  PackAll< int >( values, count, ARCHIVE_VEC3I, Reserve( name, ARCHIVE_VEC3I, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat3i* values, const unsigned int count )
+{
+  PackAll< int >( values, count, ARCHIVE_MAT3I, Reserve( name, ARCHIVE_MAT3I, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Mat4i* values, const unsigned int count )
+{
+  PackAll< int >( values, count, ARCHIVE_MAT4I, Reserve( name, ARCHIVE_MAT4I, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec2h* values, const unsigned int count )
+{
+  PackAll< unsigned short >( values, count, ARCHIVE_VEC2H, Reserve( name, ARCHIVE_VEC2H, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec3h* values, const unsigned int count )
+{
+  PackAll< unsigned short >( values, count, ARCHIVE_VEC3H, Reserve( name, ARCHIVE_VEC3H, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Vec4h* values, const unsigned int count )
+{
+  PackAll< unsigned short >( values, count, ARCHIVE_VEC4H, Reserve( name, ARCHIVE_VEC4H, count ) );
+
+  return Chunks() - 1;
+}
+
+unsigned int
+ArchiveWriter::Add( const char* name, const Quaternionh* values, const unsigned int count )
+{
+  PackAll< unsigned short >( values, count, ARCHIVE_QUATERNIONH, Reserve( name, ARCHIVE_QUATERNIONH, count ) );
+
+  return Chunks() - 1;
+}
+
+void
+ArchiveWriter::Clear( void )
+{
+  m_Entries.clear();
+  m_Payload.clear();
+}
+
+unsigned int
+ArchiveWriter::Chunks( void ) const
+{
+  return m_Entries.size();
+}
+
+unsigned int
+ArchiveWriter::Size( void ) const
+{
+  return ARCHIVE_HEADER + Chunks() * ARCHIVE_ENTRY + Aligned( m_Payload.size() );
+}
+
+void
+ArchiveWriter::Write( unsigned char* destination ) const
+{
+  const unsigned int chunks = Chunks();
+  const unsigned int base   = ARCHIVE_HEADER + chunks * ARCHIVE_ENTRY;
+  const unsigned int size   = Size();
+
+  memset( destination, 0, base );
+
+  for ( unsigned int i = 0; i < chunks; i++ )
+  {
+    const Entry&   entry  = m_Entries[ i ];
+    unsigned char* target = destination + ARCHIVE_HEADER + i * ARCHIVE_ENTRY;
+
+    Store( target, entry.type );
+    Store( target + 4, entry.count );
+    Store( target + 8, base + entry.offset );
+    Store( target + 12, entry.bytes );
+    memcpy( target + 16, entry.name, ARCHIVE_NAME );
+  }
+
+  if ( !m_Payload.empty() )
+    memcpy( destination + base, &m_Payload[ 0 ], m_Payload.size() );
+
+  memset( destination + base + m_Payload.size(), 0, size - base - m_Payload.size() );
+
+  destination[ 0 ] = 'G';
+  destination[ 1 ] = 'M';
+  destination[ 2 ] = 'A';
+  destination[ 3 ] = 'R';
+  Store( destination + 4, ARCHIVE_VERSION );
+  Store( destination + 8, chunks );
+  Store( destination + 12, size );
+  Store( destination + 16, Archive::Checksum( destination + ARCHIVE_HEADER, size - ARCHIVE_HEADER ) );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+unsigned char*
+ArchiveWriter::Reserve( const char* name, const unsigned int type, const unsigned int count )
+{
+  Entry entry;
+
+  memset( &entry, 0, sizeof( entry ) );
+  entry.type   = type;
+  entry.count  = count;
+  entry.offset = Aligned( m_Payload.size() );
+  entry.bytes  = count * Archive::ElementSize( type );
+
+  if ( name != NULL )
+    strncpy( entry.name, name, ARCHIVE_NAME - 1 );
+
+  m_Entries.push_back( entry );
+  m_Payload.resize( entry.offset + entry.bytes, 0 );
+
+  return entry.bytes > 0 ? &m_Payload[ entry.offset ] : NULL;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,169 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ArchiveWriter.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_ARCHIVEWRITER_HPP_
+#define MATH_ARCHIVEWRITER_HPP_
+
+#include "Archive.hpp"
+
+#include <vector>
+
+class Vec2f;
+class Vec3f;
+class Vec4f;
+class Quaternion;
+class Mat3f;
+class Mat4f;
+class Aabb2f;
+class Aabb3f;
+class Ray3f;
+class Affine3f;
+class Vec2d;
+class Vec3d;
+class Vec4d;
+class Quaterniond;
+class Mat3d;
+class Mat4d;
+class Aabb3d;
+class Ray3d;
+class Affine3d;
+class Vec2i;
+class Vec3i;
+class Mat3i;
+class Mat4i;
+class Vec2h;
+class Vec3h;
+class Vec4h;
+class Quaternionh;
+
+/*
+ * GeekEngine::ArchiveWriter
+ *
+ * Collects named arrays and writes them as one Archive image. Add copies
+ * the values right away, packed as described in Archive, and returns the
+ * index of the chunk; names longer than 47 characters are cut. Size gives
+ * the bytes Write needs, Write fills destination with the complete image
+ * including the checksum. The image can be written to a file as is and
+ * mapped back with ArchiveReader.
+ */
+class ArchiveWriter
+{
+public:
+  ArchiveWriter( void );
+  virtual
+  ~ArchiveWriter( void );
+
+  unsigned int
+  Add( const char* name, const float* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec2f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec3f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec4f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Quaternion* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat3f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat4f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Aabb2f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Aabb3f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Ray3f* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Affine3f* values, const unsigned int count );
+
+  unsigned int
+  Add( const char* name, const double* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec2d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec3d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec4d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Quaterniond* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat3d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat4d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Aabb3d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Ray3d* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Affine3d* values, const unsigned int count );
+
+  unsigned int
+  Add( const char* name, const Vec2i* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec3i* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat3i* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Mat4i* values, const unsigned int count );
+
+  unsigned int
+  Add( const char* name, const Vec2h* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec3h* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Vec4h* values, const unsigned int count );
+  unsigned int
+  Add( const char* name, const Quaternionh* values, const unsigned int count );
+
+  void
+  Clear( void );
+
+  unsigned int
+  Chunks( void ) const;
+  unsigned int
+  Size( void ) const;
+  void
+  Write( unsigned char* destination ) const;
+
+protected:
+  /* table entries as written, name is NUL terminated */
+  struct Entry
+  {
+    unsigned int type;
+    unsigned int count;
+    unsigned int offset;
+    unsigned int bytes;
+    char         name[ ARCHIVE_NAME ];
+  };
+
+  unsigned char*
+  Reserve( const char* name, const unsigned int type, const unsigned int count );
+
+  std::vector< Entry >         m_Entries;
+  std::vector< unsigned char > m_Payload;
+
+private:
+
+};
+
+#endif /* MATH_ARCHIVEWRITER_HPP_ */
@@ -0,0 +1,780 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Bvh.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Bvh.hpp"
+
+#include "Aabb3f.hpp"
+#include "Vec3f.hpp"
+
+#include <cfloat>
+
+#define BVH_STACK_SIZE      64
+#define BVH_TASK_MINIMUM    1024
+
+static float
+HalfArea( const float* min, const float* max )
+{
+  const float x = max[ 0 ] - min[ 0 ];
+  const float y = max[ 1 ] - min[ 1 ];
+  const float z = max[ 2 ] - min[ 2 ];
+
+  return x * y + y * z + z * x;
+}
+
+static void
+Grow( float* min, float* max, const float* box )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if ( box[ i ]     < min[ i ] ) min[ i ] = box[ i ];
+    if ( box[ 3 + i ] > max[ i ] ) max[ i ] = box[ 3 + i ];
+  }
+}
+
+static bool
+Overlaps( const float* min, const float* max, const float* box )
+{
+  return min[ 0 ] <= box[ 3 ] && max[ 0 ] >= box[ 0 ] &&
+         min[ 1 ] <= box[ 4 ] && max[ 1 ] >= box[ 1 ] &&
+         min[ 2 ] <= box[ 5 ] && max[ 2 ] >= box[ 2 ];
+}
+
+static bool
+OverlapsSphere( const float* min, const float* max, const float* center, const float radiusSq )
+{
+  float distanceSq = 0.0f;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    const float d = center[ i ] < min[ i ] ? min[ i ] - center[ i ] :
+                    center[ i ] > max[ i ] ? center[ i ] - max[ i ] : 0.0f;
+
+    distanceSq += d * d;
+  }
+
+  return distanceSq <= radiusSq;
+}
+
+/* entry distance of the ray into the box, FLT_MAX on a miss */
+static float
+Slab( const float* min, const float* max, const float* origin, const float* invDirection, const float maxDistance )
+{
+  float tNear = 0.0f;
+  float tFar  = maxDistance;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    float t0 = ( min[ i ] - origin[ i ] ) * invDirection[ i ];
+    float t1 = ( max[ i ] - origin[ i ] ) * invDirection[ i ];
+
+    if ( t0 > t1 ) { const float t = t0; t0 = t1; t1 = t; }
+
+    tNear = t0 > tNear ? t0 : tNear;
+    tFar  = t1 < tFar  ? t1 : tFar;
+  }
+
+  return tNear <= tFar ? tNear : FLT_MAX;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Bvh::Bvh( void ) :
+  m_MaxLeafSize( 4 ),
+  m_NodesUsed( 0 ),
+  m_Cost( 0.0f ),
+  m_BuildCost( 0.0f )
+{
+  return;
+}
+
+Bvh::Bvh( const Bvh& other ) :
+  m_Nodes( other.m_Nodes ),
+  m_Indices( other.m_Indices ),
+  m_MaxLeafSize( other.m_MaxLeafSize ),
+  m_PrimitiveBounds( other.m_PrimitiveBounds ),
+  m_NodesUsed( other.m_NodesUsed ),
+  m_Cost( other.m_Cost ),
+  m_BuildCost( other.m_BuildCost )
+{
+  return;
+}
+
+Bvh::~Bvh( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Bvh::Build( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize )
+{
+  std::vector< float > centroids;
+
+  Prepare( bounds, count, maxLeafSize, centroids );
+
+  if ( count == 0 ) return;
+
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > BVH_TASK_MINIMUM )
+  #pragma omp single
+#endif
+  Subdivide( 0, &centroids[ 0 ], 0 );
+
+  m_Nodes.resize( m_NodesUsed );
+
+  m_Cost      = ComputeCost();
+  m_BuildCost = m_Cost;
+}
+
+/*
+ * Children are always allocated after their parent, so walking the nodes
+ * backwards visits every child before its parent.
+ */
+void
+Bvh::Refit( const Aabb3f* bounds )
+{
+  const unsigned int count = m_Indices.size();
+
+  for ( unsigned int i = 0; i < count; i++ )
+    for ( unsigned int j = 0; j < 3; j++ )
+    {
+      m_PrimitiveBounds[ i * 6 + j ]     = bounds[ i ][ 0 ][ j ];
+      m_PrimitiveBounds[ i * 6 + 3 + j ] = bounds[ i ][ 1 ][ j ];
+    }
+
+  for ( unsigned int i = m_Nodes.size(); i > 0; i-- )
+  {
+    BvhNode& node = m_Nodes[ i - 1 ];
+
+    if ( node.count > 0 )
+    {
+      Fit( i - 1 );
+      continue;
+    }
+
+    const BvhNode& left  = m_Nodes[ node.first ];
+    const BvhNode& right = m_Nodes[ node.first + 1 ];
+
+    for ( unsigned int j = 0; j < 3; j++ )
+    {
+      node.min[ j ] = left.min[ j ] < right.min[ j ] ? left.min[ j ] : right.min[ j ];
+      node.max[ j ] = left.max[ j ] > right.max[ j ] ? left.max[ j ] : right.max[ j ];
+    }
+  }
+
+  m_Cost = ComputeCost();
+}
+
+void
+Bvh::Swap( Bvh& other )
+{
+  m_Nodes.swap( other.m_Nodes );
+  m_Indices.swap( other.m_Indices );
+  m_PrimitiveBounds.swap( other.m_PrimitiveBounds );
+
+  const unsigned int maxLeafSize = m_MaxLeafSize;
+  const unsigned int nodesUsed   = m_NodesUsed;
+  const float        cost        = m_Cost;
+  const float        buildCost   = m_BuildCost;
+
+  m_MaxLeafSize = other.m_MaxLeafSize; other.m_MaxLeafSize = maxLeafSize;
+  m_NodesUsed   = other.m_NodesUsed;   other.m_NodesUsed   = nodesUsed;
+  m_Cost        = other.m_Cost;        other.m_Cost        = cost;
+  m_BuildCost   = other.m_BuildCost;   other.m_BuildCost   = buildCost;
+}
+
+void
+Bvh::Clear( void )
+{
+  m_Nodes.clear();
+  m_Indices.clear();
+  m_PrimitiveBounds.clear();
+  m_NodesUsed = 0;
+  m_Cost      = 0.0f;
+  m_BuildCost = 0.0f;
+}
+
+unsigned int
+Bvh::Primitives( void ) const
+{
+  return m_Indices.size();
+}
+
+unsigned int
+Bvh::Nodes( void ) const
+{
+  return m_Nodes.size();
+}
+
+const BvhNode&
+Bvh::Node( const unsigned int node ) const
+{
+  return m_Nodes[ node ];
+}
+
+const unsigned int*
+Bvh::Indices( void ) const
+{
+  return m_Indices.empty() ? 0 : &m_Indices[ 0 ];
+}
+
+Aabb3f
+Bvh::Bounds( void ) const
+{
+  if ( m_Nodes.empty() ) return Aabb3f();
+
+  const BvhNode& root = m_Nodes[ 0 ];
+
+  return Aabb3f( Vec3f( root.min[ 0 ], root.min[ 1 ], root.min[ 2 ] ),
+                 Vec3f( root.max[ 0 ], root.max[ 1 ], root.max[ 2 ] ) );
+}
+
+/*
+ * Expected cost of a random ray query relative to the root: traversal
+ * steps plus primitive tests, weighted by the surface area of each node.
+ */
+float
+Bvh::Cost( void ) const
+{
+  return m_Cost;
+}
+
+float
+Bvh::BuildCost( void ) const
+{
+  return m_BuildCost;
+}
+
+/* Cost relative to the cost right after the build, 1 for a fresh tree */
+float
+Bvh::Degradation( void ) const
+{
+  return m_BuildCost > 0.0f ? m_Cost / m_BuildCost : 1.0f;
+}
+
+unsigned int
+Bvh::Query( const Aabb3f& box, unsigned int* primitives, const unsigned int capacity ) const
+{
+  if ( m_Nodes.empty() ) return 0;
+
+  const float  query[ 6 ] = { box[ 0 ][ 0 ], box[ 0 ][ 1 ], box[ 0 ][ 2 ],
+                              box[ 1 ][ 0 ], box[ 1 ][ 1 ], box[ 1 ][ 2 ] };
+  unsigned int stack[ BVH_STACK_SIZE ];
+  unsigned int top     = 0;
+  unsigned int written = 0;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 && written < capacity )
+  {
+    const BvhNode& node = m_Nodes[ stack[ --top ] ];
+
+    if ( !Overlaps( node.min, node.max, query ) ) continue;
+
+    if ( node.count == 0 )
+    {
+      stack[ top++ ] = node.first + 1;
+      stack[ top++ ] = node.first;
+      continue;
+    }
+
+    for ( unsigned int i = 0; i < node.count && written < capacity; i++ )
+    {
+      const unsigned int primitive = m_Indices[ node.first + i ];
+      const float*       bounds    = &m_PrimitiveBounds[ primitive * 6 ];
+
+      if ( Overlaps( bounds, bounds + 3, query ) )
+        primitives[ written++ ] = primitive;
+    }
+  }
+
+  return written;
+}
+
+unsigned int
+Bvh::Query( const Vec3f& center, const float radius, unsigned int* primitives, const unsigned int capacity ) const
+{
+  if ( m_Nodes.empty() ) return 0;
+
+  const float  c[ 3 ]   = { center.X(), center.Y(), center.Z() };
+  const float  radiusSq = radius * radius;
+  unsigned int stack[ BVH_STACK_SIZE ];
+  unsigned int top     = 0;
+  unsigned int written = 0;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 && written < capacity )
+  {
+    const BvhNode& node = m_Nodes[ stack[ --top ] ];
+
+    if ( !OverlapsSphere( node.min, node.max, c, radiusSq ) ) continue;
+
+    if ( node.count == 0 )
+    {
+      stack[ top++ ] = node.first + 1;
+      stack[ top++ ] = node.first;
+      continue;
+    }
+
+    for ( unsigned int i = 0; i < node.count && written < capacity; i++ )
+    {
+      const unsigned int primitive = m_Indices[ node.first + i ];
+      const float*       bounds    = &m_PrimitiveBounds[ primitive * 6 ];
+
+      if ( OverlapsSphere( bounds, bounds + 3, c, radiusSq ) )
+        primitives[ written++ ] = primitive;
+    }
+  }
+
+  return written;
+}
+
+float
+Bvh::Raycast( const Vec3f& origin, const Vec3f& direction, const float maxDistance,
+              BvhRayCallback* callback, unsigned int& primitive ) const
+{
+  if ( m_Nodes.empty() ) return -1.0f;
+
+  const float  o[ 3 ]   = { origin.X(), origin.Y(), origin.Z() };
+  const float  inv[ 3 ] = { 1.0f / direction.X(), 1.0f / direction.Y(), 1.0f / direction.Z() };
+  float        closest  = maxDistance;
+  bool         hit      = false;
+  unsigned int stack[ BVH_STACK_SIZE ];
+  unsigned int top = 0;
+
+  if ( Slab( m_Nodes[ 0 ].min, m_Nodes[ 0 ].max, o, inv, closest ) == FLT_MAX ) return -1.0f;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 )
+  {
+    const BvhNode& node = m_Nodes[ stack[ --top ] ];
+
+    if ( node.count == 0 )
+    {
+      const unsigned int left  = node.first;
+      const unsigned int right = node.first + 1;
+      const float        tLeft  = Slab( m_Nodes[ left ].min,  m_Nodes[ left ].max,  o, inv, closest );
+      const float        tRight = Slab( m_Nodes[ right ].min, m_Nodes[ right ].max, o, inv, closest );
+
+      /* nearer child is popped first */
+      if ( tLeft <= tRight )
+      {
+        if ( tRight != FLT_MAX ) stack[ top++ ] = right;
+        if ( tLeft  != FLT_MAX ) stack[ top++ ] = left;
+      }
+      else
+      {
+        if ( tLeft  != FLT_MAX ) stack[ top++ ] = left;
+        if ( tRight != FLT_MAX ) stack[ top++ ] = right;
+      }
+      continue;
+    }
+
+    for ( unsigned int i = 0; i < node.count; i++ )
+    {
+      const unsigned int index  = m_Indices[ node.first + i ];
+      const float*       bounds = &m_PrimitiveBounds[ index * 6 ];
+      float              t      = Slab( bounds, bounds + 3, o, inv, closest );
+
+      if ( t == FLT_MAX ) continue;
+      if ( callback ) t = callback->Intersect( index, origin, direction, closest );
+
+      if ( t >= 0.0f && t <= closest )
+      {
+        closest   = t;
+        primitive = index;
+        hit       = true;
+      }
+    }
+  }
+
+  return hit ? closest : -1.0f;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+void
+Bvh::Prepare( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize,
+              std::vector< float >& centroids )
+{
+  Reserve( count, maxLeafSize, centroids );
+  Load( bounds, 0, count, centroids );
+}
+
+/* allocates without touching the memory, Load fills it range by range */
+void
+Bvh::Reserve( const unsigned int count, const unsigned int maxLeafSize, std::vector< float >& centroids )
+{
+  Clear();
+  centroids.clear();
+
+  if ( count == 0 ) return;
+
+  m_MaxLeafSize = maxLeafSize > 0 ? maxLeafSize : 1;
+
+  centroids.reserve( count * 3 );
+  m_PrimitiveBounds.reserve( count * 6 );
+  m_Indices.reserve( count );
+
+  /* a binary tree over count leaves never needs more nodes than this */
+  m_Nodes.reserve( count * 2 - 1 );
+  m_NodesUsed = 1;
+}
+
+/*
+ * Appends the primitives begin to end, which must follow the ones loaded
+ * before. The root always spans everything loaded so far.
+ */
+void
+Bvh::Load( const Aabb3f* bounds, const unsigned int begin, const unsigned int end,
+           std::vector< float >& centroids )
+{
+  if ( end <= begin ) return;
+
+  centroids.resize( end * 3 );
+  m_PrimitiveBounds.resize( end * 6 );
+  m_Indices.resize( end );
+  m_Nodes.resize( end * 2 - 1 );
+
+  for ( unsigned int i = begin; i < end; i++ )
+  {
+    for ( unsigned int j = 0; j < 3; j++ )
+    {
+      m_PrimitiveBounds[ i * 6 + j ]     = bounds[ i ][ 0 ][ j ];
+      m_PrimitiveBounds[ i * 6 + 3 + j ] = bounds[ i ][ 1 ][ j ];
+      centroids[ i * 3 + j ]             = ( bounds[ i ][ 0 ][ j ] + bounds[ i ][ 1 ][ j ] ) * 0.5f;
+    }
+
+    m_Indices[ i ] = i;
+  }
+
+  m_Nodes[ 0 ].first = 0;
+  m_Nodes[ 0 ].count = end;
+}
+
+void
+Bvh::Subdivide( const unsigned int nodeIndex, const float* centroids, const unsigned int depth )
+{
+  if ( !Split( nodeIndex, centroids, depth ) ) return;
+
+  const unsigned int left = m_Nodes[ nodeIndex ].first;
+
+#if defined( _OPENMP )
+  const unsigned int count = m_Nodes[ left ].count + m_Nodes[ left + 1 ].count;
+
+  #pragma omp task if ( count > BVH_TASK_MINIMUM )
+#endif
+  Subdivide( left, centroids, depth + 1 );
+
+  Subdivide( left + 1, centroids, depth + 1 );
+}
+
+/*
+ * Fits the node to its primitives and splits it in two if the SAH says a
+ * split is cheaper than a leaf. Returns whether children were created.
+ */
+bool
+Bvh::Split( const unsigned int nodeIndex, const float* centroids, const unsigned int depth )
+{
+  BvhSplit           split;
+  const unsigned int count = m_Nodes[ nodeIndex ].count;
+
+  Open( split, nodeIndex, depth );
+  Measure( split, centroids, 0, count );
+
+  if ( !StartBins( split ) ) return false;
+
+  Bin( split, centroids, 0, count );
+
+  if ( !Choose( split ) ) return false;
+
+  Partition( split, centroids, count );
+  Close( split );
+
+  return true;
+}
+
+void
+Bvh::Open( BvhSplit& split, const unsigned int nodeIndex, const unsigned int depth )
+{
+  BvhNode& node = m_Nodes[ nodeIndex ];
+
+  split.node  = nodeIndex;
+  split.depth = depth;
+
+  for ( unsigned int j = 0; j < 3; j++ )
+  {
+    node.min[ j ] = split.centroidMin[ j ] =  FLT_MAX;
+    node.max[ j ] = split.centroidMax[ j ] = -FLT_MAX;
+  }
+}
+
+/* grows the node bounds and the centroid bounds over primitives begin to end of the node */
+void
+Bvh::Measure( BvhSplit& split, const float* centroids, const unsigned int begin, const unsigned int end )
+{
+  BvhNode& node = m_Nodes[ split.node ];
+
+  for ( unsigned int i = begin; i < end; i++ )
+  {
+    const unsigned int primitive = m_Indices[ node.first + i ];
+    const float*       c         = &centroids[ primitive * 3 ];
+
+    Grow( node.min, node.max, &m_PrimitiveBounds[ primitive * 6 ] );
+
+    for ( unsigned int j = 0; j < 3; j++ )
+    {
+      if ( c[ j ] < split.centroidMin[ j ] ) split.centroidMin[ j ] = c[ j ];
+      if ( c[ j ] > split.centroidMax[ j ] ) split.centroidMax[ j ] = c[ j ];
+    }
+  }
+}
+
+/* binned SAH, up to BVH_BINS buckets per axis over the centroid bounds */
+bool
+Bvh::StartBins( BvhSplit& split )
+{
+  const unsigned int count = m_Nodes[ split.node ].count;
+
+  if ( count <= 1 || split.depth >= BVH_MAX_DEPTH ) return false;
+
+  split.bins = count < BVH_BINS ? count : BVH_BINS;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+    for ( unsigned int b = 0; b < split.bins; b++ )
+    {
+      float* box = split.binBounds[ axis ][ b ];
+
+      split.binCount[ axis ][ b ] = 0;
+      box[ 0 ] = box[ 1 ] = box[ 2 ] =  FLT_MAX;
+      box[ 3 ] = box[ 4 ] = box[ 5 ] = -FLT_MAX;
+    }
+
+  return true;
+}
+
+void
+Bvh::Bin( BvhSplit& split, const float* centroids, const unsigned int begin, const unsigned int end )
+{
+  const unsigned int first = m_Nodes[ split.node ].first;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    const float extent = split.centroidMax[ axis ] - split.centroidMin[ axis ];
+
+    if ( extent <= 0.0f ) continue;
+
+    const float scale = split.bins / extent;
+
+    for ( unsigned int i = begin; i < end; i++ )
+    {
+      const unsigned int primitive = m_Indices[ first + i ];
+      unsigned int       b = (unsigned int)( ( centroids[ primitive * 3 + axis ] - split.centroidMin[ axis ] ) * scale );
+
+      if ( b >= split.bins ) b = split.bins - 1;
+
+      split.binCount[ axis ][ b ]++;
+      Grow( split.binBounds[ axis ][ b ], split.binBounds[ axis ][ b ] + 3, &m_PrimitiveBounds[ primitive * 6 ] );
+    }
+  }
+}
+
+/*
+ * Picks the cheapest bin boundary over all axes and decides between leaf
+ * and split. Returns false if the node stays a leaf.
+ */
+bool
+Bvh::Choose( BvhSplit& split )
+{
+  const BvhNode&     node     = m_Nodes[ split.node ];
+  const unsigned int count    = node.count;
+  const unsigned int bins     = split.bins;
+  float              bestCost = FLT_MAX;
+
+  split.axis  = -1;
+  split.split = 0;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    if ( split.centroidMax[ axis ] - split.centroidMin[ axis ] <= 0.0f ) continue;
+
+    float        leftArea[ BVH_BINS - 1 ];
+    unsigned int leftCount[ BVH_BINS - 1 ];
+    float        growMin[ 3 ] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+    float        growMax[ 3 ] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    unsigned int sum = 0;
+
+    for ( unsigned int b = 0; b < bins - 1; b++ )
+    {
+      sum += split.binCount[ axis ][ b ];
+      Grow( growMin, growMax, split.binBounds[ axis ][ b ] );
+
+      leftCount[ b ] = sum;
+      leftArea[ b ]  = sum > 0 ? HalfArea( growMin, growMax ) : 0.0f;
+    }
+
+    growMin[ 0 ] = growMin[ 1 ] = growMin[ 2 ] =  FLT_MAX;
+    growMax[ 0 ] = growMax[ 1 ] = growMax[ 2 ] = -FLT_MAX;
+    sum = 0;
+
+    for ( unsigned int b = bins - 1; b > 0; b-- )
+    {
+      sum += split.binCount[ axis ][ b ];
+      Grow( growMin, growMax, split.binBounds[ axis ][ b ] );
+
+      if ( sum == 0 || leftCount[ b - 1 ] == 0 ) continue;
+
+      const float cost = leftArea[ b - 1 ] * leftCount[ b - 1 ] + HalfArea( growMin, growMax ) * sum;
+
+      if ( cost < bestCost )
+      {
+        bestCost    = cost;
+        split.axis  = axis;
+        split.split = b;
+      }
+    }
+  }
+
+  /* no partition without an axis, Close falls back to halving the range */
+  split.left  = node.first;
+  split.right = split.axis >= 0 ? node.first + count : node.first;
+
+  if ( split.axis < 0 ) return count > m_MaxLeafSize;
+
+  const float area = HalfArea( node.min, node.max );
+
+  /* traversal step costs as much as one primitive test */
+  return count > m_MaxLeafSize || ( area > 0.0f && 1.0f + bestCost / area < count );
+}
+
+/* moves up to steps primitives to their side, returns true once the partition is complete */
+bool
+Bvh::Partition( BvhSplit& split, const float* centroids, unsigned int steps )
+{
+  if ( split.left >= split.right ) return true;
+
+  const int   axis  = split.axis;
+  const float scale = split.bins / ( split.centroidMax[ axis ] - split.centroidMin[ axis ] );
+
+  while ( split.left < split.right && steps-- > 0 )
+  {
+    const unsigned int primitive = m_Indices[ split.left ];
+    unsigned int       b = (unsigned int)( ( centroids[ primitive * 3 + axis ] - split.centroidMin[ axis ] ) * scale );
+
+    if ( b >= split.bins ) b = split.bins - 1;
+
+    if ( (int)b < split.split )
+      split.left++;
+    else
+    {
+      m_Indices[ split.left ]  = m_Indices[ --split.right ];
+      m_Indices[ split.right ] = primitive;
+    }
+  }
+
+  return split.left >= split.right;
+}
+
+void
+Bvh::Close( BvhSplit& split )
+{
+  BvhNode&           node      = m_Nodes[ split.node ];
+  const unsigned int first     = node.first;
+  const unsigned int count     = node.count;
+  unsigned int       leftCount = split.left - first;
+
+  /* no usable split, all centroids coincide: split the range in half */
+  if ( leftCount == 0 || leftCount == count )
+    leftCount = count / 2;
+
+  const unsigned int left = Allocate();
+
+  m_Nodes[ left ].first     = first;
+  m_Nodes[ left ].count     = leftCount;
+  m_Nodes[ left + 1 ].first = first + leftCount;
+  m_Nodes[ left + 1 ].count = count - leftCount;
+
+  node.first = left;
+  node.count = 0;
+}
+
+void
+Bvh::Fit( const unsigned int nodeIndex )
+{
+  BvhNode& node = m_Nodes[ nodeIndex ];
+
+  node.min[ 0 ] = node.min[ 1 ] = node.min[ 2 ] =  FLT_MAX;
+  node.max[ 0 ] = node.max[ 1 ] = node.max[ 2 ] = -FLT_MAX;
+
+  for ( unsigned int i = 0; i < node.count; i++ )
+    Grow( node.min, node.max, &m_PrimitiveBounds[ m_Indices[ node.first + i ] * 6 ] );
+}
+
+unsigned int
+Bvh::Allocate( void )
+{
+  unsigned int index;
+
+#if defined( _OPENMP )
+  #pragma omp critical( BvhAllocate )
+#endif
+  {
+    index        = m_NodesUsed;
+    m_NodesUsed += 2;
+  }
+
+  return index;
+}
+
+float
+Bvh::ComputeCost( void ) const
+{
+  if ( m_Nodes.empty() ) return 0.0f;
+
+  const float rootArea = HalfArea( m_Nodes[ 0 ].min, m_Nodes[ 0 ].max );
+  float       cost     = 0.0f;
+
+  for ( unsigned int i = 0; i < m_Nodes.size(); i++ )
+  {
+    const BvhNode& node = m_Nodes[ i ];
+
+    cost += HalfArea( node.min, node.max ) * ( node.count > 0 ? (float)node.count : 1.0f );
+  }
+
+  return rootArea > 0.0f ? cost / rootArea : cost;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
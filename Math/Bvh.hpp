@@ -0,0 +1,192 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Bvh.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_BVH_HPP_
+#define MATH_BVH_HPP_
+
+#include <vector>
+
+/* build depth cap, sizes the fixed query stacks of Bvh and Bvh4 */
+#define BVH_MAX_DEPTH 60
+#define BVH_BINS      16
+
+class Aabb3f;
+class Vec3f;
+
+/*
+ * 32 byte node, children of an inner node are stored next to each other.
+ * count == 0 marks an inner node whose left child is first, otherwise first
+ * is the offset of the leaf's primitives in the index array.
+ */
+struct BvhNode
+{
+  float         min[ 3 ];
+  unsigned int  first;
+  float         max[ 3 ];
+  unsigned int  count;
+};
+
+/*
+ * Progress of one binned SAH split. Bvh::Split runs all of its stages at
+ * once, BvhRebuild feeds them primitive ranges to stay within its budget.
+ * left and right are the partition cursors into the index array.
+ */
+struct BvhSplit
+{
+  unsigned int  node;
+  unsigned int  depth;
+  unsigned int  bins;
+  float         centroidMin[ 3 ];
+  float         centroidMax[ 3 ];
+  unsigned int  binCount[ 3 ][ BVH_BINS ];
+  float         binBounds[ 3 ][ BVH_BINS ][ 6 ];
+  int           axis;
+  int           split;
+  unsigned int  left;
+  unsigned int  right;
+};
+
+/*
+ * Narrow phase test for Bvh::Raycast. Intersect returns the distance along
+ * the ray to the hit on the primitive, or a negative value on a miss.
+ */
+class BvhRayCallback
+{
+public:
+  virtual
+  ~BvhRayCallback( void ) { return; }
+
+  virtual float
+  Intersect( const unsigned int primitive, const Vec3f& origin, const Vec3f& direction,
+             const float maxDistance ) = 0;
+};
+
+/*
+ * GeekEngine::Bvh
+ *
+ * Bounding volume hierarchy over primitive bounds, built top down with a
+ * binned surface area heuristic. Subtrees are built as parallel tasks when
+ * compiled with OpenMP. Queries traverse with a short fixed size stack and
+ * report primitive indices as passed to Build; box and sphere queries
+ * return how many were written to primitives, at most capacity. Raycast
+ * returns the distance to the closest hit or -1 without one. Without a
+ * callback the primitive bounds themselves are hit.
+ *
+ * Moving primitives are handled by Refit, which keeps the topology and
+ * only updates node bounds. Degradation tells how much the SAH cost grew
+ * since the tree was built; once it gets too high a BvhRebuild can build
+ * a replacement over several frames.
+ */
+class Bvh
+{
+public:
+  Bvh( void );
+  Bvh( const Bvh& );
+  virtual
+  ~Bvh( void );
+
+  void
+  Build( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize = 4 );
+  void
+  Refit( const Aabb3f* bounds );
+  void
+  Swap( Bvh& other );
+  void
+  Clear( void );
+
+  unsigned int
+  Primitives( void ) const;
+  unsigned int
+  Nodes( void ) const;
+  const BvhNode&
+  Node( const unsigned int node ) const;
+  const unsigned int*
+  Indices( void ) const;
+  Aabb3f
+  Bounds( void ) const;
+  float
+  Cost( void ) const;
+  float
+  BuildCost( void ) const;
+  float
+  Degradation( void ) const;
+
+  unsigned int
+  Query( const Aabb3f& box, unsigned int* primitives, const unsigned int capacity ) const;
+  unsigned int
+  Query( const Vec3f& center, const float radius, unsigned int* primitives, const unsigned int capacity ) const;
+  float
+  Raycast( const Vec3f& origin, const Vec3f& direction, const float maxDistance,
+           BvhRayCallback* callback, unsigned int& primitive ) const;
+
+protected:
+  std::vector< BvhNode >      m_Nodes;
+  std::vector< unsigned int > m_Indices;
+  unsigned int                m_MaxLeafSize;
+
+  void
+  Prepare( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize,
+           std::vector< float >& centroids );
+  void
+  Reserve( const unsigned int count, const unsigned int maxLeafSize, std::vector< float >& centroids );
+  void
+  Load( const Aabb3f* bounds, const unsigned int begin, const unsigned int end,
+        std::vector< float >& centroids );
+  void
+  Subdivide( const unsigned int node, const float* centroids, const unsigned int depth );
+  bool
+  Split( const unsigned int node, const float* centroids, const unsigned int depth );
+  void
+  Open( BvhSplit& split, const unsigned int node, const unsigned int depth );
+  void
+  Measure( BvhSplit& split, const float* centroids, const unsigned int begin, const unsigned int end );
+  bool
+  StartBins( BvhSplit& split );
+  void
+  Bin( BvhSplit& split, const float* centroids, const unsigned int begin, const unsigned int end );
+  bool
+  Choose( BvhSplit& split );
+  bool
+  Partition( BvhSplit& split, const float* centroids, unsigned int steps );
+  void
+  Close( BvhSplit& split );
+  void
+  Fit( const unsigned int node );
+  unsigned int
+  Allocate( void );
+  float
+  ComputeCost( void ) const;
+
+  std::vector< float >        m_PrimitiveBounds;
+
+private:
+  friend class Bvh4;
+  friend class BvhRebuild;
+
+  unsigned int                m_NodesUsed;
+  float                       m_Cost;
+  float                       m_BuildCost;
+
+};
+
+#endif /* MATH_BVH_HPP_ */
@@ -0,0 +1,455 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Bvh4.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Bvh4.hpp"
+
+#include "Aabb3f.hpp"
+#include "Bvh.hpp"
+#include "Vec3f.hpp"
+
+#include <cfloat>
+#include <cstring>
+
+/*
+ * A wide node may open only one binary level of a lane, so a wide path can
+ * be BVH_MAX_DEPTH nodes long and each of them leaves up to three siblings
+ * on the stack.
+ */
+#define BVH4_STACK_SIZE ( BVH_MAX_DEPTH * 3 + 1 )
+
+static float
+HalfArea( const BvhNode& node )
+{
+  const float x = node.max[ 0 ] - node.min[ 0 ];
+  const float y = node.max[ 1 ] - node.min[ 1 ];
+  const float z = node.max[ 2 ] - node.min[ 2 ];
+
+  return x * y + y * z + z * x;
+}
+
+static bool
+Overlaps( const float* bounds, const float* box )
+{
+  return bounds[ 0 ] <= box[ 3 ] && bounds[ 3 ] >= box[ 0 ] &&
+         bounds[ 1 ] <= box[ 4 ] && bounds[ 4 ] >= box[ 1 ] &&
+         bounds[ 2 ] <= box[ 5 ] && bounds[ 5 ] >= box[ 2 ];
+}
+
+static float
+DistanceSq( const float* bounds, const float* center )
+{
+  float distanceSq = 0.0f;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    const float d = center[ i ] < bounds[ i ]     ? bounds[ i ] - center[ i ] :
+                    center[ i ] > bounds[ 3 + i ] ? center[ i ] - bounds[ 3 + i ] : 0.0f;
+
+    distanceSq += d * d;
+  }
+
+  return distanceSq;
+}
+
+static float
+Slab( const float* bounds, const float* origin, const float* invDirection, const float maxDistance )
+{
+  float tNear = 0.0f;
+  float tFar  = maxDistance;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    float t0 = ( bounds[ i ]     - origin[ i ] ) * invDirection[ i ];
+    float t1 = ( bounds[ 3 + i ] - origin[ i ] ) * invDirection[ i ];
+
+    if ( t0 > t1 ) { const float t = t0; t0 = t1; t1 = t; }
+
+    tNear = t0 > tNear ? t0 : tNear;
+    tFar  = t1 < tFar  ? t1 : tFar;
+  }
+
+  return tNear <= tFar ? tNear : FLT_MAX;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Bvh4::Bvh4( void )
+{
+  Clear();
+}
+
+Bvh4::Bvh4( const Bvh4& other ) :
+  m_Nodes( other.m_Nodes ),
+  m_Indices( other.m_Indices ),
+  m_PrimitiveBounds( other.m_PrimitiveBounds )
+{
+  memcpy( m_Root, other.m_Root, sizeof( m_Root ) );
+}
+
+Bvh4::Bvh4( const Bvh& bvh )
+{
+  Build( bvh );
+}
+
+Bvh4::~Bvh4( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Bvh4::Build( const Bvh& bvh )
+{
+  Clear();
+
+  if ( bvh.m_Nodes.empty() ) return;
+
+  m_Indices         = bvh.m_Indices;
+  m_PrimitiveBounds = bvh.m_PrimitiveBounds;
+
+  const BvhNode& root = bvh.m_Nodes[ 0 ];
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Root[ i ]     = root.min[ i ];
+    m_Root[ 3 + i ] = root.max[ i ];
+  }
+
+  m_Nodes.reserve( bvh.m_Nodes.size() / 2 + 1 );
+
+  /* a single leaf root still needs one wide node to hang from */
+  if ( root.count > 0 )
+  {
+    Bvh4Node node;
+
+    memset( &node, 0, sizeof( node ) );
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+    {
+      node.minX[ lane ] = node.minY[ lane ] = node.minZ[ lane ] =  FLT_MAX;
+      node.maxX[ lane ] = node.maxY[ lane ] = node.maxZ[ lane ] = -FLT_MAX;
+    }
+
+    node.minX[ 0 ] = root.min[ 0 ]; node.minY[ 0 ] = root.min[ 1 ]; node.minZ[ 0 ] = root.min[ 2 ];
+    node.maxX[ 0 ] = root.max[ 0 ]; node.maxY[ 0 ] = root.max[ 1 ]; node.maxZ[ 0 ] = root.max[ 2 ];
+    node.child[ 0 ] = root.first;
+    node.count[ 0 ] = root.count;
+
+    m_Nodes.push_back( node );
+    return;
+  }
+
+  Collapse( bvh, 0 );
+}
+
+void
+Bvh4::Clear( void )
+{
+  m_Nodes.clear();
+  m_Indices.clear();
+  m_PrimitiveBounds.clear();
+
+  m_Root[ 0 ] = m_Root[ 1 ] = m_Root[ 2 ] =  FLT_MAX;
+  m_Root[ 3 ] = m_Root[ 4 ] = m_Root[ 5 ] = -FLT_MAX;
+}
+
+unsigned int
+Bvh4::Nodes( void ) const
+{
+  return m_Nodes.size();
+}
+
+const Bvh4Node&
+Bvh4::Node( const unsigned int node ) const
+{
+  return m_Nodes[ node ];
+}
+
+unsigned int
+Bvh4::Query( const Aabb3f& box, unsigned int* primitives, const unsigned int capacity ) const
+{
+  if ( m_Nodes.empty() ) return 0;
+
+  const float  query[ 6 ] = { box[ 0 ][ 0 ], box[ 0 ][ 1 ], box[ 0 ][ 2 ],
+                              box[ 1 ][ 0 ], box[ 1 ][ 1 ], box[ 1 ][ 2 ] };
+  unsigned int stack[ BVH4_STACK_SIZE ];
+  unsigned int top     = 0;
+  unsigned int written = 0;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 && written < capacity )
+  {
+    const Bvh4Node& node = m_Nodes[ stack[ --top ] ];
+    bool            hit[ 4 ];
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+      hit[ lane ] = node.minX[ lane ] <= node.maxX[ lane ] &&
+                    node.minX[ lane ] <= query[ 3 ] && node.maxX[ lane ] >= query[ 0 ] &&
+                    node.minY[ lane ] <= query[ 4 ] && node.maxY[ lane ] >= query[ 1 ] &&
+                    node.minZ[ lane ] <= query[ 5 ] && node.maxZ[ lane ] >= query[ 2 ];
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+    {
+      if ( !hit[ lane ] ) continue;
+
+      if ( node.count[ lane ] == 0 )
+      {
+        stack[ top++ ] = node.child[ lane ];
+        continue;
+      }
+
+      for ( unsigned int i = 0; i < node.count[ lane ] && written < capacity; i++ )
+      {
+        const unsigned int primitive = m_Indices[ node.child[ lane ] + i ];
+
+        if ( Overlaps( &m_PrimitiveBounds[ primitive * 6 ], query ) )
+          primitives[ written++ ] = primitive;
+      }
+    }
+  }
+
+  return written;
+}
+
+unsigned int
+Bvh4::Query( const Vec3f& center, const float radius, unsigned int* primitives, const unsigned int capacity ) const
+{
+  if ( m_Nodes.empty() ) return 0;
+
+  const float  c[ 3 ]   = { center.X(), center.Y(), center.Z() };
+  const float  radiusSq = radius * radius;
+  unsigned int stack[ BVH4_STACK_SIZE ];
+  unsigned int top     = 0;
+  unsigned int written = 0;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 && written < capacity )
+  {
+    const Bvh4Node& node = m_Nodes[ stack[ --top ] ];
+    float           distanceSq[ 4 ];
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+    {
+      const float dx = c[ 0 ] < node.minX[ lane ] ? node.minX[ lane ] - c[ 0 ] :
+                       c[ 0 ] > node.maxX[ lane ] ? c[ 0 ] - node.maxX[ lane ] : 0.0f;
+      const float dy = c[ 1 ] < node.minY[ lane ] ? node.minY[ lane ] - c[ 1 ] :
+                       c[ 1 ] > node.maxY[ lane ] ? c[ 1 ] - node.maxY[ lane ] : 0.0f;
+      const float dz = c[ 2 ] < node.minZ[ lane ] ? node.minZ[ lane ] - c[ 2 ] :
+                       c[ 2 ] > node.maxZ[ lane ] ? c[ 2 ] - node.maxZ[ lane ] : 0.0f;
+
+      distanceSq[ lane ] = node.minX[ lane ] > node.maxX[ lane ] ? FLT_MAX : dx * dx + dy * dy + dz * dz;
+    }
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+    {
+      if ( distanceSq[ lane ] > radiusSq ) continue;
+
+      if ( node.count[ lane ] == 0 )
+      {
+        stack[ top++ ] = node.child[ lane ];
+        continue;
+      }
+
+      for ( unsigned int i = 0; i < node.count[ lane ] && written < capacity; i++ )
+      {
+        const unsigned int primitive = m_Indices[ node.child[ lane ] + i ];
+
+        if ( DistanceSq( &m_PrimitiveBounds[ primitive * 6 ], c ) <= radiusSq )
+          primitives[ written++ ] = primitive;
+      }
+    }
+  }
+
+  return written;
+}
+
+float
+Bvh4::Raycast( const Vec3f& origin, const Vec3f& direction, const float maxDistance,
+               BvhRayCallback* callback, unsigned int& primitive ) const
+{
+  if ( m_Nodes.empty() ) return -1.0f;
+
+  const float  o[ 3 ]   = { origin.X(), origin.Y(), origin.Z() };
+  const float  inv[ 3 ] = { 1.0f / direction.X(), 1.0f / direction.Y(), 1.0f / direction.Z() };
+  float        closest  = maxDistance;
+  bool         hit      = false;
+  unsigned int stack[ BVH4_STACK_SIZE ];
+  unsigned int top = 0;
+
+  if ( Slab( m_Root, o, inv, closest ) == FLT_MAX ) return -1.0f;
+
+  stack[ top++ ] = 0;
+
+  while ( top > 0 )
+  {
+    const Bvh4Node& node = m_Nodes[ stack[ --top ] ];
+    float           t[ 4 ];
+
+    for ( unsigned int lane = 0; lane < 4; lane++ )
+    {
+      float tNear = 0.0f;
+      float tFar  = closest;
+      float t0, t1;
+
+      t0 = ( node.minX[ lane ] - o[ 0 ] ) * inv[ 0 ]; t1 = ( node.maxX[ lane ] - o[ 0 ] ) * inv[ 0 ];
+      tNear = ( t0 < t1 ? t0 : t1 ) > tNear ? ( t0 < t1 ? t0 : t1 ) : tNear;
+      tFar  = ( t0 < t1 ? t1 : t0 ) < tFar  ? ( t0 < t1 ? t1 : t0 ) : tFar;
+
+      t0 = ( node.minY[ lane ] - o[ 1 ] ) * inv[ 1 ]; t1 = ( node.maxY[ lane ] - o[ 1 ] ) * inv[ 1 ];
+      tNear = ( t0 < t1 ? t0 : t1 ) > tNear ? ( t0 < t1 ? t0 : t1 ) : tNear;
+      tFar  = ( t0 < t1 ? t1 : t0 ) < tFar  ? ( t0 < t1 ? t1 : t0 ) : tFar;
+
+      t0 = ( node.minZ[ lane ] - o[ 2 ] ) * inv[ 2 ]; t1 = ( node.maxZ[ lane ] - o[ 2 ] ) * inv[ 2 ];
+      tNear = ( t0 < t1 ? t0 : t1 ) > tNear ? ( t0 < t1 ? t0 : t1 ) : tNear;
+      tFar  = ( t0 < t1 ? t1 : t0 ) < tFar  ? ( t0 < t1 ? t1 : t0 ) : tFar;
+
+      t[ lane ] = tNear <= tFar && node.minX[ lane ] <= node.maxX[ lane ] ? tNear : FLT_MAX;
+    }
+
+    /* push hit lanes far to near, so the nearest child is popped first */
+    unsigned int order[ 4 ] = { 0, 1, 2, 3 };
+
+    for ( unsigned int i = 1; i < 4; i++ )
+      for ( unsigned int j = i; j > 0 && t[ order[ j - 1 ] ] < t[ order[ j ] ]; j-- )
+      {
+        const unsigned int swap = order[ j ];
+        order[ j ]     = order[ j - 1 ];
+        order[ j - 1 ] = swap;
+      }
+
+    for ( unsigned int k = 0; k < 4; k++ )
+    {
+      const unsigned int lane = order[ k ];
+
+      if ( t[ lane ] == FLT_MAX ) continue;
+
+      if ( node.count[ lane ] == 0 )
+      {
+        stack[ top++ ] = node.child[ lane ];
+        continue;
+      }
+
+      for ( unsigned int i = 0; i < node.count[ lane ]; i++ )
+      {
+        const unsigned int index = m_Indices[ node.child[ lane ] + i ];
+        float              d     = Slab( &m_PrimitiveBounds[ index * 6 ], o, inv, closest );
+
+        if ( d == FLT_MAX ) continue;
+        if ( callback ) d = callback->Intersect( index, origin, direction, closest );
+
+        if ( d >= 0.0f && d <= closest )
+        {
+          closest   = d;
+          primitive = index;
+          hit       = true;
+        }
+      }
+    }
+  }
+
+  return hit ? closest : -1.0f;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+Bvh4::Collapse( const Bvh& bvh, const unsigned int nodeIndex )
+{
+  const std::vector< BvhNode >& nodes = bvh.m_Nodes;
+  unsigned int                  lanes[ 4 ];
+  unsigned int                  used = 2;
+
+  lanes[ 0 ] = nodes[ nodeIndex ].first;
+  lanes[ 1 ] = nodes[ nodeIndex ].first + 1;
+
+  /* pull up grandchildren, always opening the largest inner child */
+  while ( used < 4 )
+  {
+    int   largest = -1;
+    float area    = -1.0f;
+
+    for ( unsigned int i = 0; i < used; i++ )
+      if ( nodes[ lanes[ i ] ].count == 0 && HalfArea( nodes[ lanes[ i ] ] ) > area )
+      {
+        largest = i;
+        area    = HalfArea( nodes[ lanes[ i ] ] );
+      }
+
+    if ( largest < 0 ) break;
+
+    const unsigned int open = lanes[ largest ];
+
+    lanes[ largest ] = nodes[ open ].first;
+    lanes[ used++ ]  = nodes[ open ].first + 1;
+  }
+
+  const unsigned int index = m_Nodes.size();
+  Bvh4Node           wide;
+
+  memset( &wide, 0, sizeof( wide ) );
+  m_Nodes.push_back( wide );
+
+  for ( unsigned int lane = 0; lane < 4; lane++ )
+  {
+    Bvh4Node& node = m_Nodes[ index ];
+
+    if ( lane >= used )
+    {
+      node.minX[ lane ] = node.minY[ lane ] = node.minZ[ lane ] =  FLT_MAX;
+      node.maxX[ lane ] = node.maxY[ lane ] = node.maxZ[ lane ] = -FLT_MAX;
+      continue;
+    }
+
+    const BvhNode& child = nodes[ lanes[ lane ] ];
+
+    node.minX[ lane ] = child.min[ 0 ]; node.minY[ lane ] = child.min[ 1 ]; node.minZ[ lane ] = child.min[ 2 ];
+    node.maxX[ lane ] = child.max[ 0 ]; node.maxY[ lane ] = child.max[ 1 ]; node.maxZ[ lane ] = child.max[ 2 ];
+    node.count[ lane ] = child.count;
+
+    if ( child.count > 0 )
+      node.child[ lane ] = child.first;
+    else
+    {
+      const unsigned int wideChild = Collapse( bvh, lanes[ lane ] );
+
+      m_Nodes[ index ].child[ lane ] = wideChild;
+    }
+  }
+
+  return index;
+}
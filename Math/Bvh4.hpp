@@ -0,0 +1,98 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Bvh4.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_BVH4_HPP_
+#define MATH_BVH4_HPP_
+
+#include <vector>
+
+class Aabb3f;
+class Bvh;
+class BvhRayCallback;
+class Vec3f;
+
+/*
+ * Four child boxes as structure of arrays, so one node is tested against a
+ * query in a single pass over 4 lanes. count == 0 marks an inner child
+ * whose node index is child, otherwise child is the offset of the leaf's
+ * primitives in the index array. Unused lanes hold an empty box.
+ */
+struct Bvh4Node
+{
+  float         minX[ 4 ];
+  float         minY[ 4 ];
+  float         minZ[ 4 ];
+  float         maxX[ 4 ];
+  float         maxY[ 4 ];
+  float         maxZ[ 4 ];
+  unsigned int  child[ 4 ];
+  unsigned int  count[ 4 ];
+};
+
+/*
+ * GeekEngine::Bvh4
+ *
+ * Four wide hierarchy collapsed from a binary Bvh, trading a larger node
+ * for half the tree depth and fewer dependent memory loads. Queries behave
+ * like the ones of Bvh.
+ */
+class Bvh4
+{
+public:
+  Bvh4( void );
+  Bvh4( const Bvh4& );
+  Bvh4( const Bvh& );
+  virtual
+  ~Bvh4( void );
+
+  void
+  Build( const Bvh& bvh );
+  void
+  Clear( void );
+
+  unsigned int
+  Nodes( void ) const;
+  const Bvh4Node&
+  Node( const unsigned int node ) const;
+
+  unsigned int
+  Query( const Aabb3f& box, unsigned int* primitives, const unsigned int capacity ) const;
+  unsigned int
+  Query( const Vec3f& center, const float radius, unsigned int* primitives, const unsigned int capacity ) const;
+  float
+  Raycast( const Vec3f& origin, const Vec3f& direction, const float maxDistance,
+           BvhRayCallback* callback, unsigned int& primitive ) const;
+
+protected:
+private:
+  unsigned int
+  Collapse( const Bvh& bvh, const unsigned int node );
+
+  std::vector< Bvh4Node >     m_Nodes;
+  std::vector< unsigned int > m_Indices;
+  std::vector< float >        m_PrimitiveBounds;
+  float                       m_Root[ 6 ];
+
+};
+
+#endif /* MATH_BVH4_HPP_ */
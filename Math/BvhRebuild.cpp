@@ -0,0 +1,261 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file BvhRebuild.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "BvhRebuild.hpp"
+
+#include "Aabb3f.hpp"
+
+#if defined( _WIN32 )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* pending entries are ( node, depth ) pairs */
+#define PENDING_STRIDE 2
+/* primitives handled between two looks at the clock */
+#define REBUILD_CHUNK  1024
+
+enum RebuildStage
+{
+  REBUILD_LOAD,
+  REBUILD_NEXT,
+  REBUILD_MEASURE,
+  REBUILD_BIN,
+  REBUILD_PARTITION,
+  REBUILD_DONE
+};
+
+static double
+Microseconds( void )
+{
+#if defined( _WIN32 )
+  LARGE_INTEGER counter, frequency;
+
+  QueryPerformanceCounter( &counter );
+  QueryPerformanceFrequency( &frequency );
+
+  return counter.QuadPart * 1000000.0 / frequency.QuadPart;
+#else
+  timespec now;
+
+  clock_gettime( CLOCK_MONOTONIC, &now );
+
+  return now.tv_sec * 1000000.0 + now.tv_nsec / 1000.0;
+#endif
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+BvhRebuild::BvhRebuild( void ) :
+  m_Source( NULL ),
+  m_Count( 0 ),
+  m_Stage( REBUILD_DONE ),
+  m_Cursor( 0 ),
+  m_Running( false )
+{
+  return;
+}
+
+BvhRebuild::~BvhRebuild( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+BvhRebuild::Begin( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize )
+{
+  m_Pending.clear();
+  m_Bvh.Reserve( count, maxLeafSize, m_Centroids );
+
+  m_Split.node = 0;
+
+  m_Source  = bounds;
+  m_Count   = count;
+  m_Stage   = REBUILD_LOAD;
+  m_Cursor  = 0;
+  m_Running = count > 0;
+
+  if ( m_Running )
+  {
+    m_Pending.push_back( 0 );
+    m_Pending.push_back( 0 );
+  }
+}
+
+bool
+BvhRebuild::Step( const unsigned int microseconds )
+{
+  if ( !m_Running ) return false;
+
+  const double deadline = Microseconds() + microseconds;
+
+  while ( m_Stage != REBUILD_DONE )
+  {
+    const unsigned int count = m_Stage == REBUILD_LOAD ? m_Count : m_Bvh.m_Nodes[ m_Split.node ].count;
+    const unsigned int end   = count - m_Cursor > REBUILD_CHUNK ? m_Cursor + REBUILD_CHUNK : count;
+
+    switch ( m_Stage )
+    {
+      case REBUILD_LOAD:
+        m_Bvh.Load( m_Source, m_Cursor, end, m_Centroids );
+        m_Cursor = end;
+
+        if ( end == count )
+        {
+          m_Source = NULL;
+          m_Stage  = REBUILD_NEXT;
+        }
+        break;
+
+      case REBUILD_NEXT:
+        if ( m_Pending.empty() )
+          m_Stage = REBUILD_DONE;
+        else
+          Pop();
+        break;
+
+      case REBUILD_MEASURE:
+        m_Bvh.Measure( m_Split, &m_Centroids[ 0 ], m_Cursor, end );
+        m_Cursor = end;
+
+        if ( end < count ) break;
+
+        m_Stage  = m_Bvh.StartBins( m_Split ) ? REBUILD_BIN : REBUILD_NEXT;
+        m_Cursor = 0;
+        break;
+
+      case REBUILD_BIN:
+        m_Bvh.Bin( m_Split, &m_Centroids[ 0 ], m_Cursor, end );
+        m_Cursor = end;
+
+        if ( end < count ) break;
+
+        m_Stage = m_Bvh.Choose( m_Split ) ? REBUILD_PARTITION : REBUILD_NEXT;
+        break;
+
+      case REBUILD_PARTITION:
+        if ( !m_Bvh.Partition( m_Split, &m_Centroids[ 0 ], REBUILD_CHUNK ) ) break;
+
+        m_Bvh.Close( m_Split );
+        Push( m_Split.node, m_Split.depth );
+        m_Stage = REBUILD_NEXT;
+        break;
+    }
+
+    if ( Microseconds() >= deadline ) break;
+  }
+
+  return m_Stage == REBUILD_DONE;
+}
+
+bool
+BvhRebuild::Finish( Bvh& target, const Aabb3f* bounds )
+{
+  if ( !m_Running || m_Stage != REBUILD_DONE ) return false;
+
+  m_Bvh.m_Nodes.resize( m_Bvh.m_NodesUsed );
+
+  if ( bounds )
+    m_Bvh.Refit( bounds );
+  else
+    m_Bvh.m_Cost = m_Bvh.ComputeCost();
+
+  m_Bvh.m_BuildCost = m_Bvh.m_Cost;
+
+  target.Swap( m_Bvh );
+
+  m_Bvh.Clear();
+  m_Centroids.clear();
+  m_Running = false;
+
+  return true;
+}
+
+void
+BvhRebuild::Cancel( void )
+{
+  m_Bvh.Clear();
+  m_Centroids.clear();
+  m_Pending.clear();
+  m_Source  = NULL;
+  m_Stage   = REBUILD_DONE;
+  m_Running = false;
+}
+
+bool
+BvhRebuild::Running( void ) const
+{
+  return m_Running;
+}
+
+bool
+BvhRebuild::Done( void ) const
+{
+  return m_Running && m_Stage == REBUILD_DONE;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+/*
+ * Takes the next pending node. Nodes up to REBUILD_CHUNK primitives are
+ * split right away, larger ones start the staged split.
+ */
+void
+BvhRebuild::Pop( void )
+{
+  const unsigned int depth = m_Pending.back(); m_Pending.pop_back();
+  const unsigned int node  = m_Pending.back(); m_Pending.pop_back();
+
+  if ( m_Bvh.m_Nodes[ node ].count > REBUILD_CHUNK )
+  {
+    m_Bvh.Open( m_Split, node, depth );
+    m_Stage  = REBUILD_MEASURE;
+    m_Cursor = 0;
+  }
+  else if ( m_Bvh.Split( node, &m_Centroids[ 0 ], depth ) )
+    Push( node, depth );
+}
+
+void
+BvhRebuild::Push( const unsigned int node, const unsigned int depth )
+{
+  const unsigned int left = m_Bvh.m_Nodes[ node ].first;
+
+  m_Pending.push_back( left + 1 ); m_Pending.push_back( depth + 1 );
+  m_Pending.push_back( left );     m_Pending.push_back( depth + 1 );
+}
@@ -0,0 +1,90 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file BvhRebuild.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_BVHREBUILD_HPP_
+#define MATH_BVHREBUILD_HPP_
+
+#include "Bvh.hpp"
+
+#include <vector>
+
+class Aabb3f;
+
+/*
+ * GeekEngine::BvhRebuild
+ *
+ * Builds a replacement Bvh in time slices, so dynamic scenes can restore
+ * tree quality without a frame spike. Begin only reserves memory, each
+ * Step copies bounds and splits pending nodes until its time budget is
+ * used up and returns true once the tree is complete. All work, including
+ * the copy and the split of the root, is done in chunks of about a thousand
+ * primitives, so a step overshoots its budget by at most one chunk.
+ *
+ * The bounds passed to Begin are read by the following steps and have to
+ * stay valid until Step returns true. They may change in the meantime:
+ * Finish swaps the new tree into the target and refits it to the bounds
+ * of the current frame anyway.
+ */
+class BvhRebuild
+{
+public:
+  BvhRebuild( void );
+  virtual
+  ~BvhRebuild( void );
+
+  void
+  Begin( const Aabb3f* bounds, const unsigned int count, const unsigned int maxLeafSize = 4 );
+  bool
+  Step( const unsigned int microseconds );
+  bool
+  Finish( Bvh& target, const Aabb3f* bounds );
+  void
+  Cancel( void );
+
+  bool
+  Running( void ) const;
+  bool
+  Done( void ) const;
+
+protected:
+private:
+  BvhRebuild( const BvhRebuild& );
+
+  void
+  Pop( void );
+  void
+  Push( const unsigned int node, const unsigned int depth );
+
+  Bvh                         m_Bvh;
+  std::vector< float >        m_Centroids;
+  std::vector< unsigned int > m_Pending;
+  BvhSplit                    m_Split;
+  const Aabb3f*               m_Source;
+  unsigned int                m_Count;
+  unsigned int                m_Stage;
+  unsigned int                m_Cursor;
+  bool                        m_Running;
+
+};
+
+#endif /* MATH_BVHREBUILD_HPP_ */
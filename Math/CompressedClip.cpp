@@ -0,0 +1,617 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file CompressedClip.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "CompressedClip.hpp"
+
+#include "Quaternion.hpp"
+#include "Vec3f.hpp"
+
+#include <cmath>
+
+#define SMALLEST_THREE_RANGE  0.70710678118654752440f
+#define SMALLEST_THREE_MAX    32767.0f
+#define RANGE_MAX             65535.0f
+#define DECOMPRESS_BLOCK      64
+
+/* ************************************************** */
+/* ************************************************** */
+/* ******************** HELPERS  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+static unsigned short
+Quantize( const float value, const float scale )
+{
+  const float q = floorf( value * scale + 0.5f );
+
+  if ( q < 0.0f )   return 0;
+  if ( q > scale )  return (unsigned short)scale;
+
+  return (unsigned short)q;
+}
+
+/* 2 bits index of the dropped component, then 3 x 15 bits */
+static void
+EncodeRotation( const float* q, unsigned short* out )
+{
+  unsigned int largest = 0;
+
+  for ( unsigned int i = 1; i < 4; i++ )
+    if ( fabsf( q[ i ] ) > fabsf( q[ largest ] ) )
+      largest = i;
+
+  const float    sign = q[ largest ] < 0.0f ? -1.0f : 1.0f;
+  unsigned short c[ 3 ];
+
+  for ( unsigned int i = 0, n = 0; i < 4; i++ )
+  {
+    if ( i == largest ) continue;
+
+    const float v = ( q[ i ] * sign + SMALLEST_THREE_RANGE ) / ( 2.0f * SMALLEST_THREE_RANGE );
+
+    c[ n++ ] = Quantize( v, SMALLEST_THREE_MAX );
+  }
+
+  out[ 0 ] = (unsigned short)( ( largest << 14 ) | ( c[ 0 ] >> 1 ) );
+  out[ 1 ] = (unsigned short)( ( ( c[ 0 ] & 1 ) << 15 ) | c[ 1 ] );
+  out[ 2 ] = c[ 2 ];
+}
+
+static float
+DequantizeSmallest( const unsigned int value )
+{
+  return value * ( 2.0f * SMALLEST_THREE_RANGE / SMALLEST_THREE_MAX ) - SMALLEST_THREE_RANGE;
+}
+
+static void
+DecodeRotation( const unsigned short* in, float* q )
+{
+  const unsigned int largest = in[ 0 ] >> 14;
+  const float        a       = DequantizeSmallest( ( ( in[ 0 ] & 0x3FFF ) << 1 ) | ( in[ 1 ] >> 15 ) );
+  const float        b       = DequantizeSmallest( in[ 1 ] & 0x7FFF );
+  const float        c       = DequantizeSmallest( in[ 2 ] & 0x7FFF );
+  const float        dSq     = 1.0f - a * a - b * b - c * c;
+  const float        d       = dSq > 0.0f ? sqrtf( dSq ) : 0.0f;
+
+  q[ 0 ] = largest == 0 ? d : a;
+  q[ 1 ] = largest == 0 ? a : ( largest == 1 ? d : b );
+  q[ 2 ] = largest <= 1 ? b : ( largest == 2 ? d : c );
+  q[ 3 ] = largest == 3 ? d : c;
+}
+
+static void
+NLerp( const float* a, const float* b, const float t, float* out )
+{
+  const float dot  = a[ 0 ] * b[ 0 ] + a[ 1 ] * b[ 1 ] + a[ 2 ] * b[ 2 ] + a[ 3 ] * b[ 3 ];
+  const float sign = dot < 0.0f ? -t : t;
+  float       lengthSq = 0.0f;
+
+  for ( unsigned int i = 0; i < 4; i++ )
+  {
+    out[ i ]  = a[ i ] * ( 1.0f - t ) + b[ i ] * sign;
+    lengthSq += out[ i ] * out[ i ];
+  }
+
+  const float invLength = lengthSq > 0.0f ? 1.0f / sqrtf( lengthSq ) : 0.0f;
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    out[ i ] *= invLength;
+}
+
+/*
+ * Greedy error bounded key reduction. decoded holds the quantized value of
+ * every frame, original the source values; keys end up with the first and
+ * last frame plus every frame needed to keep interpolation within error.
+ */
+static bool
+SpanWithinError( const std::vector< float >& decoded, const std::vector< float >& original,
+                 const unsigned int components, const unsigned int first, const unsigned int last,
+                 const float error )
+{
+  const float* a = &decoded[ first * components ];
+  const float* b = &decoded[ last  * components ];
+
+  for ( unsigned int k = first + 1; k < last; k++ )
+  {
+    const float  t = (float)( k - first ) / (float)( last - first );
+    const float* o = &original[ k * components ];
+
+    if ( components == 4 )
+    {
+      float q[ 4 ];
+
+      NLerp( a, b, t, q );
+
+      /* error is the rotation angle between both, compared via cos( angle / 2 ) */
+      const float dot = fabsf( q[ 0 ] * o[ 0 ] + q[ 1 ] * o[ 1 ] + q[ 2 ] * o[ 2 ] + q[ 3 ] * o[ 3 ] );
+
+      if ( dot < cosf( error * 0.5f ) ) return false;
+    }
+    else
+    {
+      for ( unsigned int i = 0; i < components; i++ )
+        if ( fabsf( a[ i ] + ( b[ i ] - a[ i ] ) * t - o[ i ] ) > error )
+          return false;
+    }
+  }
+
+  return true;
+}
+
+static void
+ReduceKeys( const std::vector< float >& decoded, const std::vector< float >& original,
+            const unsigned int components, const unsigned int frames, const float error,
+            std::vector< unsigned short >& keys )
+{
+  unsigned int first = 0;
+
+  keys.push_back( 0 );
+
+  while ( first + 1 < frames )
+  {
+    unsigned int last = first + 1;
+
+    while ( last + 1 < frames &&
+            SpanWithinError( decoded, original, components, first, last + 1, error ) )
+      last++;
+
+    keys.push_back( (unsigned short)last );
+    first = last;
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+CompressedClip::CompressedClip( void ) :
+  m_Joints( 0 ),
+  m_Frames( 0 ),
+  m_FrameRate( 0.0f )
+{
+  return;
+}
+
+CompressedClip::CompressedClip( const CompressedClip& other ) :
+  m_Joints( other.m_Joints ),
+  m_Frames( other.m_Frames ),
+  m_FrameRate( other.m_FrameRate ),
+  m_RotationStart( other.m_RotationStart ),
+  m_RotationFrames( other.m_RotationFrames ),
+  m_RotationData( other.m_RotationData ),
+  m_TranslationRange( other.m_TranslationRange ),
+  m_TranslationStart( other.m_TranslationStart ),
+  m_TranslationFrames( other.m_TranslationFrames ),
+  m_TranslationData( other.m_TranslationData ),
+  m_ScaleRange( other.m_ScaleRange ),
+  m_ScaleStart( other.m_ScaleStart ),
+  m_ScaleFrames( other.m_ScaleFrames ),
+  m_ScaleData( other.m_ScaleData )
+{
+  return;
+}
+
+CompressedClip::~CompressedClip( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+CompressedClip::Compress( const Quaternion* rotations, const Vec3f* translations, const Vec3f* scales,
+                          const unsigned int joints, const unsigned int frames, const float frameRate,
+                          const float rotationError, const float translationError, const float scaleError )
+{
+  Clear();
+
+  if ( joints == 0 || frames == 0 || frames > 65536 ) return;
+
+  m_Joints    = joints;
+  m_Frames    = frames;
+  m_FrameRate = frameRate;
+
+  std::vector< float >          original( frames * 4 );
+  std::vector< float >          decoded( frames * 4 );
+  std::vector< unsigned short > quantized( frames * 3 );
+  std::vector< unsigned short > keys;
+
+  m_RotationStart.push_back( 0 );
+  m_TranslationStart.push_back( 0 );
+  m_ScaleStart.push_back( 0 );
+
+  for ( unsigned int joint = 0; joint < joints; joint++ )
+  {
+    /* rotations */
+    for ( unsigned int frame = 0; frame < frames; frame++ )
+    {
+      const Quaternion q = rotations ? rotations[ frame * joints + joint ].Normalize() : Quaternion();
+      float*           o = &original[ frame * 4 ];
+
+      o[ 0 ] = q.X(); o[ 1 ] = q.Y(); o[ 2 ] = q.Z(); o[ 3 ] = q.W();
+
+      EncodeRotation( o, &quantized[ frame * 3 ] );
+      DecodeRotation( &quantized[ frame * 3 ], &decoded[ frame * 4 ] );
+    }
+
+    keys.clear();
+    ReduceKeys( decoded, original, 4, frames, rotationError, keys );
+
+    for ( unsigned int k = 0; k < keys.size(); k++ )
+    {
+      m_RotationFrames.push_back( keys[ k ] );
+      m_RotationData.push_back( quantized[ keys[ k ] * 3 + 0 ] );
+      m_RotationData.push_back( quantized[ keys[ k ] * 3 + 1 ] );
+      m_RotationData.push_back( quantized[ keys[ k ] * 3 + 2 ] );
+    }
+
+    m_RotationStart.push_back( m_RotationFrames.size() );
+
+    /* translations and scales */
+    for ( unsigned int channel = 0; channel < 2; channel++ )
+    {
+      const Vec3f*                   source = channel == 0 ? translations : scales;
+      const float                    error  = channel == 0 ? translationError : scaleError;
+      const float                    fill   = channel == 0 ? 0.0f : 1.0f;
+      std::vector< float >&          range  = channel == 0 ? m_TranslationRange  : m_ScaleRange;
+      std::vector< unsigned int >&   start  = channel == 0 ? m_TranslationStart  : m_ScaleStart;
+      std::vector< unsigned short >& times  = channel == 0 ? m_TranslationFrames : m_ScaleFrames;
+      std::vector< unsigned short >& data   = channel == 0 ? m_TranslationData   : m_ScaleData;
+      float                          minimum[ 3 ] = { fill, fill, fill };
+      float                          extent[ 3 ]  = { 0.0f, 0.0f, 0.0f };
+
+      for ( unsigned int frame = 0; frame < frames; frame++ )
+        for ( unsigned int i = 0; i < 3; i++ )
+          original[ frame * 3 + i ] = source ? source[ frame * joints + joint ][ i ] : fill;
+
+      for ( unsigned int i = 0; i < 3; i++ )
+      {
+        float maximum = minimum[ i ] = original[ i ];
+
+        for ( unsigned int frame = 1; frame < frames; frame++ )
+        {
+          const float v = original[ frame * 3 + i ];
+
+          if ( v < minimum[ i ] ) minimum[ i ] = v;
+          if ( v > maximum )      maximum      = v;
+        }
+
+        extent[ i ] = maximum - minimum[ i ];
+
+        range.push_back( minimum[ i ] );
+      }
+
+      for ( unsigned int i = 0; i < 3; i++ )
+        range.push_back( extent[ i ] );
+
+      for ( unsigned int frame = 0; frame < frames; frame++ )
+        for ( unsigned int i = 0; i < 3; i++ )
+        {
+          const unsigned int index = frame * 3 + i;
+          const float        t     = extent[ i ] > 0.0f ? ( original[ index ] - minimum[ i ] ) / extent[ i ] : 0.0f;
+
+          quantized[ index ] = Quantize( t, RANGE_MAX );
+          decoded[ index ]   = minimum[ i ] + quantized[ index ] * ( extent[ i ] / RANGE_MAX );
+        }
+
+      keys.clear();
+      ReduceKeys( decoded, original, 3, frames, error, keys );
+
+      for ( unsigned int k = 0; k < keys.size(); k++ )
+      {
+        times.push_back( keys[ k ] );
+        data.push_back( quantized[ keys[ k ] * 3 + 0 ] );
+        data.push_back( quantized[ keys[ k ] * 3 + 1 ] );
+        data.push_back( quantized[ keys[ k ] * 3 + 2 ] );
+      }
+
+      start.push_back( times.size() );
+    }
+  }
+}
+
+void
+CompressedClip::Clear( void )
+{
+  m_Joints    = 0;
+  m_Frames    = 0;
+  m_FrameRate = 0.0f;
+
+  m_RotationStart.clear();
+  m_RotationFrames.clear();
+  m_RotationData.clear();
+
+  m_TranslationRange.clear();
+  m_TranslationStart.clear();
+  m_TranslationFrames.clear();
+  m_TranslationData.clear();
+
+  m_ScaleRange.clear();
+  m_ScaleStart.clear();
+  m_ScaleFrames.clear();
+  m_ScaleData.clear();
+}
+
+unsigned int
+CompressedClip::Joints( void ) const
+{
+  return m_Joints;
+}
+
+unsigned int
+CompressedClip::Frames( void ) const
+{
+  return m_Frames;
+}
+
+float
+CompressedClip::FrameRate( void ) const
+{
+  return m_FrameRate;
+}
+
+float
+CompressedClip::Duration( void ) const
+{
+  if ( m_Frames < 2 || m_FrameRate <= 0.0f ) return 0.0f;
+
+  return ( m_Frames - 1 ) / m_FrameRate;
+}
+
+unsigned int
+CompressedClip::Size( void ) const
+{
+  const unsigned int keys   = m_RotationFrames.size() + m_TranslationFrames.size() + m_ScaleFrames.size();
+  const unsigned int starts = m_RotationStart.size() + m_TranslationStart.size() + m_ScaleStart.size();
+  const unsigned int ranges = m_TranslationRange.size() + m_ScaleRange.size();
+
+  return keys * sizeof( unsigned short ) * 4 +
+         starts * sizeof( unsigned int ) +
+         ranges * sizeof( float );
+}
+
+Quaternion
+CompressedClip::Rotation( const unsigned int joint, const unsigned int frame ) const
+{
+  unsigned int key0, key1;
+  float        factor;
+  float        a[ 4 ], b[ 4 ], q[ 4 ];
+
+  FindKeys( m_RotationStart, m_RotationFrames, joint, (float)frame, key0, key1, factor );
+
+  DecodeRotation( &m_RotationData[ key0 * 3 ], a );
+  DecodeRotation( &m_RotationData[ key1 * 3 ], b );
+  NLerp( a, b, factor, q );
+
+  return Quaternion( q[ 0 ], q[ 1 ], q[ 2 ], q[ 3 ] );
+}
+
+Vec3f
+CompressedClip::Translation( const unsigned int joint, const unsigned int frame ) const
+{
+  unsigned int key0, key1;
+  float        factor;
+  float        v[ 3 ];
+
+  FindKeys( m_TranslationStart, m_TranslationFrames, joint, (float)frame, key0, key1, factor );
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    const float step = m_TranslationRange[ joint * 6 + 3 + i ] / RANGE_MAX;
+    const float a    = m_TranslationData[ key0 * 3 + i ] * step;
+    const float b    = m_TranslationData[ key1 * 3 + i ] * step;
+
+    v[ i ] = m_TranslationRange[ joint * 6 + i ] + a + ( b - a ) * factor;
+  }
+
+  return Vec3f( v[ 0 ], v[ 1 ], v[ 2 ] );
+}
+
+Vec3f
+CompressedClip::Scale( const unsigned int joint, const unsigned int frame ) const
+{
+  unsigned int key0, key1;
+  float        factor;
+  float        v[ 3 ];
+
+  FindKeys( m_ScaleStart, m_ScaleFrames, joint, (float)frame, key0, key1, factor );
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    const float step = m_ScaleRange[ joint * 6 + 3 + i ] / RANGE_MAX;
+    const float a    = m_ScaleData[ key0 * 3 + i ] * step;
+    const float b    = m_ScaleData[ key1 * 3 + i ] * step;
+
+    v[ i ] = m_ScaleRange[ joint * 6 + i ] + a + ( b - a ) * factor;
+  }
+
+  return Vec3f( v[ 0 ], v[ 1 ], v[ 2 ] );
+}
+
+void
+CompressedClip::Decompress( const float time, float* rotations, float* translations, float* scales ) const
+{
+  if ( m_Joints == 0 ) return;
+
+  float frame = time * m_FrameRate;
+
+  if ( frame < 0.0f )                   frame = 0.0f;
+  if ( frame > (float)( m_Frames - 1 ) ) frame = (float)( m_Frames - 1 );
+
+  if ( rotations )
+    DecompressRotations( frame, rotations );
+  if ( translations )
+    DecompressVectors( frame, m_TranslationStart, m_TranslationFrames, m_TranslationData,
+                       m_TranslationRange, translations );
+  if ( scales )
+    DecompressVectors( frame, m_ScaleStart, m_ScaleFrames, m_ScaleData,
+                       m_ScaleRange, scales );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+CompressedClip::FindKeys( const std::vector< unsigned int >& start, const std::vector< unsigned short >& frames,
+                          const unsigned int joint, const float frame,
+                          unsigned int& key0, unsigned int& key1, float& factor ) const
+{
+  unsigned int low  = start[ joint ];
+  unsigned int high = start[ joint + 1 ] - 1;
+
+  if ( low == high || frame <= frames[ low ] )
+  {
+    key0 = key1 = low;
+    factor = 0.0f;
+    return;
+  }
+
+  if ( frame >= frames[ high ] )
+  {
+    key0 = key1 = high;
+    factor = 0.0f;
+    return;
+  }
+
+  /* invariant: frames[ low ] <= frame < frames[ high ] */
+  while ( high - low > 1 )
+  {
+    const unsigned int mid = ( low + high ) / 2;
+
+    if ( frames[ mid ] <= frame ) low  = mid;
+    else                          high = mid;
+  }
+
+  key0   = low;
+  key1   = high;
+  factor = ( frame - frames[ low ] ) / (float)( frames[ high ] - frames[ low ] );
+}
+
+/*
+ * Decompression runs in blocks of joints: the key lookup gathers both keys
+ * of every joint into small local arrays first, the dequantization and
+ * interpolation then run as straight loops over the block, which the
+ * compiler turns into vector code.
+ */
+void
+CompressedClip::DecompressRotations( const float frame, float* rotations ) const
+{
+  float* outX = rotations;
+  float* outY = rotations + m_Joints;
+  float* outZ = rotations + m_Joints * 2;
+  float* outW = rotations + m_Joints * 3;
+
+  for ( unsigned int base = 0; base < m_Joints; base += DECOMPRESS_BLOCK )
+  {
+    const unsigned int count = m_Joints - base < DECOMPRESS_BLOCK ? m_Joints - base : DECOMPRESS_BLOCK;
+
+    float a[ 4 ][ DECOMPRESS_BLOCK ];
+    float b[ 4 ][ DECOMPRESS_BLOCK ];
+    float t[ DECOMPRESS_BLOCK ];
+
+    for ( unsigned int i = 0; i < count; i++ )
+    {
+      unsigned int key0, key1;
+      float        qa[ 4 ], qb[ 4 ];
+
+      FindKeys( m_RotationStart, m_RotationFrames, base + i, frame, key0, key1, t[ i ] );
+
+      DecodeRotation( &m_RotationData[ key0 * 3 ], qa );
+      DecodeRotation( &m_RotationData[ key1 * 3 ], qb );
+
+      for ( unsigned int c = 0; c < 4; c++ )
+      {
+        a[ c ][ i ] = qa[ c ];
+        b[ c ][ i ] = qb[ c ];
+      }
+    }
+
+    for ( unsigned int i = 0; i < count; i++ )
+    {
+      const float dot  = a[ 0 ][ i ] * b[ 0 ][ i ] + a[ 1 ][ i ] * b[ 1 ][ i ] +
+                         a[ 2 ][ i ] * b[ 2 ][ i ] + a[ 3 ][ i ] * b[ 3 ][ i ];
+      const float src  = 1.0f - t[ i ];
+      const float dest = dot < 0.0f ? -t[ i ] : t[ i ];
+      const float x    = a[ 0 ][ i ] * src + b[ 0 ][ i ] * dest;
+      const float y    = a[ 1 ][ i ] * src + b[ 1 ][ i ] * dest;
+      const float z    = a[ 2 ][ i ] * src + b[ 2 ][ i ] * dest;
+      const float w    = a[ 3 ][ i ] * src + b[ 3 ][ i ] * dest;
+      const float inv  = 1.0f / sqrtf( x * x + y * y + z * z + w * w );
+
+      outX[ base + i ] = x * inv;
+      outY[ base + i ] = y * inv;
+      outZ[ base + i ] = z * inv;
+      outW[ base + i ] = w * inv;
+    }
+  }
+}
+
+void
+CompressedClip::DecompressVectors( const float frame, const std::vector< unsigned int >& start,
+                                   const std::vector< unsigned short >& frames, const std::vector< unsigned short >& data,
+                                   const std::vector< float >& range, float* vectors ) const
+{
+  for ( unsigned int base = 0; base < m_Joints; base += DECOMPRESS_BLOCK )
+  {
+    const unsigned int count = m_Joints - base < DECOMPRESS_BLOCK ? m_Joints - base : DECOMPRESS_BLOCK;
+
+    float a[ 3 ][ DECOMPRESS_BLOCK ];
+    float b[ 3 ][ DECOMPRESS_BLOCK ];
+    float minimum[ 3 ][ DECOMPRESS_BLOCK ];
+    float step[ 3 ][ DECOMPRESS_BLOCK ];
+    float t[ DECOMPRESS_BLOCK ];
+
+    for ( unsigned int i = 0; i < count; i++ )
+    {
+      const unsigned int joint = base + i;
+      unsigned int       key0, key1;
+
+      FindKeys( start, frames, joint, frame, key0, key1, t[ i ] );
+
+      for ( unsigned int c = 0; c < 3; c++ )
+      {
+        a[ c ][ i ]       = data[ key0 * 3 + c ];
+        b[ c ][ i ]       = data[ key1 * 3 + c ];
+        minimum[ c ][ i ] = range[ joint * 6 + c ];
+        step[ c ][ i ]    = range[ joint * 6 + 3 + c ];
+      }
+    }
+
+    for ( unsigned int c = 0; c < 3; c++ )
+    {
+      float* out = vectors + m_Joints * c + base;
+
+      for ( unsigned int i = 0; i < count; i++ )
+        out[ i ] = minimum[ c ][ i ] +
+                   ( a[ c ][ i ] + ( b[ c ][ i ] - a[ c ][ i ] ) * t[ i ] ) * ( step[ c ][ i ] / RANGE_MAX );
+    }
+  }
+}
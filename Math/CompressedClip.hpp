@@ -0,0 +1,125 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file CompressedClip.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_COMPRESSEDCLIP_HPP_
+#define MATH_COMPRESSEDCLIP_HPP_
+
+#include <vector>
+
+class Quaternion;
+class Vec3f;
+
+/*
+ * GeekEngine::CompressedClip
+ *
+ * Uniformly sampled joint animation (rotation, translation and scale per
+ * joint and frame) stored in compressed form:
+ *  - rotations use smallest-three quantization in 48 bits per key,
+ *  - translations and scales are quantized to 16 bits per component
+ *    against the range of each joint,
+ *  - every channel of every joint only keeps the keys needed to stay within
+ *    the requested error of the quantized values when linearly
+ *    interpolated. Rotation error is an angle in radians, translation and
+ *    scale error an absolute per component distance.
+ *
+ * Clips are limited to 65536 frames.
+ *
+ * Source data is laid out frame major, element [ frame * joints + joint ].
+ * Any of rotations, translations and scales may be NULL; missing channels
+ * are filled with the identity rotation, zero translation and unit scale.
+ * Decompressed poses are written as structure of arrays: rotations take
+ * 4 * joints floats ( all x, then all y, z and w ), translations and scales
+ * 3 * joints floats each.
+ */
+class CompressedClip
+{
+public:
+  CompressedClip( void );
+  CompressedClip( const CompressedClip& );
+  virtual
+  ~CompressedClip( void );
+
+  void
+  Compress( const Quaternion* rotations, const Vec3f* translations, const Vec3f* scales,
+            const unsigned int joints, const unsigned int frames, const float frameRate,
+            const float rotationError = 0.001f,
+            const float translationError = 0.0001f,
+            const float scaleError = 0.0001f );
+  void
+  Clear( void );
+
+  unsigned int
+  Joints( void ) const;
+  unsigned int
+  Frames( void ) const;
+  float
+  FrameRate( void ) const;
+  float
+  Duration( void ) const;
+  unsigned int
+  Size( void ) const;
+
+  Quaternion
+  Rotation( const unsigned int joint, const unsigned int frame ) const;
+  Vec3f
+  Translation( const unsigned int joint, const unsigned int frame ) const;
+  Vec3f
+  Scale( const unsigned int joint, const unsigned int frame ) const;
+
+  void
+  Decompress( const float time, float* rotations, float* translations, float* scales ) const;
+
+protected:
+private:
+  void
+  FindKeys( const std::vector< unsigned int >& start, const std::vector< unsigned short >& frames,
+            const unsigned int joint, const float frame,
+            unsigned int& key0, unsigned int& key1, float& factor ) const;
+  void
+  DecompressRotations( const float frame, float* rotations ) const;
+  void
+  DecompressVectors( const float frame, const std::vector< unsigned int >& start,
+                     const std::vector< unsigned short >& frames, const std::vector< unsigned short >& data,
+                     const std::vector< float >& range, float* vectors ) const;
+
+  unsigned int                  m_Joints;
+  unsigned int                  m_Frames;
+  float                         m_FrameRate;
+
+  std::vector< unsigned int >   m_RotationStart;
+  std::vector< unsigned short > m_RotationFrames;
+  std::vector< unsigned short > m_RotationData;
+
+  std::vector< float >          m_TranslationRange;
+  std::vector< unsigned int >   m_TranslationStart;
+  std::vector< unsigned short > m_TranslationFrames;
+  std::vector< unsigned short > m_TranslationData;
+
+  std::vector< float >          m_ScaleRange;
+  std::vector< unsigned int >   m_ScaleStart;
+  std::vector< unsigned short > m_ScaleFrames;
+  std::vector< unsigned short > m_ScaleData;
+
+};
+
+#endif /* MATH_COMPRESSEDCLIP_HPP_ */
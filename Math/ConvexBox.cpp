@@ -0,0 +1,88 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexBox.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ConvexBox.hpp"
+
+#include "Vec3f.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ConvexBox::ConvexBox( void )
+{
+  m_HalfExtents[ 0 ] = m_HalfExtents[ 1 ] = m_HalfExtents[ 2 ] = 0.5f;
+}
+
+ConvexBox::ConvexBox( const ConvexBox& other ) :
+  ConvexShape( other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_HalfExtents[ i ] = other.m_HalfExtents[ i ];
+}
+
+ConvexBox::ConvexBox( const Vec3f& halfExtents )
+{
+  HalfExtents( halfExtents );
+}
+
+ConvexBox::~ConvexBox( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+ConvexBox::HalfExtents( const Vec3f& halfExtents )
+{
+  m_HalfExtents[ 0 ] = halfExtents.X();
+  m_HalfExtents[ 1 ] = halfExtents.Y();
+  m_HalfExtents[ 2 ] = halfExtents.Z();
+}
+
+Vec3f
+ConvexBox::HalfExtents( void ) const
+{
+  return Vec3f( m_HalfExtents[ 0 ], m_HalfExtents[ 1 ], m_HalfExtents[ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+Vec3f
+ConvexBox::LocalSupport( const Vec3f& direction ) const
+{
+  return Vec3f( direction.X() < 0.0f ? -m_HalfExtents[ 0 ] : m_HalfExtents[ 0 ],
+                direction.Y() < 0.0f ? -m_HalfExtents[ 1 ] : m_HalfExtents[ 1 ],
+                direction.Z() < 0.0f ? -m_HalfExtents[ 2 ] : m_HalfExtents[ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,57 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexBox.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_CONVEXBOX_HPP_
+#define MATH_CONVEXBOX_HPP_
+
+#include "ConvexShape.hpp"
+
+/*
+ * GeekEngine::ConvexBox
+ *
+ * Box centered at the local origin, given by its half extents.
+ */
+class ConvexBox : public ConvexShape
+{
+public:
+  ConvexBox( void );
+  ConvexBox( const ConvexBox& );
+  ConvexBox( const Vec3f& halfExtents );
+  virtual
+  ~ConvexBox( void );
+
+  void
+  HalfExtents( const Vec3f& halfExtents );
+  Vec3f
+  HalfExtents( void ) const;
+
+protected:
+  virtual Vec3f
+  LocalSupport( const Vec3f& direction ) const;
+
+private:
+  float m_HalfExtents[ 3 ];
+
+};
+
+#endif /* MATH_CONVEXBOX_HPP_ */
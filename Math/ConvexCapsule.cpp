@@ -0,0 +1,101 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexCapsule.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ConvexCapsule.hpp"
+
+#include "Vec3f.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ConvexCapsule::ConvexCapsule( const float radius, const float halfHeight ) :
+  m_Radius( radius ),
+  m_HalfHeight( halfHeight )
+{
+  return;
+}
+
+ConvexCapsule::ConvexCapsule( const ConvexCapsule& other ) :
+  ConvexShape( other ),
+  m_Radius( other.m_Radius ),
+  m_HalfHeight( other.m_HalfHeight )
+{
+  return;
+}
+
+ConvexCapsule::~ConvexCapsule( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+ConvexCapsule::Radius( const float radius )
+{
+  m_Radius = radius;
+}
+
+float
+ConvexCapsule::Radius( void ) const
+{
+  return m_Radius;
+}
+
+void
+ConvexCapsule::HalfHeight( const float halfHeight )
+{
+  m_HalfHeight = halfHeight;
+}
+
+float
+ConvexCapsule::HalfHeight( void ) const
+{
+  return m_HalfHeight;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+Vec3f
+ConvexCapsule::LocalSupport( const Vec3f& direction ) const
+{
+  const float length = direction.Length();
+  const float end    = direction.Y() < 0.0f ? -m_HalfHeight : m_HalfHeight;
+
+  if ( length <= 0.0f ) return Vec3f( m_Radius, end, 0.0f );
+
+  const float scale = m_Radius / length;
+
+  return Vec3f( direction.X() * scale, end + direction.Y() * scale, direction.Z() * scale );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,62 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexCapsule.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_CONVEXCAPSULE_HPP_
+#define MATH_CONVEXCAPSULE_HPP_
+
+#include "ConvexShape.hpp"
+
+/*
+ * GeekEngine::ConvexCapsule
+ *
+ * Capsule around the local y axis, a segment from -halfHeight to halfHeight
+ * swept by a sphere of radius.
+ */
+class ConvexCapsule : public ConvexShape
+{
+public:
+  ConvexCapsule( const float radius = 0.5f, const float halfHeight = 0.5f );
+  ConvexCapsule( const ConvexCapsule& );
+  virtual
+  ~ConvexCapsule( void );
+
+  void
+  Radius( const float radius );
+  float
+  Radius( void ) const;
+  void
+  HalfHeight( const float halfHeight );
+  float
+  HalfHeight( void ) const;
+
+protected:
+  virtual Vec3f
+  LocalSupport( const Vec3f& direction ) const;
+
+private:
+  float m_Radius;
+  float m_HalfHeight;
+
+};
+
+#endif /* MATH_CONVEXCAPSULE_HPP_ */
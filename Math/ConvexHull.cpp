@@ -0,0 +1,117 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexHull.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ConvexHull.hpp"
+
+#include "Vec3f.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ConvexHull::ConvexHull( void ) { return; }
+
+ConvexHull::ConvexHull( const ConvexHull& other ) :
+  ConvexShape( other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Points[ i ] = other.m_Points[ i ];
+}
+
+ConvexHull::ConvexHull( const Vec3f* points, const unsigned int count )
+{
+  Set( points, count );
+}
+
+ConvexHull::~ConvexHull( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+ConvexHull::Set( const Vec3f* points, const unsigned int count )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Points[ i ].resize( count );
+
+  for ( unsigned int p = 0; p < count; p++ )
+  {
+    m_Points[ 0 ][ p ] = points[ p ].X();
+    m_Points[ 1 ][ p ] = points[ p ].Y();
+    m_Points[ 2 ][ p ] = points[ p ].Z();
+  }
+}
+
+unsigned int
+ConvexHull::Points( void ) const
+{
+  return m_Points[ 0 ].size();
+}
+
+Vec3f
+ConvexHull::Point( const unsigned int point ) const
+{
+  return Vec3f( m_Points[ 0 ][ point ], m_Points[ 1 ][ point ], m_Points[ 2 ][ point ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+Vec3f
+ConvexHull::LocalSupport( const Vec3f& direction ) const
+{
+  const unsigned int count = m_Points[ 0 ].size();
+
+  if ( count == 0 ) return Vec3f( 0.0f, 0.0f, 0.0f );
+
+  const float* x       = &m_Points[ 0 ][ 0 ];
+  const float* y       = &m_Points[ 1 ][ 0 ];
+  const float* z       = &m_Points[ 2 ][ 0 ];
+  const float  dx      = direction.X(), dy = direction.Y(), dz = direction.Z();
+  unsigned int best    = 0;
+  float        bestDot = x[ 0 ] * dx + y[ 0 ] * dy + z[ 0 ] * dz;
+
+  for ( unsigned int i = 1; i < count; i++ )
+  {
+    const float dot = x[ i ] * dx + y[ i ] * dy + z[ i ] * dz;
+
+    if ( dot > bestDot )
+    {
+      bestDot = dot;
+      best    = i;
+    }
+  }
+
+  return Vec3f( x[ best ], y[ best ], z[ best ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,63 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexHull.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_CONVEXHULL_HPP_
+#define MATH_CONVEXHULL_HPP_
+
+#include "ConvexShape.hpp"
+
+#include <vector>
+
+/*
+ * GeekEngine::ConvexHull
+ *
+ * Convex hull of a point cloud. The points are copied into structure of
+ * arrays and the support is a linear scan for the largest dot product, so
+ * interior points only cost time; hulls should be reduced beforehand.
+ */
+class ConvexHull : public ConvexShape
+{
+public:
+  ConvexHull( void );
+  ConvexHull( const ConvexHull& );
+  ConvexHull( const Vec3f* points, const unsigned int count );
+  virtual
+  ~ConvexHull( void );
+
+  void
+  Set( const Vec3f* points, const unsigned int count );
+  unsigned int
+  Points( void ) const;
+  Vec3f
+  Point( const unsigned int point ) const;
+
+protected:
+  virtual Vec3f
+  LocalSupport( const Vec3f& direction ) const;
+
+private:
+  std::vector< float > m_Points[ 3 ];
+
+};
+
+#endif /* MATH_CONVEXHULL_HPP_ */
@@ -0,0 +1,130 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexShape.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ConvexShape.hpp"
+
+#include "Vec3f.hpp"
+#include "Mat4f.hpp"
+#include "Quaternion.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ConvexShape::ConvexShape( void )
+{
+  for ( unsigned int r = 0; r < 3; r++ )
+  {
+    for ( unsigned int c = 0; c < 3; c++ )
+      m_Linear[ r ][ c ] = r == c ? 1.0f : 0.0f;
+
+    m_Translation[ r ] = 0.0f;
+  }
+}
+
+ConvexShape::ConvexShape( const ConvexShape& other )
+{
+  for ( unsigned int r = 0; r < 3; r++ )
+  {
+    for ( unsigned int c = 0; c < 3; c++ )
+      m_Linear[ r ][ c ] = other.m_Linear[ r ][ c ];
+
+    m_Translation[ r ] = other.m_Translation[ r ];
+  }
+}
+
+ConvexShape::~ConvexShape( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+ConvexShape::Transform( const Mat4f& transform )
+{
+  for ( unsigned int r = 0; r < 3; r++ )
+  {
+    for ( unsigned int c = 0; c < 3; c++ )
+      m_Linear[ r ][ c ] = transform[ r ][ c ];
+
+    m_Translation[ r ] = transform[ r ][ 3 ];
+  }
+}
+
+void
+ConvexShape::Transform( const Quaternion& rotation, const Vec3f& translation )
+{
+  const float x = rotation.X(), y = rotation.Y(), z = rotation.Z(), w = rotation.W();
+
+  m_Linear[ 0 ][ 0 ] = 1.0f - 2.0f * ( y * y + z * z );
+  m_Linear[ 0 ][ 1 ] =        2.0f * ( x * y - w * z );
+  m_Linear[ 0 ][ 2 ] =        2.0f * ( x * z + w * y );
+  m_Linear[ 1 ][ 0 ] =        2.0f * ( x * y + w * z );
+  m_Linear[ 1 ][ 1 ] = 1.0f - 2.0f * ( x * x + z * z );
+  m_Linear[ 1 ][ 2 ] =        2.0f * ( y * z - w * x );
+  m_Linear[ 2 ][ 0 ] =        2.0f * ( x * z - w * y );
+  m_Linear[ 2 ][ 1 ] =        2.0f * ( y * z + w * x );
+  m_Linear[ 2 ][ 2 ] = 1.0f - 2.0f * ( x * x + y * y );
+
+  m_Translation[ 0 ] = translation.X();
+  m_Translation[ 1 ] = translation.Y();
+  m_Translation[ 2 ] = translation.Z();
+}
+
+Vec3f
+ConvexShape::Support( const Vec3f& direction ) const
+{
+  const float d[ 3 ] = { direction.X(), direction.Y(), direction.Z() };
+  float       l[ 3 ], result[ 3 ];
+
+  for ( unsigned int c = 0; c < 3; c++ )
+    l[ c ] = m_Linear[ 0 ][ c ] * d[ 0 ] + m_Linear[ 1 ][ c ] * d[ 1 ] + m_Linear[ 2 ][ c ] * d[ 2 ];
+
+  const Vec3f local = LocalSupport( Vec3f( l[ 0 ], l[ 1 ], l[ 2 ] ) );
+
+  for ( unsigned int r = 0; r < 3; r++ )
+    result[ r ] = m_Linear[ r ][ 0 ] * local.X() + m_Linear[ r ][ 1 ] * local.Y() +
+                  m_Linear[ r ][ 2 ] * local.Z() + m_Translation[ r ];
+
+  return Vec3f( result[ 0 ], result[ 1 ], result[ 2 ] );
+}
+
+Vec3f
+ConvexShape::Center( void ) const
+{
+  return Vec3f( m_Translation[ 0 ], m_Translation[ 1 ], m_Translation[ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
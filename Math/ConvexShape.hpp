@@ -0,0 +1,69 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexShape.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_CONVEXSHAPE_HPP_
+#define MATH_CONVEXSHAPE_HPP_
+
+class Vec3f;
+class Mat4f;
+class Quaternion;
+
+/*
+ * GeekEngine::ConvexShape
+ *
+ * Convex shape given by its support function, the point of the shape
+ * farthest along a direction, as used by Gjk. Derived shapes implement
+ * LocalSupport in their own space; Support applies the transform set with
+ * Transform. Mat4f transforms use column vectors ( translation in the last
+ * column ) and may contain scale and shear, the support of the transformed
+ * shape is M * LocalSupport( M^T * d ). The default transform is identity.
+ */
+class ConvexShape
+{
+public:
+  ConvexShape( void );
+  ConvexShape( const ConvexShape& );
+  virtual
+  ~ConvexShape( void );
+
+  void
+  Transform( const Mat4f& transform );
+  void
+  Transform( const Quaternion& rotation, const Vec3f& translation );
+
+  Vec3f
+  Support( const Vec3f& direction ) const;
+  Vec3f
+  Center( void ) const;
+
+protected:
+  virtual Vec3f
+  LocalSupport( const Vec3f& direction ) const = 0;
+
+private:
+  float m_Linear[ 3 ][ 3 ];
+  float m_Translation[ 3 ];
+
+};
+
+#endif /* MATH_CONVEXSHAPE_HPP_ */
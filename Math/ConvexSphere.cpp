@@ -0,0 +1,86 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file ConvexSphere.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "ConvexSphere.hpp"
+
+#include "Vec3f.hpp"
+
+#include <cmath>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+ConvexSphere::ConvexSphere( const float radius ) :
+  m_Radius( radius )
+{
+  return;
+}
+
+ConvexSphere::ConvexSphere( const ConvexSphere& other ) :
+  ConvexShape( other ),
+  m_Radius( other.m_Radius )
+{
+  return;
+}
+
+ConvexSphere::~ConvexSphere( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+ConvexSphere::Radius( const float radius )
+{
+  m_Radius = radius;
+}
+
+float
+ConvexSphere::Radius( void ) const
+{
+  return m_Radius;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+Vec3f
+ConvexSphere::LocalSupport( const Vec3f& direction ) const
+{
+  const float length = direction.Length();
+
+  if ( length <= 0.0f ) return Vec3f( m_Radius, 0.0f, 0.0f );
+
+  return direction * ( m_Radius / length );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
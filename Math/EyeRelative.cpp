@@ -0,0 +1,161 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file EyeRelative.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "EyeRelative.hpp"
+
+#include "Vec3d.hpp"
+#include "Mat4d.hpp"
+#include "Mat4f.hpp"
+
+#define PARALLEL_MINIMUM 4096
+
+/* world with its translation moved by -eye, rounded to float */
+static inline void
+Relative( const Mat4d& world, const double* eye, float relative[ 4 ][ 4 ] )
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+  {
+    relative[ row ][ 0 ] = (float)world[ row ][ 0 ];
+    relative[ row ][ 1 ] = (float)world[ row ][ 1 ];
+    relative[ row ][ 2 ] = (float)world[ row ][ 2 ];
+    relative[ row ][ 3 ] = (float)( world[ row ][ 3 ] - eye[ row ] * world[ 3 ][ 3 ] );
+  }
+
+  for ( unsigned int col = 0; col < 4; col++ )
+    relative[ 3 ][ col ] = (float)world[ 3 ][ col ];
+}
+
+/* view translated by eye, its translation is ~0 for rigid views */
+static void
+RelativeView( const Mat4d& view, double* eye, float relative[ 4 ][ 4 ] )
+{
+  const Mat4d inverse = view.Inverse();
+
+  for ( unsigned int row = 0; row < 3; row++ )
+    eye[ row ] = inverse[ row ][ 3 ] / inverse[ 3 ][ 3 ];
+
+  for ( unsigned int row = 0; row < 4; row++ )
+  {
+    relative[ row ][ 0 ] = (float)view[ row ][ 0 ];
+    relative[ row ][ 1 ] = (float)view[ row ][ 1 ];
+    relative[ row ][ 2 ] = (float)view[ row ][ 2 ];
+    relative[ row ][ 3 ] = (float)( view[ row ][ 0 ] * eye[ 0 ] + view[ row ][ 1 ] * eye[ 1 ] +
+                                    view[ row ][ 2 ] * eye[ 2 ] + view[ row ][ 3 ] );
+  }
+}
+
+/* product of the first rows of view with world */
+static inline void
+Multiply( const float view[ 4 ][ 4 ], const float world[ 4 ][ 4 ], float* result, const unsigned int rows )
+{
+  for ( unsigned int row = 0; row < rows; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      result[ row * 4 + col ] = view[ row ][ 0 ] * world[ 0 ][ col ] +
+                                view[ row ][ 1 ] * world[ 1 ][ col ] +
+                                view[ row ][ 2 ] * world[ 2 ][ col ] +
+                                view[ row ][ 3 ] * world[ 3 ][ col ];
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+EyeRelative::EyeRelative( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+EyeRelative::World( const Mat4d* world, const unsigned int count, const Vec3d& eye, Mat4f* result )
+{
+  const double position[ 3 ] = { eye.X(), eye.Y(), eye.Z() };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    float relative[ 4 ][ 4 ];
+
+    Relative( world[ i ], position, relative );
+
+    for ( unsigned int row = 0; row < 4; row++ )
+      for ( unsigned int col = 0; col < 4; col++ )
+        result[ i ][ row ][ col ] = relative[ row ][ col ];
+  }
+}
+
+void
+EyeRelative::ModelView( const Mat4d* world, const unsigned int count, const Mat4d& view, Mat4f* result )
+{
+  double eye[ 3 ];
+  float  relativeView[ 4 ][ 4 ];
+
+  RelativeView( view, eye, relativeView );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    float relative[ 4 ][ 4 ];
+
+    Relative( world[ i ], eye, relative );
+    Multiply( relativeView, relative, result[ i ][ 0 ], 4 );
+  }
+}
+
+void
+EyeRelative::ModelView( const Mat4d* world, const unsigned int count, const Mat4d& view, float* result )
+{
+  double eye[ 3 ];
+  float  relativeView[ 4 ][ 4 ];
+
+  RelativeView( view, eye, relativeView );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    float relative[ 4 ][ 4 ];
+
+    Relative( world[ i ], eye, relative );
+    Multiply( relativeView, relative, result + i * 12, 3 );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,64 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file EyeRelative.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_EYERELATIVE_HPP_
+#define MATH_EYERELATIVE_HPP_
+
+class Vec3d;
+class Mat4d;
+class Mat4f;
+
+/*
+ * GeekEngine::EyeRelative
+ *
+ * Converts double precision world transforms into float matrices relative
+ * to the camera for rendering large worlds. The eye position is subtracted
+ * from the world translations in double, only the small remainder is
+ * rounded to float, so objects near the camera keep full float precision
+ * however far they are from the world origin.
+ *
+ * World emits the world matrices translated by -eye. ModelView takes the
+ * double view matrix, moves its translation into the eye position once per
+ * batch and multiplies the rotation-only view with every eye relative world
+ * matrix in float, no Mat4d product is formed per instance. The 3x4
+ * overload writes the first three rows of each model-view matrix, 12 floats
+ * per instance, and expects affine view and world matrices. All functions
+ * run in parallel when compiled with OpenMP.
+ */
+class EyeRelative
+{
+public:
+  static void
+  World( const Mat4d* world, const unsigned int count, const Vec3d& eye, Mat4f* result );
+  static void
+  ModelView( const Mat4d* world, const unsigned int count, const Mat4d& view, Mat4f* result );
+  static void
+  ModelView( const Mat4d* world, const unsigned int count, const Mat4d& view, float* result );
+
+protected:
+private:
+  EyeRelative( void );
+
+};
+
+#endif /* MATH_EYERELATIVE_HPP_ */
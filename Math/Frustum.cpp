@@ -0,0 +1,318 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Frustum.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Frustum.hpp"
+
+#include "Mat4f.hpp"
+#include "Mat4d.hpp"
+#include "Vec3f.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined( __AVX__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+template< class Matrix >
+static void
+GribbHartmann( const Matrix& m, double planes[ FRUSTUM_PLANES ][ 4 ] )
+{
+  for ( unsigned int col = 0; col < 4; col++ )
+  {
+    planes[ FRUSTUM_LEFT ][ col ]   = (double)m[ 3 ][ col ] + m[ 0 ][ col ];
+    planes[ FRUSTUM_RIGHT ][ col ]  = (double)m[ 3 ][ col ] - m[ 0 ][ col ];
+    planes[ FRUSTUM_BOTTOM ][ col ] = (double)m[ 3 ][ col ] + m[ 1 ][ col ];
+    planes[ FRUSTUM_TOP ][ col ]    = (double)m[ 3 ][ col ] - m[ 1 ][ col ];
+    planes[ FRUSTUM_NEAR ][ col ]   = (double)m[ 3 ][ col ] + m[ 2 ][ col ];
+    planes[ FRUSTUM_FAR ][ col ]    = (double)m[ 3 ][ col ] - m[ 2 ][ col ];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Frustum::Frustum( void )
+{
+  memset( m_Planes, 0, sizeof( m_Planes ) );
+}
+
+Frustum::Frustum( const Frustum& other )
+{
+  memcpy( m_Planes, other.m_Planes, sizeof( m_Planes ) );
+}
+
+Frustum::Frustum( const Mat4f& viewProjection )
+{
+  Extract( viewProjection );
+}
+
+Frustum::Frustum( const Mat4d& viewProjection )
+{
+  Extract( viewProjection );
+}
+
+Frustum::~Frustum( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Frustum::Extract( const Mat4f& viewProjection )
+{
+  double planes[ FRUSTUM_PLANES ][ 4 ];
+
+  GribbHartmann( viewProjection, planes );
+  Normalize( planes );
+}
+
+void
+Frustum::Extract( const Mat4d& viewProjection )
+{
+  double planes[ FRUSTUM_PLANES ][ 4 ];
+
+  GribbHartmann( viewProjection, planes );
+  Normalize( planes );
+}
+
+const float*
+Frustum::Plane( const unsigned int plane ) const
+{
+  return m_Planes[ plane ];
+}
+
+bool
+Frustum::Contains( const Vec3f& point ) const
+{
+  return IntersectsSphere( point, 0.0f );
+}
+
+bool
+Frustum::IntersectsSphere( const Vec3f& center, const float radius ) const
+{
+  for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+    if ( m_Planes[ p ][ 0 ] * center.X() +
+         m_Planes[ p ][ 1 ] * center.Y() +
+         m_Planes[ p ][ 2 ] * center.Z() +
+         m_Planes[ p ][ 3 ] < -radius )
+      return false;
+
+  return true;
+}
+
+bool
+Frustum::IntersectsBox( const Vec3f& min, const Vec3f& max ) const
+{
+  for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+  {
+    const float* plane = m_Planes[ p ];
+
+    /* corner furthest along the plane normal */
+    if ( plane[ 0 ] * ( plane[ 0 ] > 0.0f ? max.X() : min.X() ) +
+         plane[ 1 ] * ( plane[ 1 ] > 0.0f ? max.Y() : min.Y() ) +
+         plane[ 2 ] * ( plane[ 2 ] > 0.0f ? max.Z() : min.Z() ) +
+         plane[ 3 ] < 0.0f )
+      return false;
+  }
+
+  return true;
+}
+
+unsigned int
+Frustum::CullSpheres( const float* x, const float* y, const float* z, const float* radius,
+                      const unsigned int count, unsigned int* visible ) const
+{
+  unsigned int written = 0;
+  unsigned int i       = 0;
+
+#if defined( __AVX__ )
+  for ( ; i + 8 <= count; i += 8 )
+  {
+    const __m256 cx = _mm256_loadu_ps( x + i );
+    const __m256 cy = _mm256_loadu_ps( y + i );
+    const __m256 cz = _mm256_loadu_ps( z + i );
+    const __m256 nr = _mm256_sub_ps( _mm256_setzero_ps(), _mm256_loadu_ps( radius + i ) );
+    __m256       inside = _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) );
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+    {
+      __m256 d = _mm256_set1_ps( m_Planes[ p ][ 3 ] );
+
+      d = _mm256_add_ps( d, _mm256_mul_ps( cx, _mm256_set1_ps( m_Planes[ p ][ 0 ] ) ) );
+      d = _mm256_add_ps( d, _mm256_mul_ps( cy, _mm256_set1_ps( m_Planes[ p ][ 1 ] ) ) );
+      d = _mm256_add_ps( d, _mm256_mul_ps( cz, _mm256_set1_ps( m_Planes[ p ][ 2 ] ) ) );
+
+      inside = _mm256_and_ps( inside, _mm256_cmp_ps( d, nr, _CMP_GE_OQ ) );
+    }
+
+    for ( unsigned int mask = _mm256_movemask_ps( inside ), lane = 0; mask; mask >>= 1, lane++ )
+      if ( mask & 1 ) visible[ written++ ] = i + lane;
+  }
+#elif defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128 cx = _mm_loadu_ps( x + i );
+    const __m128 cy = _mm_loadu_ps( y + i );
+    const __m128 cz = _mm_loadu_ps( z + i );
+    const __m128 nr = _mm_sub_ps( _mm_setzero_ps(), _mm_loadu_ps( radius + i ) );
+    __m128       inside = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+    {
+      __m128 d = _mm_set1_ps( m_Planes[ p ][ 3 ] );
+
+      d = _mm_add_ps( d, _mm_mul_ps( cx, _mm_set1_ps( m_Planes[ p ][ 0 ] ) ) );
+      d = _mm_add_ps( d, _mm_mul_ps( cy, _mm_set1_ps( m_Planes[ p ][ 1 ] ) ) );
+      d = _mm_add_ps( d, _mm_mul_ps( cz, _mm_set1_ps( m_Planes[ p ][ 2 ] ) ) );
+
+      inside = _mm_and_ps( inside, _mm_cmpge_ps( d, nr ) );
+    }
+
+    for ( unsigned int mask = _mm_movemask_ps( inside ), lane = 0; mask; mask >>= 1, lane++ )
+      if ( mask & 1 ) visible[ written++ ] = i + lane;
+  }
+#endif
+
+  for ( ; i < count; i++ )
+  {
+    bool inside = true;
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES && inside; p++ )
+      inside = m_Planes[ p ][ 0 ] * x[ i ] +
+               m_Planes[ p ][ 1 ] * y[ i ] +
+               m_Planes[ p ][ 2 ] * z[ i ] +
+               m_Planes[ p ][ 3 ] >= -radius[ i ];
+
+    if ( inside ) visible[ written++ ] = i;
+  }
+
+  return written;
+}
+
+unsigned int
+Frustum::CullBoxes( const float* minX, const float* minY, const float* minZ,
+                    const float* maxX, const float* maxY, const float* maxZ,
+                    const unsigned int count, unsigned int* visible ) const
+{
+  /* the corner furthest along each plane normal only depends on the plane */
+  const float* cornerX[ FRUSTUM_PLANES ];
+  const float* cornerY[ FRUSTUM_PLANES ];
+  const float* cornerZ[ FRUSTUM_PLANES ];
+
+  for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+  {
+    cornerX[ p ] = m_Planes[ p ][ 0 ] > 0.0f ? maxX : minX;
+    cornerY[ p ] = m_Planes[ p ][ 1 ] > 0.0f ? maxY : minY;
+    cornerZ[ p ] = m_Planes[ p ][ 2 ] > 0.0f ? maxZ : minZ;
+  }
+
+  unsigned int written = 0;
+  unsigned int i       = 0;
+
+#if defined( __AVX__ )
+  for ( ; i + 8 <= count; i += 8 )
+  {
+    __m256 inside = _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) );
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+    {
+      __m256 d = _mm256_set1_ps( m_Planes[ p ][ 3 ] );
+
+      d = _mm256_add_ps( d, _mm256_mul_ps( _mm256_loadu_ps( cornerX[ p ] + i ), _mm256_set1_ps( m_Planes[ p ][ 0 ] ) ) );
+      d = _mm256_add_ps( d, _mm256_mul_ps( _mm256_loadu_ps( cornerY[ p ] + i ), _mm256_set1_ps( m_Planes[ p ][ 1 ] ) ) );
+      d = _mm256_add_ps( d, _mm256_mul_ps( _mm256_loadu_ps( cornerZ[ p ] + i ), _mm256_set1_ps( m_Planes[ p ][ 2 ] ) ) );
+
+      inside = _mm256_and_ps( inside, _mm256_cmp_ps( d, _mm256_setzero_ps(), _CMP_GE_OQ ) );
+    }
+
+    for ( unsigned int mask = _mm256_movemask_ps( inside ), lane = 0; mask; mask >>= 1, lane++ )
+      if ( mask & 1 ) visible[ written++ ] = i + lane;
+  }
+#elif defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    __m128 inside = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+    {
+      __m128 d = _mm_set1_ps( m_Planes[ p ][ 3 ] );
+
+      d = _mm_add_ps( d, _mm_mul_ps( _mm_loadu_ps( cornerX[ p ] + i ), _mm_set1_ps( m_Planes[ p ][ 0 ] ) ) );
+      d = _mm_add_ps( d, _mm_mul_ps( _mm_loadu_ps( cornerY[ p ] + i ), _mm_set1_ps( m_Planes[ p ][ 1 ] ) ) );
+      d = _mm_add_ps( d, _mm_mul_ps( _mm_loadu_ps( cornerZ[ p ] + i ), _mm_set1_ps( m_Planes[ p ][ 2 ] ) ) );
+
+      inside = _mm_and_ps( inside, _mm_cmpge_ps( d, _mm_setzero_ps() ) );
+    }
+
+    for ( unsigned int mask = _mm_movemask_ps( inside ), lane = 0; mask; mask >>= 1, lane++ )
+      if ( mask & 1 ) visible[ written++ ] = i + lane;
+  }
+#endif
+
+  for ( ; i < count; i++ )
+  {
+    bool inside = true;
+
+    for ( unsigned int p = 0; p < FRUSTUM_PLANES && inside; p++ )
+      inside = m_Planes[ p ][ 0 ] * cornerX[ p ][ i ] +
+               m_Planes[ p ][ 1 ] * cornerY[ p ][ i ] +
+               m_Planes[ p ][ 2 ] * cornerZ[ p ][ i ] +
+               m_Planes[ p ][ 3 ] >= 0.0f;
+
+    if ( inside ) visible[ written++ ] = i;
+  }
+
+  return written;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Frustum::Normalize( const double planes[ FRUSTUM_PLANES ][ 4 ] )
+{
+  for ( unsigned int p = 0; p < FRUSTUM_PLANES; p++ )
+  {
+    const double length = sqrt( planes[ p ][ 0 ] * planes[ p ][ 0 ] +
+                                planes[ p ][ 1 ] * planes[ p ][ 1 ] +
+                                planes[ p ][ 2 ] * planes[ p ][ 2 ] );
+    const double inv    = length > 0.0 ? 1.0 / length : 0.0;
+
+    for ( unsigned int i = 0; i < 4; i++ )
+      m_Planes[ p ][ i ] = (float)( planes[ p ][ i ] * inv );
+  }
+}
@@ -0,0 +1,96 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Frustum.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_FRUSTUM_HPP_
+#define MATH_FRUSTUM_HPP_
+
+class Mat4f;
+class Mat4d;
+class Vec3f;
+
+enum FrustumPlane
+{
+  FRUSTUM_LEFT,
+  FRUSTUM_RIGHT,
+  FRUSTUM_BOTTOM,
+  FRUSTUM_TOP,
+  FRUSTUM_NEAR,
+  FRUSTUM_FAR,
+  FRUSTUM_PLANES
+};
+
+/*
+ * GeekEngine::Frustum
+ *
+ * View frustum planes extracted from a view projection matrix with the
+ * Gribb-Hartmann method. Matrices are applied to column vectors
+ * ( clip = M * v, as built by Mat4f::Perspective ) and clip space depth is
+ * -w <= z <= w. Planes are normalized and point inwards.
+ *
+ * The Cull functions test structure of arrays inputs, 8 objects per step
+ * with AVX, 4 with SSE2, and write the indices of all visible objects in
+ * ascending order to visible, returning how many were written.
+ */
+class Frustum
+{
+public:
+  Frustum( void );
+  Frustum( const Frustum& );
+  Frustum( const Mat4f& viewProjection );
+  Frustum( const Mat4d& viewProjection );
+  virtual
+  ~Frustum( void );
+
+  void
+  Extract( const Mat4f& viewProjection );
+  void
+  Extract( const Mat4d& viewProjection );
+
+  const float*
+  Plane( const unsigned int plane ) const;
+
+  bool
+  Contains( const Vec3f& point ) const;
+  bool
+  IntersectsSphere( const Vec3f& center, const float radius ) const;
+  bool
+  IntersectsBox( const Vec3f& min, const Vec3f& max ) const;
+
+  unsigned int
+  CullSpheres( const float* x, const float* y, const float* z, const float* radius,
+               const unsigned int count, unsigned int* visible ) const;
+  unsigned int
+  CullBoxes( const float* minX, const float* minY, const float* minZ,
+             const float* maxX, const float* maxY, const float* maxZ,
+             const unsigned int count, unsigned int* visible ) const;
+
+protected:
+private:
+  void
+  Normalize( const double planes[ FRUSTUM_PLANES ][ 4 ] );
+
+  float m_Planes[ FRUSTUM_PLANES ][ 4 ];
+
+};
+
+#endif /* MATH_FRUSTUM_HPP_ */
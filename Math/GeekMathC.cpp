@@ -0,0 +1,289 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file GeekMathC.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "GeekMathC.h"
+
+#include "Vec3f.hpp"
+#include "Vec3d.hpp"
+#include "Quaternion.hpp"
+#include "Quaterniond.hpp"
+#include "Mat4f.hpp"
+#include "Mat4d.hpp"
+#include "Mat4fSpan.hpp"
+#include "Affine3f.hpp"
+#include "Affine3d.hpp"
+#include "Interleaved.hpp"
+
+#include <cstring>
+
+#define PARALLEL_MINIMUM 4096
+
+/* the plain structs must match the values of the classes exactly */
+typedef char GMVec3fPacked[ sizeof( GMVec3f ) == 3 * sizeof( float ) ? 1 : -1 ];
+typedef char GMVec3dPacked[ sizeof( GMVec3d ) == 3 * sizeof( double ) ? 1 : -1 ];
+typedef char GMAffine3fPacked[ sizeof( GMAffine3f ) == sizeof( Affine3f ) ? 1 : -1 ];
+typedef char GMAffine3dPacked[ sizeof( GMAffine3d ) == sizeof( Affine3d ) ? 1 : -1 ];
+
+static inline Mat4d
+Matrix( const GMMat4d& matrix )
+{
+  Mat4d result;
+
+  memcpy( result[ 0 ], matrix.m, sizeof( matrix.m ) );
+
+  return result;
+}
+
+static inline void
+Store( const Mat4f& matrix, GMMat4f& result )
+{
+  memcpy( result.m, matrix.Values(), sizeof( result.m ) );
+}
+
+static inline void
+Store( const Mat4d& matrix, GMMat4d& result )
+{
+  memcpy( result.m, matrix.Values(), sizeof( result.m ) );
+}
+
+static inline void
+Store( const Quaternion& quaternion, GMQuaternion& result )
+{
+  result.x = quaternion[ 0 ];
+  result.y = quaternion[ 1 ];
+  result.z = quaternion[ 2 ];
+  result.w = quaternion[ 3 ];
+}
+
+static inline void
+Store( const Quaterniond& quaternion, GMQuaterniond& result )
+{
+  result.x = quaternion[ 0 ];
+  result.y = quaternion[ 1 ];
+  result.z = quaternion[ 2 ];
+  result.w = quaternion[ 3 ];
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+GMVersion( void )
+{
+  return GM_VERSION;
+}
+
+void
+GMMat4fMultiply( const GMMat4f* left, const GMMat4f* right, const unsigned int count, GMMat4f* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Mat4f( left[ i ].m ) * Mat4f( right[ i ].m ), result[ i ] );
+}
+
+void
+GMMat4fPremultiply( const GMMat4f* matrix, GMMat4f* matrices, const unsigned int count )
+{
+  Mat4fSpan( matrices[ 0 ].m, count ).Premultiply( Mat4f( matrix->m ) );
+}
+
+void
+GMMat4fPostmultiply( GMMat4f* matrices, const unsigned int count, const GMMat4f* matrix )
+{
+  Mat4fSpan( matrices[ 0 ].m, count ).Postmultiply( Mat4f( matrix->m ) );
+}
+
+void
+GMMat4fInverse( const GMMat4f* matrices, const unsigned int count, GMMat4f* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Mat4f( matrices[ i ].m ).Inverse(), result[ i ] );
+}
+
+void
+GMMat4fTransformPoints( const GMMat4f* matrix, const GMVec3f* points, const unsigned int count, GMVec3f* result )
+{
+  Interleaved::TransformPoints( &points->x, count, sizeof( GMVec3f ), Mat4f( matrix->m ), &result->x,
+                                sizeof( GMVec3f ) );
+}
+
+void
+GMMat4fTransformDirections( const GMMat4f* matrix, const GMVec3f* directions, const unsigned int count,
+                            GMVec3f* result )
+{
+  Interleaved::TransformDirections( &directions->x, count, sizeof( GMVec3f ), Mat4f( matrix->m ), &result->x,
+                                    sizeof( GMVec3f ) );
+}
+
+void
+GMVec3fNormalize( const GMVec3f* vectors, const unsigned int count, GMVec3f* result )
+{
+  Interleaved::Normalize( &vectors->x, count, sizeof( GMVec3f ), &result->x, sizeof( GMVec3f ) );
+}
+
+void
+GMQuaternionMultiply( const GMQuaternion* left, const GMQuaternion* right, const unsigned int count,
+                      GMQuaternion* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Quaternion( left[ i ].x, left[ i ].y, left[ i ].z, left[ i ].w ) *
+           Quaternion( right[ i ].x, right[ i ].y, right[ i ].z, right[ i ].w ), result[ i ] );
+}
+
+void
+GMQuaternionSlerp( const GMQuaternion* from, const GMQuaternion* to, const float* factors,
+                   const unsigned int count, GMQuaternion* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Quaternion( from[ i ].x, from[ i ].y, from[ i ].z, from[ i ].w ).SLerp(
+             Quaternion( to[ i ].x, to[ i ].y, to[ i ].z, to[ i ].w ), factors[ i ], true ), result[ i ] );
+}
+
+void
+GMAffine3fMultiply( const GMAffine3f* left, const GMAffine3f* right, const unsigned int count,
+                    GMAffine3f* result )
+{
+  Affine3f::Multiply( reinterpret_cast< const Affine3f* >( left ), reinterpret_cast< const Affine3f* >( right ),
+                      count, reinterpret_cast< Affine3f* >( result ) );
+}
+
+void
+GMAffine3fTransformPoints( const GMAffine3f* transform, const GMVec3f* points, const unsigned int count,
+                           GMVec3f* result )
+{
+  const Affine3f affine( transform->m );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    const Vec3f point = affine.TransformPoint( Vec3f( points[ i ].x, points[ i ].y, points[ i ].z ) );
+
+    result[ i ].x = point[ 0 ];
+    result[ i ].y = point[ 1 ];
+    result[ i ].z = point[ 2 ];
+  }
+}
+
+void
+GMMat4dMultiply( const GMMat4d* left, const GMMat4d* right, const unsigned int count, GMMat4d* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Matrix( left[ i ] ) * Matrix( right[ i ] ), result[ i ] );
+}
+
+void
+GMMat4dInverse( const GMMat4d* matrices, const unsigned int count, GMMat4d* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Matrix( matrices[ i ] ).Inverse(), result[ i ] );
+}
+
+void
+GMMat4dTransformPoints( const GMMat4d* matrix, const GMVec3d* points, const unsigned int count, GMVec3d* result )
+{
+  const Mat4d transform = Matrix( *matrix );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    const Quaterniond point = transform * Quaterniond( points[ i ].x, points[ i ].y, points[ i ].z, 1.0 );
+
+    result[ i ].x = point[ 0 ];
+    result[ i ].y = point[ 1 ];
+    result[ i ].z = point[ 2 ];
+  }
+}
+
+void
+GMQuaterniondMultiply( const GMQuaterniond* left, const GMQuaterniond* right, const unsigned int count,
+                       GMQuaterniond* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Quaterniond( left[ i ].x, left[ i ].y, left[ i ].z, left[ i ].w ) *
+           Quaterniond( right[ i ].x, right[ i ].y, right[ i ].z, right[ i ].w ), result[ i ] );
+}
+
+void
+GMQuaterniondSlerp( const GMQuaterniond* from, const GMQuaterniond* to, const double* factors,
+                    const unsigned int count, GMQuaterniond* result )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Store( Quaterniond( from[ i ].x, from[ i ].y, from[ i ].z, from[ i ].w ).SLerp(
+             Quaterniond( to[ i ].x, to[ i ].y, to[ i ].z, to[ i ].w ), factors[ i ], true ), result[ i ] );
+}
+
+void
+GMAffine3dMultiply( const GMAffine3d* left, const GMAffine3d* right, const unsigned int count,
+                    GMAffine3d* result )
+{
+  Affine3d::Multiply( reinterpret_cast< const Affine3d* >( left ), reinterpret_cast< const Affine3d* >( right ),
+                      count, reinterpret_cast< Affine3d* >( result ) );
+}
+
+void
+GMAffine3dTransformPoints( const GMAffine3d* transform, const GMVec3d* points, const unsigned int count,
+                           GMVec3d* result )
+{
+  const Affine3d affine( transform->m );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    const Vec3d point = affine.TransformPoint( Vec3d( points[ i ].x, points[ i ].y, points[ i ].z ) );
+
+    result[ i ].x = point[ 0 ];
+    result[ i ].y = point[ 1 ];
+    result[ i ].z = point[ 2 ];
+  }
+}
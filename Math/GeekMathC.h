@@ -0,0 +1,174 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file GeekMathC.h
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_GEEKMATHC_H_
+#define MATH_GEEKMATHC_H_
+
+/*
+ * GeekEngine C interface
+ *
+ * Plain C entry points for callers that reach the library through a
+ * foreign function interface. The types are structs of floats or doubles
+ * without padding, laid out like the values of the C++ classes: vectors
+ * and quaternions as x, y, z ( , w ), matrices row by row. An array of
+ * them is a plain array of scalars, e.g. a numpy array of shape ( n, 4, 4 )
+ * for GMMat4f.
+ *
+ * All matrices act on column vectors: a point becomes M * ( x, y, z, 1 ),
+ * a direction M * ( x, y, z, 0 ), without division by w. The translation
+ * is the last column, m[ 3 ], m[ 7 ] and m[ 11 ], for GMMat4f, GMMat4d,
+ * GMAffine3f and GMAffine3d alike, as built by Mat4f::Translation.
+ *
+ * Every operation works on count elements per call so the cost of
+ * crossing the boundary is paid once per array; single values are count
+ * 1. The results match the C++ members named in the comments, result may
+ * be the same array as an input. The batches run in parallel when the
+ * library is compiled with OpenMP.
+ *
+ * The layout of the structs and the signatures only ever grow, GMVersion
+ * returns GM_VERSION of the library actually loaded. Windows DLL builds
+ * define GEEKMATH_DLL, and GEEKMATH_EXPORTS while building the library.
+ */
+
+#define GM_VERSION 1
+
+#if defined( _WIN32 ) && defined( GEEKMATH_DLL )
+  #if defined( GEEKMATH_EXPORTS )
+    #define GM_API __declspec( dllexport )
+  #else
+    #define GM_API __declspec( dllimport )
+  #endif
+#elif defined( __GNUC__ )
+  #define GM_API __attribute__( ( visibility( "default" ) ) )
+#else
+  #define GM_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct GMVec3f
+{
+  float x, y, z;
+} GMVec3f;
+
+typedef struct GMQuaternion
+{
+  float x, y, z, w;
+} GMQuaternion;
+
+typedef struct GMMat4f
+{
+  float m[ 16 ];
+} GMMat4f;
+
+/* rotation and scale in the first three columns, translation in the last */
+typedef struct GMAffine3f
+{
+  float m[ 12 ];
+} GMAffine3f;
+
+typedef struct GMVec3d
+{
+  double x, y, z;
+} GMVec3d;
+
+typedef struct GMQuaterniond
+{
+  double x, y, z, w;
+} GMQuaterniond;
+
+typedef struct GMMat4d
+{
+  double m[ 16 ];
+} GMMat4d;
+
+typedef struct GMAffine3d
+{
+  double m[ 12 ];
+} GMAffine3d;
+
+GM_API unsigned int
+GMVersion( void );
+
+/* Mat4f::operator * and Inverse, the transforms as Mat4f * Quaternion( x, y, z, w ) */
+GM_API void
+GMMat4fMultiply( const GMMat4f* left, const GMMat4f* right, const unsigned int count, GMMat4f* result );
+GM_API void
+GMMat4fPremultiply( const GMMat4f* matrix, GMMat4f* matrices, const unsigned int count );
+GM_API void
+GMMat4fPostmultiply( GMMat4f* matrices, const unsigned int count, const GMMat4f* matrix );
+GM_API void
+GMMat4fInverse( const GMMat4f* matrices, const unsigned int count, GMMat4f* result );
+GM_API void
+GMMat4fTransformPoints( const GMMat4f* matrix, const GMVec3f* points, const unsigned int count, GMVec3f* result );
+GM_API void
+GMMat4fTransformDirections( const GMMat4f* matrix, const GMVec3f* directions, const unsigned int count,
+                            GMVec3f* result );
+
+/* Vec3f::Normalize */
+GM_API void
+GMVec3fNormalize( const GMVec3f* vectors, const unsigned int count, GMVec3f* result );
+
+/* Quaternion::operator * and SLerp along the shortest path */
+GM_API void
+GMQuaternionMultiply( const GMQuaternion* left, const GMQuaternion* right, const unsigned int count,
+                      GMQuaternion* result );
+GM_API void
+GMQuaternionSlerp( const GMQuaternion* from, const GMQuaternion* to, const float* factors,
+                   const unsigned int count, GMQuaternion* result );
+
+/* Affine3f::Multiply and TransformPoint */
+GM_API void
+GMAffine3fMultiply( const GMAffine3f* left, const GMAffine3f* right, const unsigned int count,
+                    GMAffine3f* result );
+GM_API void
+GMAffine3fTransformPoints( const GMAffine3f* transform, const GMVec3f* points, const unsigned int count,
+                           GMVec3f* result );
+
+/* the same for doubles, GMMat4dTransformPoints as Mat4d * Quaterniond( x, y, z, 1 ) */
+GM_API void
+GMMat4dMultiply( const GMMat4d* left, const GMMat4d* right, const unsigned int count, GMMat4d* result );
+GM_API void
+GMMat4dInverse( const GMMat4d* matrices, const unsigned int count, GMMat4d* result );
+GM_API void
+GMMat4dTransformPoints( const GMMat4d* matrix, const GMVec3d* points, const unsigned int count, GMVec3d* result );
+GM_API void
+GMQuaterniondMultiply( const GMQuaterniond* left, const GMQuaterniond* right, const unsigned int count,
+                       GMQuaterniond* result );
+GM_API void
+GMQuaterniondSlerp( const GMQuaterniond* from, const GMQuaterniond* to, const double* factors,
+                    const unsigned int count, GMQuaterniond* result );
+GM_API void
+GMAffine3dMultiply( const GMAffine3d* left, const GMAffine3d* right, const unsigned int count,
+                    GMAffine3d* result );
+GM_API void
+GMAffine3dTransformPoints( const GMAffine3d* transform, const GMVec3d* points, const unsigned int count,
+                           GMVec3d* result );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MATH_GEEKMATHC_H_ */
@@ -0,0 +1,823 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Gjk.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Gjk.hpp"
+
+#include "Vec3f.hpp"
+#include "ConvexShape.hpp"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#define GJK_MAX_ITERATIONS  64
+#define GJK_TOLERANCE       1e-5f
+#define GJK_CONTACT         1e-12f
+#define GJK_FLAT            1e-4f
+#define EPA_MAX_ITERATIONS  128
+#define EPA_TOLERANCE       1e-4f
+
+/* offsets into a simplex vertex */
+#define VERTEX_W            0
+#define VERTEX_A            3
+#define VERTEX_B            6
+#define VERTEX_D            9
+#define VERTEX_SIZE         12
+
+typedef float GjkVertex[ VERTEX_SIZE ];
+
+/* closest point of a sub simplex to the origin */
+struct GjkCandidate
+{
+  unsigned int  count;
+  unsigned int  index[ 3 ];
+  float         weight[ 3 ];
+  float         distanceSq;
+};
+
+static inline float
+Dot3( const float* a, const float* b )
+{
+  return a[ 0 ] * b[ 0 ] + a[ 1 ] * b[ 1 ] + a[ 2 ] * b[ 2 ];
+}
+
+static inline void
+Sub3( const float* a, const float* b, float* result )
+{
+  result[ 0 ] = a[ 0 ] - b[ 0 ];
+  result[ 1 ] = a[ 1 ] - b[ 1 ];
+  result[ 2 ] = a[ 2 ] - b[ 2 ];
+}
+
+static inline void
+Cross3( const float* a, const float* b, float* result )
+{
+  result[ 0 ] = a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+  result[ 1 ] = a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+  result[ 2 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+}
+
+static void
+Vertex( GjkCandidate& candidate, const unsigned int i, const GjkVertex* simplex )
+{
+  candidate.count       = 1;
+  candidate.index[ 0 ]  = i;
+  candidate.weight[ 0 ] = 1.0f;
+  candidate.distanceSq  = Dot3( simplex[ i ] + VERTEX_W, simplex[ i ] + VERTEX_W );
+}
+
+static void
+Edge( GjkCandidate& candidate, const unsigned int i, const unsigned int j, const float t,
+      const GjkVertex* simplex )
+{
+  float point[ 3 ];
+
+  for ( unsigned int c = 0; c < 3; c++ )
+    point[ c ] = simplex[ i ][ VERTEX_W + c ] * ( 1.0f - t ) + simplex[ j ][ VERTEX_W + c ] * t;
+
+  candidate.count       = 2;
+  candidate.index[ 0 ]  = i;
+  candidate.index[ 1 ]  = j;
+  candidate.weight[ 0 ] = 1.0f - t;
+  candidate.weight[ 1 ] = t;
+  candidate.distanceSq  = Dot3( point, point );
+}
+
+static void
+SolveSegment( GjkCandidate& candidate, const unsigned int i, const unsigned int j,
+              const GjkVertex* simplex )
+{
+  const float* a = simplex[ i ] + VERTEX_W;
+  const float* b = simplex[ j ] + VERTEX_W;
+  float        ab[ 3 ];
+
+  Sub3( b, a, ab );
+
+  const float denominator = Dot3( ab, ab );
+  const float t           = denominator > 0.0f ? -Dot3( a, ab ) / denominator : 0.0f;
+
+  if      ( t <= 0.0f ) Vertex( candidate, i, simplex );
+  else if ( t >= 1.0f ) Vertex( candidate, j, simplex );
+  else                  Edge( candidate, i, j, t, simplex );
+}
+
+/* Voronoi regions of the triangle as in Ericson, Real-Time Collision Detection 5.1.5 */
+static void
+SolveTriangle( GjkCandidate& candidate, const unsigned int i, const unsigned int j, const unsigned int k,
+               const GjkVertex* simplex )
+{
+  const float* a = simplex[ i ] + VERTEX_W;
+  const float* b = simplex[ j ] + VERTEX_W;
+  const float* c = simplex[ k ] + VERTEX_W;
+  float        ab[ 3 ], ac[ 3 ];
+
+  Sub3( b, a, ab );
+  Sub3( c, a, ac );
+
+  const float d1 = -Dot3( ab, a ), d2 = -Dot3( ac, a );
+
+  if ( d1 <= 0.0f && d2 <= 0.0f ) { Vertex( candidate, i, simplex ); return; }
+
+  const float d3 = -Dot3( ab, b ), d4 = -Dot3( ac, b );
+
+  if ( d3 >= 0.0f && d4 <= d3 ) { Vertex( candidate, j, simplex ); return; }
+
+  const float vc = d1 * d4 - d3 * d2;
+
+  if ( vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f ) { Edge( candidate, i, j, d1 / ( d1 - d3 ), simplex ); return; }
+
+  const float d5 = -Dot3( ab, c ), d6 = -Dot3( ac, c );
+
+  if ( d6 >= 0.0f && d5 <= d6 ) { Vertex( candidate, k, simplex ); return; }
+
+  const float vb = d5 * d2 - d1 * d6;
+
+  if ( vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f ) { Edge( candidate, i, k, d2 / ( d2 - d6 ), simplex ); return; }
+
+  const float va = d3 * d6 - d5 * d4;
+
+  if ( va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f )
+  {
+    Edge( candidate, j, k, ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) ), simplex );
+    return;
+  }
+
+  const float sum = va + vb + vc;
+
+  if ( !( sum > 0.0f ) )
+  {
+    /* degenerate triangle, the closest of its edges */
+    GjkCandidate other;
+
+    SolveSegment( candidate, i, j, simplex );
+    SolveSegment( other, i, k, simplex );
+    if ( other.distanceSq < candidate.distanceSq ) candidate = other;
+    SolveSegment( other, j, k, simplex );
+    if ( other.distanceSq < candidate.distanceSq ) candidate = other;
+
+    return;
+  }
+
+  const float v = vb / sum;
+  const float w = vc / sum;
+  float       point[ 3 ];
+
+  for ( unsigned int n = 0; n < 3; n++ )
+    point[ n ] = a[ n ] + ab[ n ] * v + ac[ n ] * w;
+
+  candidate.count       = 3;
+  candidate.index[ 0 ]  = i;
+  candidate.index[ 1 ]  = j;
+  candidate.index[ 2 ]  = k;
+  candidate.weight[ 0 ] = 1.0f - v - w;
+  candidate.weight[ 1 ] = v;
+  candidate.weight[ 2 ] = w;
+  candidate.distanceSq  = Dot3( point, point );
+}
+
+/* barycentric coordinates of point in the triangle a, b, c */
+static void
+Barycentric( const float* a, const float* b, const float* c, const float* point, float* weights )
+{
+  float v0[ 3 ], v1[ 3 ], v2[ 3 ];
+
+  Sub3( b, a, v0 );
+  Sub3( c, a, v1 );
+  Sub3( point, a, v2 );
+
+  const float d00 = Dot3( v0, v0 ), d01 = Dot3( v0, v1 ), d11 = Dot3( v1, v1 );
+  const float d20 = Dot3( v2, v0 ), d21 = Dot3( v2, v1 );
+  const float denominator = d00 * d11 - d01 * d01;
+
+  if ( !( denominator > 0.0f ) )
+  {
+    weights[ 0 ] = 1.0f;
+    weights[ 1 ] = weights[ 2 ] = 0.0f;
+    return;
+  }
+
+  weights[ 1 ] = ( d11 * d20 - d01 * d21 ) / denominator;
+  weights[ 2 ] = ( d00 * d21 - d01 * d20 ) / denominator;
+  weights[ 0 ] = 1.0f - weights[ 1 ] - weights[ 2 ];
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Gjk::Gjk( void )
+{
+  Reset();
+}
+
+Gjk::Gjk( const Gjk& other ) :
+  m_Count( other.m_Count ),
+  m_Iterations( other.m_Iterations )
+{
+  memcpy( m_Simplex, other.m_Simplex, sizeof( m_Simplex ) );
+  memcpy( m_Weights, other.m_Weights, sizeof( m_Weights ) );
+  memcpy( m_Closest, other.m_Closest, sizeof( m_Closest ) );
+}
+
+Gjk::~Gjk( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+float
+Gjk::Distance( const ConvexShape& a, const ConvexShape& b, Vec3f& pointA, Vec3f& pointB )
+{
+  const bool overlap = Run( a, b, false );
+  float      pa[ 3 ] = { 0.0f, 0.0f, 0.0f };
+  float      pb[ 3 ] = { 0.0f, 0.0f, 0.0f };
+
+  if ( !overlap )
+    for ( unsigned int i = 0; i < m_Count; i++ )
+      for ( unsigned int c = 0; c < 3; c++ )
+      {
+        pa[ c ] += m_Simplex[ i ][ VERTEX_A + c ] * m_Weights[ i ];
+        pb[ c ] += m_Simplex[ i ][ VERTEX_B + c ] * m_Weights[ i ];
+      }
+
+  pointA.Set( pa[ 0 ], pa[ 1 ], pa[ 2 ] );
+  pointB.Set( pb[ 0 ], pb[ 1 ], pb[ 2 ] );
+
+  return overlap ? 0.0f : sqrtf( Dot3( m_Closest, m_Closest ) );
+}
+
+bool
+Gjk::Intersect( const ConvexShape& a, const ConvexShape& b )
+{
+  return Run( a, b, true );
+}
+
+bool
+Gjk::Penetration( const ConvexShape& a, const ConvexShape& b,
+                  Vec3f& normal, float& depth, Vec3f& pointA, Vec3f& pointB )
+{
+  if ( !Run( a, b, false ) ) return false;
+
+  normal.Set( 0.0f, 0.0f, 0.0f );
+  depth = 0.0f;
+
+  /* flat or degenerate difference, touching without a defined normal */
+  if ( !Expand( a, b ) )
+  {
+    const float* vertex = &m_Simplex[ 0 ][ VERTEX_A ];
+
+    pointA.Set( vertex[ 0 ], vertex[ 1 ], vertex[ 2 ] );
+    pointB.Set( vertex[ 0 ], vertex[ 1 ], vertex[ 2 ] );
+    return true;
+  }
+
+  m_Polytope.assign( &m_Simplex[ 0 ][ 0 ], &m_Simplex[ 0 ][ 0 ] + 4 * VERTEX_SIZE );
+  m_Faces.clear();
+  m_Normals.clear();
+
+  /* tetrahedron faces wound so their normals point away from the centroid */
+  const unsigned int tetrahedron[ 4 ][ 3 ] = { { 0, 1, 2 }, { 0, 3, 1 }, { 0, 2, 3 }, { 1, 3, 2 } };
+  float              centroid[ 3 ]         = { 0.0f, 0.0f, 0.0f };
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    for ( unsigned int c = 0; c < 3; c++ )
+      centroid[ c ] += m_Simplex[ i ][ VERTEX_W + c ] * 0.25f;
+
+  for ( unsigned int f = 0; f < 4; f++ )
+  {
+    unsigned int i = tetrahedron[ f ][ 0 ], j = tetrahedron[ f ][ 1 ], k = tetrahedron[ f ][ 2 ];
+    float        e1[ 3 ], e2[ 3 ], n[ 3 ], out[ 3 ];
+
+    Sub3( m_Simplex[ j ] + VERTEX_W, m_Simplex[ i ] + VERTEX_W, e1 );
+    Sub3( m_Simplex[ k ] + VERTEX_W, m_Simplex[ i ] + VERTEX_W, e2 );
+    Cross3( e1, e2, n );
+    Sub3( m_Simplex[ i ] + VERTEX_W, centroid, out );
+
+    if ( Dot3( n, out ) < 0.0f ) { const unsigned int swap = j; j = k; k = swap; }
+
+    m_Faces.push_back( i );
+    m_Faces.push_back( j );
+    m_Faces.push_back( k );
+  }
+
+  /* face normals and origin distances, degenerate faces are dropped */
+  for ( unsigned int f = 0; f < m_Faces.size(); )
+  {
+    const float* p0 = &m_Polytope[ m_Faces[ f ]     * VERTEX_SIZE ];
+    const float* p1 = &m_Polytope[ m_Faces[ f + 1 ] * VERTEX_SIZE ];
+    const float* p2 = &m_Polytope[ m_Faces[ f + 2 ] * VERTEX_SIZE ];
+    float        e1[ 3 ], e2[ 3 ], n[ 3 ];
+
+    Sub3( p1, p0, e1 );
+    Sub3( p2, p0, e2 );
+    Cross3( e1, e2, n );
+
+    const float length = sqrtf( Dot3( n, n ) );
+
+    if ( !( length > 0.0f ) )
+    {
+      m_Faces.erase( m_Faces.begin() + f, m_Faces.begin() + f + 3 );
+      continue;
+    }
+
+    m_Normals.push_back( n[ 0 ] / length );
+    m_Normals.push_back( n[ 1 ] / length );
+    m_Normals.push_back( n[ 2 ] / length );
+    m_Normals.push_back( Dot3( n, p0 ) / length );
+    f += 3;
+  }
+
+  unsigned int closest = 0;
+
+  for ( unsigned int iteration = 0; iteration < EPA_MAX_ITERATIONS && !m_Faces.empty(); iteration++ )
+  {
+    closest = 0;
+
+    for ( unsigned int f = 1; f < m_Normals.size() / 4; f++ )
+      if ( m_Normals[ f * 4 + 3 ] < m_Normals[ closest * 4 + 3 ] ) closest = f;
+
+    const float*       n     = &m_Normals[ closest * 4 ];
+    const float        dist  = n[ 3 ];
+    const unsigned int added = m_Polytope.size() / VERTEX_SIZE;
+    float              vertex[ VERTEX_SIZE ];
+
+    Evaluate( a, b, n, vertex );
+
+    const float reach = Dot3( vertex + VERTEX_W, n );
+
+    if ( reach - dist <= EPA_TOLERANCE * ( reach > 1.0f ? reach : 1.0f ) ) break;
+
+    m_Polytope.insert( m_Polytope.end(), vertex, vertex + VERTEX_SIZE );
+    m_Edges.clear();
+
+    /* the horizon of the faces the new vertex sees */
+    for ( unsigned int f = m_Normals.size() / 4; f-- > 0; )
+    {
+      if ( !Sees( vertex, f ) ) continue;
+
+      for ( unsigned int e = 0; e < 3; e++ )
+      {
+        const unsigned int from = m_Faces[ f * 3 + e ];
+        const unsigned int to   = m_Faces[ f * 3 + ( e + 1 ) % 3 ];
+        bool               shared = false;
+
+        for ( unsigned int h = 0; h < m_Edges.size(); h += 2 )
+          if ( m_Edges[ h ] == to && m_Edges[ h + 1 ] == from )
+          {
+            m_Edges.erase( m_Edges.begin() + h, m_Edges.begin() + h + 2 );
+            shared = true;
+            break;
+          }
+
+        if ( !shared )
+        {
+          m_Edges.push_back( from );
+          m_Edges.push_back( to );
+        }
+      }
+    }
+
+    /* nothing to stitch, keep the polytope as it is */
+    if ( m_Edges.empty() ) break;
+
+    for ( unsigned int f = m_Normals.size() / 4; f-- > 0; )
+      if ( Sees( vertex, f ) )
+      {
+        m_Faces.erase( m_Faces.begin() + f * 3, m_Faces.begin() + f * 3 + 3 );
+        m_Normals.erase( m_Normals.begin() + f * 4, m_Normals.begin() + f * 4 + 4 );
+      }
+
+    for ( unsigned int h = 0; h < m_Edges.size(); h += 2 )
+    {
+      const float* p0 = &m_Polytope[ m_Edges[ h ]     * VERTEX_SIZE ];
+      const float* p1 = &m_Polytope[ m_Edges[ h + 1 ] * VERTEX_SIZE ];
+      float        e1[ 3 ], e2[ 3 ], normal[ 3 ];
+
+      Sub3( p1, p0, e1 );
+      Sub3( vertex + VERTEX_W, p0, e2 );
+      Cross3( e1, e2, normal );
+
+      const float length = sqrtf( Dot3( normal, normal ) );
+
+      if ( !( length > 0.0f ) ) continue;
+
+      m_Faces.push_back( m_Edges[ h ] );
+      m_Faces.push_back( m_Edges[ h + 1 ] );
+      m_Faces.push_back( added );
+      m_Normals.push_back( normal[ 0 ] / length );
+      m_Normals.push_back( normal[ 1 ] / length );
+      m_Normals.push_back( normal[ 2 ] / length );
+      m_Normals.push_back( Dot3( normal, p0 ) / length );
+    }
+  }
+
+  /* every new face was degenerate, touching without a defined normal */
+  if ( m_Faces.empty() )
+  {
+    const float* vertex = &m_Simplex[ 0 ][ VERTEX_A ];
+
+    pointA.Set( vertex[ 0 ], vertex[ 1 ], vertex[ 2 ] );
+    pointB.Set( vertex[ 0 ], vertex[ 1 ], vertex[ 2 ] );
+    return true;
+  }
+
+  closest = 0;
+
+  for ( unsigned int f = 1; f < m_Normals.size() / 4; f++ )
+    if ( m_Normals[ f * 4 + 3 ] < m_Normals[ closest * 4 + 3 ] ) closest = f;
+
+  /* contact from the projection of the origin onto the closest face */
+  const float* n        = &m_Normals[ closest * 4 ];
+  const float* p[ 3 ]   = { &m_Polytope[ m_Faces[ closest * 3 ]     * VERTEX_SIZE ],
+                            &m_Polytope[ m_Faces[ closest * 3 + 1 ] * VERTEX_SIZE ],
+                            &m_Polytope[ m_Faces[ closest * 3 + 2 ] * VERTEX_SIZE ] };
+  const float  projected[ 3 ] = { n[ 0 ] * n[ 3 ], n[ 1 ] * n[ 3 ], n[ 2 ] * n[ 3 ] };
+  float        weights[ 3 ];
+  float        pa[ 3 ] = { 0.0f, 0.0f, 0.0f };
+  float        pb[ 3 ] = { 0.0f, 0.0f, 0.0f };
+
+  Barycentric( p[ 0 ] + VERTEX_W, p[ 1 ] + VERTEX_W, p[ 2 ] + VERTEX_W, projected, weights );
+
+  for ( unsigned int v = 0; v < 3; v++ )
+    for ( unsigned int c = 0; c < 3; c++ )
+    {
+      pa[ c ] += p[ v ][ VERTEX_A + c ] * weights[ v ];
+      pb[ c ] += p[ v ][ VERTEX_B + c ] * weights[ v ];
+    }
+
+  normal.Set( n[ 0 ], n[ 1 ], n[ 2 ] );
+  depth = n[ 3 ] > 0.0f ? n[ 3 ] : 0.0f;
+  pointA.Set( pa[ 0 ], pa[ 1 ], pa[ 2 ] );
+  pointB.Set( pb[ 0 ], pb[ 1 ], pb[ 2 ] );
+
+  return true;
+}
+
+void
+Gjk::Reset( void )
+{
+  m_Count      = 0;
+  m_Iterations = 0;
+
+  m_Closest[ 0 ] = m_Closest[ 1 ] = m_Closest[ 2 ] = 0.0f;
+}
+
+unsigned int
+Gjk::Iterations( void ) const
+{
+  return m_Iterations;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/*
+ * Returns true when the origin is inside the difference, otherwise the
+ * simplex ends as the smallest one containing the closest point. The
+ * cached simplex is re-evaluated along its stored directions first.
+ */
+bool
+Gjk::Run( const ConvexShape& a, const ConvexShape& b, const bool earlyOut )
+{
+  m_Iterations = 0;
+
+  if ( m_Count == 0 )
+  {
+    const Vec3f  offset = a.Center() - b.Center();
+    float* const first  = m_Simplex[ 0 ];
+
+    first[ VERTEX_D ]     = offset.X();
+    first[ VERTEX_D + 1 ] = offset.Y();
+    first[ VERTEX_D + 2 ] = offset.Z();
+
+    if ( Dot3( first + VERTEX_D, first + VERTEX_D ) <= 0.0f ) first[ VERTEX_D ] = 1.0f;
+
+    m_Count = 1;
+  }
+
+  /* cached directions may now reach the same support, keep one of them */
+  unsigned int count = 0;
+
+  for ( unsigned int i = 0; i < m_Count; i++ )
+  {
+    Evaluate( a, b, m_Simplex[ i ] + VERTEX_D, m_Simplex[ count ] );
+
+    bool duplicate = false;
+
+    for ( unsigned int j = 0; j < count && !duplicate; j++ )
+      duplicate = m_Simplex[ j ][ VERTEX_W ]     == m_Simplex[ count ][ VERTEX_W ] &&
+                  m_Simplex[ j ][ VERTEX_W + 1 ] == m_Simplex[ count ][ VERTEX_W + 1 ] &&
+                  m_Simplex[ j ][ VERTEX_W + 2 ] == m_Simplex[ count ][ VERTEX_W + 2 ];
+
+    if ( !duplicate ) count++;
+  }
+
+  m_Count = count;
+
+  if ( Solve() ) return true;
+
+  while ( m_Iterations < GJK_MAX_ITERATIONS )
+  {
+    const float distanceSq = Dot3( m_Closest, m_Closest );
+
+    if ( distanceSq <= GJK_CONTACT ) return true;
+
+    const float direction[ 3 ] = { -m_Closest[ 0 ], -m_Closest[ 1 ], -m_Closest[ 2 ] };
+    float*      next           = m_Simplex[ m_Count ];
+
+    Evaluate( a, b, direction, next );
+    m_Iterations++;
+
+    const float progress = Dot3( m_Closest, next + VERTEX_W );
+
+    /* the support along -v does not reach the origin, separated */
+    if ( earlyOut && progress > 0.0f ) return false;
+
+    if ( distanceSq - progress <= GJK_TOLERANCE * distanceSq ) return false;
+
+    for ( unsigned int i = 0; i < m_Count; i++ )
+      if ( m_Simplex[ i ][ VERTEX_W ]     == next[ VERTEX_W ] &&
+           m_Simplex[ i ][ VERTEX_W + 1 ] == next[ VERTEX_W + 1 ] &&
+           m_Simplex[ i ][ VERTEX_W + 2 ] == next[ VERTEX_W + 2 ] )
+        return false;
+
+    /* rounding on nearly flat simplices can pick a worse sub simplex, the
+       previous one is kept then */
+    GjkVertex    previous[ 4 ];
+    float        weights[ 4 ];
+    const float  closest[ 3 ] = { m_Closest[ 0 ], m_Closest[ 1 ], m_Closest[ 2 ] };
+    const unsigned int count  = m_Count;
+
+    memcpy( previous, m_Simplex, sizeof( GjkVertex ) * count );
+    memcpy( weights, m_Weights, sizeof( float ) * count );
+
+    m_Count++;
+
+    if ( Solve() ) return true;
+
+    if ( Dot3( m_Closest, m_Closest ) >= distanceSq )
+    {
+      memcpy( m_Simplex, previous, sizeof( GjkVertex ) * count );
+      memcpy( m_Weights, weights, sizeof( float ) * count );
+      memcpy( m_Closest, closest, sizeof( closest ) );
+      m_Count = count;
+
+      return false;
+    }
+  }
+
+  return false;
+}
+
+void
+Gjk::Evaluate( const ConvexShape& a, const ConvexShape& b, const float* direction, float* vertex ) const
+{
+  const Vec3f d( direction[ 0 ], direction[ 1 ], direction[ 2 ] );
+  const Vec3f onA = a.Support( d );
+  const Vec3f onB = b.Support( d * -1.0f );
+
+  vertex[ VERTEX_D ]     = d.X();
+  vertex[ VERTEX_D + 1 ] = d.Y();
+  vertex[ VERTEX_D + 2 ] = d.Z();
+  vertex[ VERTEX_A ]     = onA.X();
+  vertex[ VERTEX_A + 1 ] = onA.Y();
+  vertex[ VERTEX_A + 2 ] = onA.Z();
+  vertex[ VERTEX_B ]     = onB.X();
+  vertex[ VERTEX_B + 1 ] = onB.Y();
+  vertex[ VERTEX_B + 2 ] = onB.Z();
+
+  Sub3( vertex + VERTEX_A, vertex + VERTEX_B, vertex + VERTEX_W );
+}
+
+/*
+ * Reduces the simplex to the sub simplex closest to the origin and updates
+ * the closest point and its weights. Returns true when the tetrahedron
+ * contains the origin.
+ */
+bool
+Gjk::Solve( void )
+{
+  GjkCandidate best;
+
+  switch ( m_Count )
+  {
+    case 1:
+      Vertex( best, 0, m_Simplex );
+      break;
+    case 2:
+      SolveSegment( best, 0, 1, m_Simplex );
+      break;
+    case 3:
+      SolveTriangle( best, 0, 1, 2, m_Simplex );
+      break;
+    default:
+    {
+      const unsigned int faces[ 4 ][ 4 ] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+      float              ab[ 3 ], ac[ 3 ], ad[ 3 ], n[ 3 ];
+
+      Sub3( m_Simplex[ 1 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, ab );
+      Sub3( m_Simplex[ 2 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, ac );
+      Sub3( m_Simplex[ 3 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, ad );
+      Cross3( ab, ac, n );
+
+      /* slivers have badly conditioned face normals, they are treated as
+         flat and all faces are tested */
+      float bc[ 3 ], bd[ 3 ], cd[ 3 ];
+
+      Sub3( ac, ab, bc );
+      Sub3( ad, ab, bd );
+      Sub3( ad, ac, cd );
+
+      float edge = Dot3( ab, ab );
+
+      if ( Dot3( ac, ac ) > edge ) edge = Dot3( ac, ac );
+      if ( Dot3( ad, ad ) > edge ) edge = Dot3( ad, ad );
+      if ( Dot3( bc, bc ) > edge ) edge = Dot3( bc, bc );
+      if ( Dot3( bd, bd ) > edge ) edge = Dot3( bd, bd );
+      if ( Dot3( cd, cd ) > edge ) edge = Dot3( cd, cd );
+
+      const float volume = Dot3( n, ad );
+      const bool  flat   = !( fabsf( volume ) > GJK_FLAT * edge * sqrtf( edge ) );
+      bool        inside = true;
+
+      best.distanceSq = FLT_MAX;
+
+      for ( unsigned int f = 0; f < 4; f++ )
+      {
+        const float* p0 = m_Simplex[ faces[ f ][ 0 ] ] + VERTEX_W;
+        float        e1[ 3 ], e2[ 3 ], normal[ 3 ], opposite[ 3 ];
+
+        Sub3( m_Simplex[ faces[ f ][ 1 ] ] + VERTEX_W, p0, e1 );
+        Sub3( m_Simplex[ faces[ f ][ 2 ] ] + VERTEX_W, p0, e2 );
+        Sub3( m_Simplex[ faces[ f ][ 3 ] ] + VERTEX_W, p0, opposite );
+        Cross3( e1, e2, normal );
+
+        if ( !flat && -Dot3( p0, normal ) * Dot3( opposite, normal ) >= 0.0f ) continue;
+
+        GjkCandidate candidate;
+
+        inside = false;
+        SolveTriangle( candidate, faces[ f ][ 0 ], faces[ f ][ 1 ], faces[ f ][ 2 ], m_Simplex );
+
+        if ( candidate.distanceSq < best.distanceSq ) best = candidate;
+      }
+
+      if ( inside )
+      {
+        m_Closest[ 0 ] = m_Closest[ 1 ] = m_Closest[ 2 ] = 0.0f;
+        return true;
+      }
+    }
+  }
+
+  GjkVertex reduced[ 3 ];
+
+  for ( unsigned int i = 0; i < best.count; i++ )
+    memcpy( reduced[ i ], m_Simplex[ best.index[ i ] ], sizeof( GjkVertex ) );
+
+  m_Count = best.count;
+  m_Closest[ 0 ] = m_Closest[ 1 ] = m_Closest[ 2 ] = 0.0f;
+
+  for ( unsigned int i = 0; i < m_Count; i++ )
+  {
+    memcpy( m_Simplex[ i ], reduced[ i ], sizeof( GjkVertex ) );
+    m_Weights[ i ] = best.weight[ i ];
+
+    for ( unsigned int c = 0; c < 3; c++ )
+      m_Closest[ c ] += m_Simplex[ i ][ VERTEX_W + c ] * m_Weights[ i ];
+  }
+
+  return false;
+}
+
+/*
+ * Grows a simplex that ended with the origin on its boundary to a
+ * tetrahedron for EPA. Fails when the difference is flat.
+ */
+bool
+Gjk::Expand( const ConvexShape& a, const ConvexShape& b )
+{
+  static const float axes[ 6 ][ 3 ] = { {  1.0f, 0.0f, 0.0f }, { -1.0f,  0.0f,  0.0f },
+                                        {  0.0f, 1.0f, 0.0f }, {  0.0f, -1.0f,  0.0f },
+                                        {  0.0f, 0.0f, 1.0f }, {  0.0f,  0.0f, -1.0f } };
+  const float        epsilon = 1e-6f;
+
+  if ( m_Count == 1 )
+  {
+    for ( unsigned int i = 0; i < 6 && m_Count == 1; i++ )
+    {
+      float offset[ 3 ];
+
+      Evaluate( a, b, axes[ i ], m_Simplex[ 1 ] );
+      Sub3( m_Simplex[ 1 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, offset );
+
+      if ( Dot3( offset, offset ) > epsilon ) m_Count = 2;
+    }
+
+    if ( m_Count == 1 ) return false;
+  }
+
+  if ( m_Count == 2 )
+  {
+    float edge[ 3 ], perpendicular[ 3 ], third[ 3 ];
+
+    Sub3( m_Simplex[ 1 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, edge );
+
+    /* the axis least aligned with the edge gives a stable perpendicular */
+    const unsigned int axis = fabsf( edge[ 0 ] ) < fabsf( edge[ 1 ] ) ?
+                              ( fabsf( edge[ 0 ] ) < fabsf( edge[ 2 ] ) ? 0 : 4 ) :
+                              ( fabsf( edge[ 1 ] ) < fabsf( edge[ 2 ] ) ? 2 : 4 );
+
+    Cross3( edge, axes[ axis ], perpendicular );
+    Cross3( edge, perpendicular, third );
+
+    const float* directions[ 2 ] = { perpendicular, third };
+
+    for ( unsigned int i = 0; i < 4 && m_Count == 2; i++ )
+    {
+      const float  sign         = i & 1 ? -1.0f : 1.0f;
+      const float  d[ 3 ]       = { directions[ i >> 1 ][ 0 ] * sign,
+                                    directions[ i >> 1 ][ 1 ] * sign,
+                                    directions[ i >> 1 ][ 2 ] * sign };
+      float        offset[ 3 ], area[ 3 ];
+
+      Evaluate( a, b, d, m_Simplex[ 2 ] );
+      Sub3( m_Simplex[ 2 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, offset );
+      Cross3( edge, offset, area );
+
+      if ( Dot3( area, area ) > epsilon * Dot3( edge, edge ) ) m_Count = 3;
+    }
+
+    if ( m_Count == 2 ) return false;
+  }
+
+  if ( m_Count == 3 )
+  {
+    float e1[ 3 ], e2[ 3 ], n[ 3 ];
+
+    Sub3( m_Simplex[ 1 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, e1 );
+    Sub3( m_Simplex[ 2 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, e2 );
+    Cross3( e1, e2, n );
+
+    const float length = sqrtf( Dot3( n, n ) );
+
+    for ( unsigned int i = 0; i < 2 && m_Count == 3; i++ )
+    {
+      const float d[ 3 ] = { i ? -n[ 0 ] : n[ 0 ], i ? -n[ 1 ] : n[ 1 ], i ? -n[ 2 ] : n[ 2 ] };
+      float       offset[ 3 ];
+
+      Evaluate( a, b, d, m_Simplex[ 3 ] );
+      Sub3( m_Simplex[ 3 ] + VERTEX_W, m_Simplex[ 0 ] + VERTEX_W, offset );
+
+      if ( fabsf( Dot3( offset, n ) ) > epsilon * length ) m_Count = 4;
+    }
+
+    if ( m_Count == 3 ) return false;
+  }
+
+  return true;
+}
+
+/*
+ * True if polytope face f faces the vertex, i.e. EPA has to replace it.
+ */
+bool
+Gjk::Sees( const float* vertex, const unsigned int face ) const
+{
+  float toVertex[ 3 ];
+
+  Sub3( vertex + VERTEX_W, &m_Polytope[ m_Faces[ face * 3 ] * VERTEX_SIZE ], toVertex );
+
+  return Dot3( &m_Normals[ face * 4 ], toVertex ) > 0.0f;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,98 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Gjk.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_GJK_HPP_
+#define MATH_GJK_HPP_
+
+#include <vector>
+
+class Vec3f;
+class ConvexShape;
+
+/*
+ * GeekEngine::Gjk
+ *
+ * Gilbert-Johnson-Keerthi queries between two convex shapes, working on
+ * their Minkowski difference a - b through the support functions only.
+ *
+ * Distance returns the distance between the shapes and the closest points
+ * on both, or 0 when they overlap. Intersect only answers whether they
+ * overlap and stops as soon as a separating direction is found.
+ * Penetration runs the expanding polytope algorithm on overlapping shapes:
+ * moving b by normal * depth separates them, pointA and pointB are the
+ * deepest points of the contact. It returns false for separated shapes.
+ *
+ * Every query starts from the simplex the previous one ended with, its
+ * support directions are evaluated again on the current shapes. For
+ * persistent pairs that move little between frames this usually converges
+ * in one or two iterations, so a Gjk object should be kept per pair. Reset
+ * drops the cached simplex.
+ */
+class Gjk
+{
+public:
+  Gjk( void );
+  Gjk( const Gjk& );
+  virtual
+  ~Gjk( void );
+
+  float
+  Distance( const ConvexShape& a, const ConvexShape& b, Vec3f& pointA, Vec3f& pointB );
+  bool
+  Intersect( const ConvexShape& a, const ConvexShape& b );
+  bool
+  Penetration( const ConvexShape& a, const ConvexShape& b,
+               Vec3f& normal, float& depth, Vec3f& pointA, Vec3f& pointB );
+
+  void
+  Reset( void );
+  unsigned int
+  Iterations( void ) const;
+
+protected:
+  bool
+  Run( const ConvexShape& a, const ConvexShape& b, const bool earlyOut );
+  void
+  Evaluate( const ConvexShape& a, const ConvexShape& b, const float* direction, float* vertex ) const;
+  bool
+  Solve( void );
+  bool
+  Expand( const ConvexShape& a, const ConvexShape& b );
+  bool
+  Sees( const float* vertex, const unsigned int face ) const;
+
+private:
+  /* per vertex the difference, the supports on a and b and the direction */
+  float                       m_Simplex[ 4 ][ 12 ];
+  float                       m_Weights[ 4 ];
+  float                       m_Closest[ 3 ];
+  unsigned int                m_Count;
+  unsigned int                m_Iterations;
+  std::vector< float >        m_Polytope;
+  std::vector< unsigned int > m_Faces;
+  std::vector< float >        m_Normals;
+  std::vector< unsigned int > m_Edges;
+
+};
+
+#endif /* MATH_GJK_HPP_ */
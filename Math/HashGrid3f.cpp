@@ -0,0 +1,348 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file HashGrid3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "HashGrid3f.hpp"
+
+#include "Vec3f.hpp"
+#include "Vec3i.hpp"
+#include "Aabb3f.hpp"
+
+#include <climits>
+#include <cmath>
+
+#define HASHGRID_MINIMUM_BUCKETS 16
+
+static inline unsigned int
+Hash( const int x, const int y, const int z )
+{
+  return ( (unsigned int)x * 73856093u ) ^ ( (unsigned int)y * 19349663u ) ^ ( (unsigned int)z * 83492791u );
+}
+
+/* clamped to the int range, converting out of range values is undefined; NaN maps to cell 0 */
+static inline int
+Quantize( const float value, const float inverseCellSize )
+{
+  const float cell = floorf( value * inverseCellSize );
+
+  if ( cell != cell )           return 0;
+  if ( cell >= 2147483648.0f )  return INT_MAX;
+  if ( cell <= -2147483648.0f ) return INT_MIN;
+
+  return (int)cell;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+HashGrid3f::HashGrid3f( const float cellSize ) :
+  m_Occupied( 0 )
+{
+  CellSize( cellSize );
+}
+
+HashGrid3f::HashGrid3f( const HashGrid3f& other ) :
+  m_CellSize( other.m_CellSize ),
+  m_InverseCellSize( other.m_InverseCellSize ),
+  m_Occupied( other.m_Occupied ),
+  m_Buckets( other.m_Buckets ),
+  m_PointBuckets( other.m_PointBuckets ),
+  m_Indices( other.m_Indices )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Positions[ i ] = other.m_Positions[ i ];
+}
+
+HashGrid3f::~HashGrid3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+HashGrid3f::CellSize( const float cellSize )
+{
+  m_CellSize        = cellSize;
+  m_InverseCellSize = 1.0f / cellSize;
+
+  Clear();
+}
+
+float
+HashGrid3f::CellSize( void ) const
+{
+  return m_CellSize;
+}
+
+Vec3i
+HashGrid3f::Cell( const Vec3f& point ) const
+{
+  return Vec3i( Quantize( point.X(), m_InverseCellSize ),
+                Quantize( point.Y(), m_InverseCellSize ),
+                Quantize( point.Z(), m_InverseCellSize ) );
+}
+
+void
+HashGrid3f::Build( const Vec3f* points, const unsigned int count )
+{
+  const float* values = count ? points[ 0 ].Values() : 0;
+
+  Rebuild( values, values + 1, values + 2, sizeof( Vec3f ) / sizeof( float ), count );
+}
+
+void
+HashGrid3f::Build( const float* x, const float* y, const float* z, const unsigned int count )
+{
+  Rebuild( x, y, z, 1, count );
+}
+
+void
+HashGrid3f::Clear( void )
+{
+  m_Occupied = 0;
+
+  m_Buckets.clear();
+  m_PointBuckets.clear();
+  m_Indices.clear();
+
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Positions[ i ].clear();
+}
+
+unsigned int
+HashGrid3f::Points( void ) const
+{
+  return m_Indices.size();
+}
+
+unsigned int
+HashGrid3f::Cells( void ) const
+{
+  return m_Occupied;
+}
+
+unsigned int
+HashGrid3f::Query( const Vec3f& center, const float radius, unsigned int* points,
+                   const unsigned int capacity ) const
+{
+  const float c[ 3 ]   = { center.X(), center.Y(), center.Z() };
+  const float min[ 3 ] = { c[ 0 ] - radius, c[ 1 ] - radius, c[ 2 ] - radius };
+  const float max[ 3 ] = { c[ 0 ] + radius, c[ 1 ] + radius, c[ 2 ] + radius };
+  int         lower[ 3 ], upper[ 3 ];
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    lower[ i ] = Quantize( min[ i ], m_InverseCellSize );
+    upper[ i ] = Quantize( max[ i ], m_InverseCellSize );
+  }
+
+  return Gather( lower, upper, min, max, c, radius * radius, points, capacity );
+}
+
+unsigned int
+HashGrid3f::Query( const Aabb3f& box, unsigned int* points, const unsigned int capacity ) const
+{
+  int lower[ 3 ], upper[ 3 ];
+
+  if ( box.Empty() ) return 0;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    lower[ i ] = Quantize( box[ 0 ][ i ], m_InverseCellSize );
+    upper[ i ] = Quantize( box[ 1 ][ i ], m_InverseCellSize );
+  }
+
+  return Gather( lower, upper, box[ 0 ], box[ 1 ], 0, 0.0f, points, capacity );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+void
+HashGrid3f::Rebuild( const float* x, const float* y, const float* z, const unsigned int stride,
+                     const unsigned int count )
+{
+  unsigned int buckets = HASHGRID_MINIMUM_BUCKETS;
+
+  while ( buckets < 2 * count ) buckets <<= 1;
+
+  const unsigned int mask = buckets - 1;
+  Bucket             empty;
+
+  empty.x = empty.y = empty.z = 0;
+  empty.start = empty.count = 0;
+
+  m_Buckets.assign( buckets, empty );
+  m_PointBuckets.resize( count );
+  m_Indices.resize( count );
+  m_Occupied = 0;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Positions[ i ].resize( count );
+
+  /* count the points per cell, inserting cells on first use */
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    const int    cx   = Quantize( x[ i * stride ], m_InverseCellSize );
+    const int    cy   = Quantize( y[ i * stride ], m_InverseCellSize );
+    const int    cz   = Quantize( z[ i * stride ], m_InverseCellSize );
+    unsigned int slot = Hash( cx, cy, cz ) & mask;
+
+    while ( m_Buckets[ slot ].count &&
+            ( m_Buckets[ slot ].x != cx || m_Buckets[ slot ].y != cy || m_Buckets[ slot ].z != cz ) )
+      slot = ( slot + 1 ) & mask;
+
+    Bucket& bucket = m_Buckets[ slot ];
+
+    if ( !bucket.count )
+    {
+      bucket.x = cx;
+      bucket.y = cy;
+      bucket.z = cz;
+      m_Occupied++;
+    }
+
+    bucket.count++;
+    m_PointBuckets[ i ] = slot;
+  }
+
+  /* prefix sum, the counts are restored while scattering */
+  unsigned int start = 0;
+
+  for ( unsigned int slot = 0; slot < buckets; slot++ )
+  {
+    Bucket& bucket = m_Buckets[ slot ];
+
+    bucket.start  = start;
+    start        += bucket.count;
+    bucket.count  = 0;
+  }
+
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    Bucket&            bucket = m_Buckets[ m_PointBuckets[ i ] ];
+    const unsigned int target = bucket.start + bucket.count++;
+
+    m_Indices[ target ]        = i;
+    m_Positions[ 0 ][ target ] = x[ i * stride ];
+    m_Positions[ 1 ][ target ] = y[ i * stride ];
+    m_Positions[ 2 ][ target ] = z[ i * stride ];
+  }
+}
+
+unsigned int
+HashGrid3f::Gather( const int* lower, const int* upper, const float* min, const float* max,
+                    const float* center, const float radiusSq, unsigned int* points,
+                    const unsigned int capacity ) const
+{
+  if ( m_Indices.empty() || !capacity ) return 0;
+
+  const float*  px = &m_Positions[ 0 ][ 0 ];
+  const float*  py = &m_Positions[ 1 ][ 0 ];
+  const float*  pz = &m_Positions[ 2 ][ 0 ];
+  unsigned int  found = 0;
+
+  /* ranges covering more cells than are occupied walk the table instead */
+  const double  range = ( upper[ 0 ] - (double)lower[ 0 ] + 1.0 ) *
+                        ( upper[ 1 ] - (double)lower[ 1 ] + 1.0 ) *
+                        ( upper[ 2 ] - (double)lower[ 2 ] + 1.0 );
+  const bool    scan  = range > m_Occupied;
+  const int     steps[ 3 ] = { scan ? 0 : upper[ 0 ] - lower[ 0 ],
+                               scan ? 0 : upper[ 1 ] - lower[ 1 ],
+                               scan ? (int)m_Buckets.size() - 1 : upper[ 2 ] - lower[ 2 ] };
+
+  for ( int k = 0; k <= steps[ 2 ]; k++ )
+    for ( int j = 0; j <= steps[ 1 ]; j++ )
+      for ( int i = 0; i <= steps[ 0 ]; i++ )
+      {
+        const Bucket* bucket;
+
+        if ( scan )
+        {
+          bucket = &m_Buckets[ k ];
+
+          if ( !bucket->count ||
+               bucket->x < lower[ 0 ] || bucket->x > upper[ 0 ] ||
+               bucket->y < lower[ 1 ] || bucket->y > upper[ 1 ] ||
+               bucket->z < lower[ 2 ] || bucket->z > upper[ 2 ] )
+            continue;
+        }
+        else if ( !( bucket = Find( lower[ 0 ] + i, lower[ 1 ] + j, lower[ 2 ] + k ) ) )
+          continue;
+
+        const unsigned int last = bucket->start + bucket->count;
+
+        for ( unsigned int p = bucket->start; p < last; p++ )
+        {
+          bool inside;
+
+          if ( center )
+          {
+            const float dx = px[ p ] - center[ 0 ];
+            const float dy = py[ p ] - center[ 1 ];
+            const float dz = pz[ p ] - center[ 2 ];
+
+            inside = dx * dx + dy * dy + dz * dz <= radiusSq;
+          }
+          else
+            inside = px[ p ] >= min[ 0 ] && px[ p ] <= max[ 0 ] &&
+                     py[ p ] >= min[ 1 ] && py[ p ] <= max[ 1 ] &&
+                     pz[ p ] >= min[ 2 ] && pz[ p ] <= max[ 2 ];
+
+          if ( !inside ) continue;
+
+          points[ found++ ] = m_Indices[ p ];
+
+          if ( found == capacity ) return found;
+        }
+      }
+
+  return found;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+const HashGrid3f::Bucket*
+HashGrid3f::Find( const int x, const int y, const int z ) const
+{
+  const unsigned int mask = m_Buckets.size() - 1;
+  unsigned int       slot = Hash( x, y, z ) & mask;
+
+  while ( m_Buckets[ slot ].count )
+  {
+    const Bucket& bucket = m_Buckets[ slot ];
+
+    if ( bucket.x == x && bucket.y == y && bucket.z == z ) return &bucket;
+
+    slot = ( slot + 1 ) & mask;
+  }
+
+  return 0;
+}
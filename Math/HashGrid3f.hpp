@@ -0,0 +1,108 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file HashGrid3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_HASHGRID3F_HPP_
+#define MATH_HASHGRID3F_HPP_
+
+#include <vector>
+
+class Vec3f;
+class Vec3i;
+class Aabb3f;
+
+/*
+ * GeekEngine::HashGrid3f
+ *
+ * Uniform grid over points, hashed by integer cell coordinates so it is
+ * unbounded and only stores occupied cells. Build quantizes every point to
+ * its cell, counts the points per cell in an open addressing table and
+ * sorts them by cell with a counting sort, so the points of a cell are
+ * contiguous. Queries visit only the cells overlapping the query range and
+ * report point indices as passed to Build, at most capacity; they return
+ * how many were written. For neighbour searches the cell size should be
+ * about the typical query radius.
+ */
+class HashGrid3f
+{
+public:
+  HashGrid3f( const float cellSize = 1.0f );
+  HashGrid3f( const HashGrid3f& );
+  virtual
+  ~HashGrid3f( void );
+
+  void
+  CellSize( const float cellSize );
+  float
+  CellSize( void ) const;
+  Vec3i
+  Cell( const Vec3f& point ) const;
+
+  void
+  Build( const Vec3f* points, const unsigned int count );
+  void
+  Build( const float* x, const float* y, const float* z, const unsigned int count );
+  void
+  Clear( void );
+
+  unsigned int
+  Points( void ) const;
+  unsigned int
+  Cells( void ) const;
+
+  unsigned int
+  Query( const Vec3f& center, const float radius, unsigned int* points, const unsigned int capacity ) const;
+  unsigned int
+  Query( const Aabb3f& box, unsigned int* points, const unsigned int capacity ) const;
+
+protected:
+  void
+  Rebuild( const float* x, const float* y, const float* z, const unsigned int stride,
+           const unsigned int count );
+  unsigned int
+  Gather( const int* lower, const int* upper, const float* min, const float* max,
+          const float* center, const float radiusSq, unsigned int* points,
+          const unsigned int capacity ) const;
+
+private:
+  /* count == 0 marks an empty slot */
+  struct Bucket
+  {
+    int           x, y, z;
+    unsigned int  start;
+    unsigned int  count;
+  };
+
+  const Bucket*
+  Find( const int x, const int y, const int z ) const;
+
+  float                       m_CellSize;
+  float                       m_InverseCellSize;
+  unsigned int                m_Occupied;
+  std::vector< Bucket >       m_Buckets;
+  std::vector< unsigned int > m_PointBuckets;
+  std::vector< unsigned int > m_Indices;
+  std::vector< float >        m_Positions[ 3 ];
+
+};
+
+#endif /* MATH_HASHGRID3F_HPP_ */
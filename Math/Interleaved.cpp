@@ -0,0 +1,214 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Interleaved.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Interleaved.hpp"
+#include "Profile.hpp"
+
+#include "Mat4f.hpp"
+
+#include <cmath>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+
+static inline const float*
+Element( const float* base, const unsigned int stride, const unsigned int i )
+{
+  return reinterpret_cast< const float* >( reinterpret_cast< const char* >( base ) + (unsigned long)i * stride );
+}
+
+static inline float*
+Element( float* base, const unsigned int stride, const unsigned int i )
+{
+  return reinterpret_cast< float* >( reinterpret_cast< char* >( base ) + (unsigned long)i * stride );
+}
+
+/* matrix * ( x, y, z, w ) with column vectors as Mat4f::operator*( Quaternion ), translation in column 3 */
+template< bool Point >
+static void
+Transform( const float* vectors, const unsigned int count, const unsigned int stride,
+           const Mat4f& matrix, float* result, const unsigned int resultStride )
+{
+  const float* m = matrix.Values();
+
+#if defined( __SSE2__ )
+  __m128 col0 = _mm_loadu_ps( m + 0 );
+  __m128 col1 = _mm_loadu_ps( m + 4 );
+  __m128 col2 = _mm_loadu_ps( m + 8 );
+  __m128 col3 = _mm_loadu_ps( m + 12 );
+
+  /* rows in, columns out */
+  _MM_TRANSPOSE4_PS( col0, col1, col2, col3 );
+#endif
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    const float* v = Element( vectors, stride, i );
+    float*       r = Element( result, resultStride, i );
+
+#if defined( __SSE2__ )
+    __m128 sum = _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( v[ 0 ] ), col0 ),
+                                         _mm_mul_ps( _mm_set1_ps( v[ 1 ] ), col1 ) ),
+                             _mm_mul_ps( _mm_set1_ps( v[ 2 ] ), col2 ) );
+
+    if ( Point ) sum = _mm_add_ps( sum, col3 );
+
+    /* three floats only, the fourth belongs to the next attribute */
+    _mm_storel_pi( (__m64*)r, sum );
+    _mm_store_ss( r + 2, _mm_movehl_ps( sum, sum ) );
+#else
+    float sum[ 3 ];
+
+    for ( unsigned int row = 0; row < 3; row++ )
+    {
+      sum[ row ] = m[ row * 4 + 0 ] * v[ 0 ] + m[ row * 4 + 1 ] * v[ 1 ] + m[ row * 4 + 2 ] * v[ 2 ];
+
+      if ( Point ) sum[ row ] += m[ row * 4 + 3 ];
+    }
+
+    r[ 0 ] = sum[ 0 ];
+    r[ 1 ] = sum[ 1 ];
+    r[ 2 ] = sum[ 2 ];
+#endif
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Interleaved::Interleaved( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Interleaved::TransformPoints( const float* points, const unsigned int count, const unsigned int stride,
+                              const Mat4f& matrix, float* result, const unsigned int resultStride )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_INTERLEAVED_TRANSFORM, count );
+
+  Transform< true >( points, count, stride, matrix, result, resultStride );
+}
+
+void
+Interleaved::TransformDirections( const float* directions, const unsigned int count, const unsigned int stride,
+                                  const Mat4f& matrix, float* result, const unsigned int resultStride )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_INTERLEAVED_TRANSFORM, count );
+
+  Transform< false >( directions, count, stride, matrix, result, resultStride );
+}
+
+void
+Interleaved::Normalize( const float* vectors, const unsigned int count, const unsigned int stride,
+                        float* result, const unsigned int resultStride )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_INTERLEAVED_NORMALIZE, count );
+
+  const int blocks = ( count + 3 ) / 4;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * 4;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    if ( first + 4 <= count )
+    {
+      const float* v0 = Element( vectors, stride, first + 0 );
+      const float* v1 = Element( vectors, stride, first + 1 );
+      const float* v2 = Element( vectors, stride, first + 2 );
+      const float* v3 = Element( vectors, stride, first + 3 );
+
+      const __m128 x      = _mm_setr_ps( v0[ 0 ], v1[ 0 ], v2[ 0 ], v3[ 0 ] );
+      const __m128 y      = _mm_setr_ps( v0[ 1 ], v1[ 1 ], v2[ 1 ], v3[ 1 ] );
+      const __m128 z      = _mm_setr_ps( v0[ 2 ], v1[ 2 ], v2[ 2 ], v3[ 2 ] );
+      const __m128 length = _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+                                                     _mm_mul_ps( z, z ) ) );
+      const __m128 valid  = _mm_cmpneq_ps( length, _mm_setzero_ps() );
+      float        values[ 3 ][ 4 ];
+
+      _mm_storeu_ps( values[ 0 ], _mm_and_ps( valid, _mm_div_ps( x, length ) ) );
+      _mm_storeu_ps( values[ 1 ], _mm_and_ps( valid, _mm_div_ps( y, length ) ) );
+      _mm_storeu_ps( values[ 2 ], _mm_and_ps( valid, _mm_div_ps( z, length ) ) );
+
+      for ( unsigned int k = 0; k < 4; k++ )
+      {
+        float* r = Element( result, resultStride, first + k );
+
+        r[ 0 ] = values[ 0 ][ k ];
+        r[ 1 ] = values[ 1 ][ k ];
+        r[ 2 ] = values[ 2 ][ k ];
+      }
+
+      i += 4;
+    }
+#endif
+
+    for ( ; i < first + 4 && i < count; i++ )
+    {
+      const float* v      = Element( vectors, stride, i );
+      float*       r      = Element( result, resultStride, i );
+      const float  length = sqrtf( v[ 0 ] * v[ 0 ] + v[ 1 ] * v[ 1 ] + v[ 2 ] * v[ 2 ] );
+
+      if ( length == 0.0f )
+      {
+        r[ 0 ] = r[ 1 ] = r[ 2 ] = 0.0f;
+        continue;
+      }
+
+      const float x = v[ 0 ] / length;
+      const float y = v[ 1 ] / length;
+      const float z = v[ 2 ] / length;
+
+      r[ 0 ] = x;
+      r[ 1 ] = y;
+      r[ 2 ] = z;
+    }
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,66 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Interleaved.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_INTERLEAVED_HPP_
+#define MATH_INTERLEAVED_HPP_
+
+class Mat4f;
+
+/*
+ * GeekEngine::Interleaved
+ *
+ * Batch kernels over vectors of three floats that sit inside interleaved
+ * records, e.g. the position or normal of a vertex. Each vector is found
+ * stride bytes after the previous one, input and result have their own
+ * stride so a kernel can read one stream and write another, or work in
+ * place when both are the same. Only the three floats are touched, the
+ * rest of each record is left alone.
+ *
+ * The transforms treat vectors as columns, result = matrix * ( x, y, z, w )
+ * with w = 1 for points and w = 0 for directions, the xyz of
+ * Mat4f::operator*( Quaternion ). Row i of the matrix gives result[ i ] and
+ * the translation sits in column 3, Values()[ i * 4 + 3 ], as set by
+ * Mat4f::Translation. Normalize gives the values of Vec3f::Normalize
+ * including zero for the zero vector. All kernels use SSE2 when available
+ * and run in parallel when compiled with OpenMP.
+ */
+class Interleaved
+{
+public:
+  static void
+  TransformPoints( const float* points, const unsigned int count, const unsigned int stride,
+                   const Mat4f& matrix, float* result, const unsigned int resultStride );
+  static void
+  TransformDirections( const float* directions, const unsigned int count, const unsigned int stride,
+                       const Mat4f& matrix, float* result, const unsigned int resultStride );
+  static void
+  Normalize( const float* vectors, const unsigned int count, const unsigned int stride,
+             float* result, const unsigned int resultStride );
+
+protected:
+private:
+  Interleaved( void );
+
+};
+
+#endif /* MATH_INTERLEAVED_HPP_ */
@@ -0,0 +1,332 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file KdTree3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "KdTree3f.hpp"
+
+#include "Vec3f.hpp"
+
+#include <algorithm>
+#include <cfloat>
+
+#define KDTREE_TASK_MINIMUM 4096
+#define KDTREE_QUERY_CHUNK  64
+
+/* orders point indices by one coordinate of interleaved xyz positions */
+struct KdTree3fCompare
+{
+  const float*  points;
+  unsigned int  axis;
+
+  bool
+  operator ()( const unsigned int a, const unsigned int b ) const
+  {
+    return points[ a * 3 + axis ] < points[ b * 3 + axis ];
+  }
+};
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+KdTree3f::KdTree3f( void ) { return; }
+
+KdTree3f::KdTree3f( const KdTree3f& other ) :
+  m_Points( other.m_Points ),
+  m_Indices( other.m_Indices ),
+  m_Axes( other.m_Axes )
+{
+  return;
+}
+
+KdTree3f::~KdTree3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+KdTree3f::Build( const Vec3f* points, const unsigned int count )
+{
+  const float* values = count ? points[ 0 ].Values() : 0;
+
+  Rebuild( values, values + 1, values + 2, sizeof( Vec3f ) / sizeof( float ), count );
+}
+
+void
+KdTree3f::Build( const float* x, const float* y, const float* z, const unsigned int count )
+{
+  Rebuild( x, y, z, 1, count );
+}
+
+void
+KdTree3f::Clear( void )
+{
+  m_Points.clear();
+  m_Indices.clear();
+  m_Axes.clear();
+}
+
+unsigned int
+KdTree3f::Points( void ) const
+{
+  return m_Indices.size();
+}
+
+unsigned int
+KdTree3f::Nearest( const Vec3f& point, const unsigned int k,
+                   unsigned int* indices, float* distancesSq ) const
+{
+  const float  query[ 3 ] = { point.X(), point.Y(), point.Z() };
+  unsigned int found      = 0;
+
+  if ( k ) SearchNearest( 0, m_Indices.size(), query, k, indices, distancesSq, found );
+
+  return found;
+}
+
+unsigned int
+KdTree3f::Radius( const Vec3f& point, const float radius,
+                  unsigned int* indices, const unsigned int capacity ) const
+{
+  const float  query[ 3 ] = { point.X(), point.Y(), point.Z() };
+  unsigned int found      = 0;
+
+  if ( capacity ) SearchRadius( 0, m_Indices.size(), query, radius * radius, indices, capacity, found );
+
+  return found;
+}
+
+void
+KdTree3f::Nearest( const Vec3f* points, const unsigned int count, const unsigned int k,
+                   unsigned int* indices, float* distancesSq ) const
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for schedule( dynamic, KDTREE_QUERY_CHUNK )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+  {
+    unsigned int* rowIndices   = indices + (unsigned long)i * k;
+    float*        rowDistances = distancesSq + (unsigned long)i * k;
+
+    for ( unsigned int j = Nearest( points[ i ], k, rowIndices, rowDistances ); j < k; j++ )
+    {
+      rowIndices[ j ]   = ~0u;
+      rowDistances[ j ] = FLT_MAX;
+    }
+  }
+}
+
+void
+KdTree3f::Radius( const Vec3f* points, const unsigned int count, const float radius,
+                  const unsigned int capacity, unsigned int* counts, unsigned int* indices ) const
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for schedule( dynamic, KDTREE_QUERY_CHUNK )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    counts[ i ] = Radius( points[ i ], radius, indices + (unsigned long)i * capacity, capacity );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+void
+KdTree3f::Rebuild( const float* x, const float* y, const float* z, const unsigned int stride,
+                   const unsigned int count )
+{
+  if ( count == 0 )
+  {
+    Clear();
+    return;
+  }
+
+  std::vector< float > source( 3 * count );
+  Range                root;
+
+  root.first = 0;
+  root.last  = count;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    root.min[ i ] =  FLT_MAX;
+    root.max[ i ] = -FLT_MAX;
+  }
+
+  m_Indices.resize( count );
+  m_Axes.assign( count, 0 );
+
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    const float p[ 3 ] = { x[ i * stride ], y[ i * stride ], z[ i * stride ] };
+
+    for ( unsigned int a = 0; a < 3; a++ )
+    {
+      source[ i * 3 + a ] = p[ a ];
+      root.min[ a ] = p[ a ] < root.min[ a ] ? p[ a ] : root.min[ a ];
+      root.max[ a ] = p[ a ] > root.max[ a ] ? p[ a ] : root.max[ a ];
+    }
+
+    m_Indices[ i ] = i;
+  }
+
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > KDTREE_TASK_MINIMUM )
+  #pragma omp single
+#endif
+  Subdivide( root, &source[ 0 ] );
+
+  /* store the points in tree order so subtrees are contiguous */
+  m_Points.resize( 3 * count );
+
+  for ( unsigned int i = 0; i < count; i++ )
+    for ( unsigned int a = 0; a < 3; a++ )
+      m_Points[ i * 3 + a ] = source[ m_Indices[ i ] * 3 + a ];
+}
+
+void
+KdTree3f::SearchNearest( const unsigned int first, const unsigned int last, const float* point,
+                         const unsigned int k, unsigned int* indices, float* distancesSq,
+                         unsigned int& found ) const
+{
+  if ( first >= last ) return;
+
+  const unsigned int mid = first + ( last - first ) / 2;
+  const float*       p   = &m_Points[ mid * 3 ];
+  const float        dx  = point[ 0 ] - p[ 0 ];
+  const float        dy  = point[ 1 ] - p[ 1 ];
+  const float        dz  = point[ 2 ] - p[ 2 ];
+  const float        d   = dx * dx + dy * dy + dz * dz;
+
+  /* insertion into the sorted result, the farthest drops out once full */
+  if ( found < k || d < distancesSq[ k - 1 ] )
+  {
+    unsigned int slot = found < k ? found++ : k - 1;
+
+    for ( ; slot > 0 && distancesSq[ slot - 1 ] > d; slot-- )
+    {
+      distancesSq[ slot ] = distancesSq[ slot - 1 ];
+      indices[ slot ]     = indices[ slot - 1 ];
+    }
+
+    distancesSq[ slot ] = d;
+    indices[ slot ]     = m_Indices[ mid ];
+  }
+
+  if ( last - first == 1 ) return;
+
+  const float diff = point[ m_Axes[ mid ] ] - p[ m_Axes[ mid ] ];
+
+  if ( diff < 0.0f )
+  {
+    SearchNearest( first, mid, point, k, indices, distancesSq, found );
+
+    if ( found < k || diff * diff < distancesSq[ k - 1 ] )
+      SearchNearest( mid + 1, last, point, k, indices, distancesSq, found );
+  }
+  else
+  {
+    SearchNearest( mid + 1, last, point, k, indices, distancesSq, found );
+
+    if ( found < k || diff * diff < distancesSq[ k - 1 ] )
+      SearchNearest( first, mid, point, k, indices, distancesSq, found );
+  }
+}
+
+void
+KdTree3f::SearchRadius( const unsigned int first, const unsigned int last, const float* point,
+                        const float radiusSq, unsigned int* indices, const unsigned int capacity,
+                        unsigned int& found ) const
+{
+  if ( first >= last || found == capacity ) return;
+
+  const unsigned int mid = first + ( last - first ) / 2;
+  const float*       p   = &m_Points[ mid * 3 ];
+  const float        dx  = point[ 0 ] - p[ 0 ];
+  const float        dy  = point[ 1 ] - p[ 1 ];
+  const float        dz  = point[ 2 ] - p[ 2 ];
+
+  if ( dx * dx + dy * dy + dz * dz <= radiusSq )
+  {
+    indices[ found++ ] = m_Indices[ mid ];
+
+    if ( found == capacity ) return;
+  }
+
+  if ( last - first == 1 ) return;
+
+  const float diff = point[ m_Axes[ mid ] ] - p[ m_Axes[ mid ] ];
+
+  if ( diff <= 0.0f || diff * diff <= radiusSq )
+    SearchRadius( first, mid, point, radiusSq, indices, capacity, found );
+
+  if ( diff >= 0.0f || diff * diff <= radiusSq )
+    SearchRadius( mid + 1, last, point, radiusSq, indices, capacity, found );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+KdTree3f::Subdivide( const Range range, const float* source )
+{
+  if ( range.last - range.first <= 1 ) return;
+
+  const float        extent[ 3 ] = { range.max[ 0 ] - range.min[ 0 ],
+                                     range.max[ 1 ] - range.min[ 1 ],
+                                     range.max[ 2 ] - range.min[ 2 ] };
+  const unsigned int axis        = extent[ 0 ] >= extent[ 1 ] && extent[ 0 ] >= extent[ 2 ] ? 0 :
+                                   extent[ 1 ] >= extent[ 2 ] ? 1 : 2;
+  const unsigned int mid         = range.first + ( range.last - range.first ) / 2;
+  KdTree3fCompare    compare;
+
+  compare.points = source;
+  compare.axis   = axis;
+
+  std::nth_element( m_Indices.begin() + range.first, m_Indices.begin() + mid,
+                    m_Indices.begin() + range.last, compare );
+
+  m_Axes[ mid ] = axis;
+
+  const float split = source[ m_Indices[ mid ] * 3 + axis ];
+  Range       left  = range;
+  Range       right = range;
+
+  left.last        = mid;
+  left.max[ axis ] = split;
+
+  right.first       = mid + 1;
+  right.min[ axis ] = split;
+
+#if defined( _OPENMP )
+  #pragma omp task if ( mid - range.first > KDTREE_TASK_MINIMUM )
+#endif
+  Subdivide( left, source );
+
+  Subdivide( right, source );
+}
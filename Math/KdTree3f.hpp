@@ -0,0 +1,112 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file KdTree3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_KDTREE3F_HPP_
+#define MATH_KDTREE3F_HPP_
+
+#include <vector>
+
+class Vec3f;
+
+/*
+ * GeekEngine::KdTree3f
+ *
+ * Static k-d tree over points with an implicit layout: the points are
+ * reordered so the median of every range [ first, last ) sits at its middle
+ * and splits it along the axis on which the range's bounds are longest.
+ * No nodes are stored besides one split axis byte per point, and the
+ * points of a subtree are contiguous. Subtrees are built as parallel tasks
+ * when compiled with OpenMP.
+ *
+ * Nearest writes the indices, as passed to Build, and squared distances of
+ * the k closest points in ascending order and returns how many were found.
+ * Radius returns the points within radius, at most capacity, unordered.
+ * The batched overloads run one query per point, in parallel with OpenMP,
+ * and write row i of their outputs at i * k or i * capacity; rows of
+ * Nearest with fewer than k points are padded with ~0u and FLT_MAX.
+ */
+class KdTree3f
+{
+public:
+  KdTree3f( void );
+  KdTree3f( const KdTree3f& );
+  virtual
+  ~KdTree3f( void );
+
+  void
+  Build( const Vec3f* points, const unsigned int count );
+  void
+  Build( const float* x, const float* y, const float* z, const unsigned int count );
+  void
+  Clear( void );
+
+  unsigned int
+  Points( void ) const;
+
+  unsigned int
+  Nearest( const Vec3f& point, const unsigned int k,
+           unsigned int* indices, float* distancesSq ) const;
+  unsigned int
+  Radius( const Vec3f& point, const float radius,
+          unsigned int* indices, const unsigned int capacity ) const;
+
+  void
+  Nearest( const Vec3f* points, const unsigned int count, const unsigned int k,
+           unsigned int* indices, float* distancesSq ) const;
+  void
+  Radius( const Vec3f* points, const unsigned int count, const float radius,
+          const unsigned int capacity, unsigned int* counts, unsigned int* indices ) const;
+
+protected:
+  void
+  Rebuild( const float* x, const float* y, const float* z, const unsigned int stride,
+           const unsigned int count );
+  void
+  SearchNearest( const unsigned int first, const unsigned int last, const float* point,
+                 const unsigned int k, unsigned int* indices, float* distancesSq,
+                 unsigned int& found ) const;
+  void
+  SearchRadius( const unsigned int first, const unsigned int last, const float* point,
+                const float radiusSq, unsigned int* indices, const unsigned int capacity,
+                unsigned int& found ) const;
+
+private:
+  /* range of the index array with the bounds of its points */
+  struct Range
+  {
+    unsigned int  first;
+    unsigned int  last;
+    float         min[ 3 ];
+    float         max[ 3 ];
+  };
+
+  void
+  Subdivide( const Range range, const float* source );
+
+  std::vector< float >          m_Points;
+  std::vector< unsigned int >   m_Indices;
+  std::vector< unsigned char >  m_Axes;
+
+};
+
+#endif /* MATH_KDTREE3F_HPP_ */
@@ -2,6 +2,7 @@
 
 #include "Vec2d.hpp"
 #include "Vec3d.hpp"
+#include "Mat3f.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -24,6 +25,13 @@ Mat3d::Mat3d( const Mat3d& other )
   memcpy( m_Values, other.m_Values, MATRIX_SIZE );
 }
 
+Mat3d::Mat3d( const Mat3f& matrix )
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 3; col++ )
+      m_Values[ row ][ col ] = matrix[ row ][ col ];
+}
+
 Mat3d::Mat3d( const Vec3d& row1, const Vec3d& row2, const Vec3d& row3 )
 {
   m_Values[ 0 ][ 0 ] = row1.X(); m_Values[ 0 ][ 1 ] = row1.Y(); m_Values[ 0 ][ 2 ] = row1.Z();
@@ -210,9 +218,9 @@ Mat3d::Set( const unsigned int row, const unsigned int col, const double& value
 void
 Mat3d::Print( void ) const
 {
-  printf( "( %f | %f | %f )", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
-  printf( "( %f | %f | %f )", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
-  printf( "( %f | %f | %f )", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
 }
 
 /* ************************************************** */
@@ -30,11 +30,15 @@ class Vec3d;
 /*
  * GeekEngine::Mat3d
  */
+class Mat3f;
+
 class Mat3d
 {
 public:
   Mat3d( void );
   Mat3d( const Mat3d& );
+  explicit
+  Mat3d( const Mat3f& matrix );
   Mat3d( const Vec3d&, const Vec3d&, const Vec3d& );
   virtual
   ~Mat3d( void );
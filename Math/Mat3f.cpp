@@ -2,6 +2,7 @@
 
 #include "Vec2f.hpp"
 #include "Vec3f.hpp"
+#include "Mat3d.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -24,6 +25,13 @@ Mat3f::Mat3f( const Mat3f& other )
   memcpy( m_Values, other.m_Values, MATRIX_SIZE );
 }
 
+Mat3f::Mat3f( const Mat3d& matrix )
+{
+  for ( unsigned int row = 0; row < 3; row++ )
+    for ( unsigned int col = 0; col < 3; col++ )
+      m_Values[ row ][ col ] = (float)matrix[ row ][ col ];
+}
+
 Mat3f::Mat3f( const Vec3f& row1, const Vec3f& row2, const Vec3f& row3 )
 {
   m_Values[ 0 ][ 0 ] = row1.X(); m_Values[ 0 ][ 1 ] = row1.Y(); m_Values[ 0 ][ 2 ] = row1.Z();
@@ -210,9 +218,9 @@ Mat3f::Set( const unsigned int row, const unsigned int col, const float& value )
 void
 Mat3f::Print( void ) const
 {
-  printf( "( %f | %f | %f )", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
-  printf( "( %f | %f | %f )", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
-  printf( "( %f | %f | %f )", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+  printf( "( %f | %f | %f )\n", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
 }
 
 /* ************************************************** */
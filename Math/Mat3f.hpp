@@ -30,11 +30,15 @@ class Vec3f;
 /*
  * GeekEngine::Mat3f
  */
+class Mat3d;
+
 class Mat3f
 {
 public:
   Mat3f( void );
   Mat3f( const Mat3f& );
+  explicit
+  Mat3f( const Mat3d& matrix );
   Mat3f( const Vec3f&, const Vec3f&, const Vec3f& );
   virtual
   ~Mat3f( void );
@@ -154,9 +154,9 @@ Mat3i::Set( const unsigned int row, const unsigned int col, const int& value )
 void
 Mat3i::Print( void ) const
 {
-  printf( "( %i | %i | %i )", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
-  printf( "( %i | %i | %i )", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
-  printf( "( %i | %i | %i )", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
+  printf( "( %i | %i | %i )\n", m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+  printf( "( %i | %i | %i )\n", m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+  printf( "( %i | %i | %i )\n", m_Values[ 2 ][ 0 ], m_Values[ 2 ][ 1 ], m_Values[ 2 ][ 2 ] );
 }
 
 /* ************************************************** */
@@ -22,10 +22,12 @@
  */
 
 #include "Mat4d.hpp"
+#include "Profile.hpp"
 
 #include "Vec2f.hpp"
 #include "Vec3d.hpp"
 #include "Quaterniond.hpp"
+#include "Mat4f.hpp"
 #include "../GeekMathConstants.hpp"
 
 #include <cmath>
@@ -41,9 +43,18 @@ Mat4d::Mat4d( void )
 
 Mat4d::Mat4d( const Mat4d& matrix )
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4D_COPY, 1 );
+
   memcpy( m_Values, matrix.m_Values, MATRIX_SIZE );
 }
 
+Mat4d::Mat4d( const Mat4f& matrix )
+{
+  for ( unsigned int row = 0; row < 4; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      m_Values[ row ][ col ] = matrix[ row ][ col ];
+}
+
 Mat4d::~Mat4d( void ) { return; }
 
 Mat4d
@@ -169,6 +180,8 @@ Mat4d::Transformation( const Quaterniond& vector ) const
 Mat4d
 Mat4d::Inverse( void ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4D_INVERSE, 1 );
+
   Mat4d result;
 
   double         inv[ 16 ], det;
@@ -400,6 +413,8 @@ Mat4d::Orthographic( const double Left, const double Right,
 Mat4d
 Mat4d::operator *( const Mat4d& factor ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4D_MULTIPLY, 1 );
+
   Mat4d result;
 
   for ( unsigned int row = 0 ; row < 4 ; row++ )
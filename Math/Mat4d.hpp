@@ -26,12 +26,15 @@
 
 class Vec3d;
 class Quaterniond;
+class Mat4f;
 
 class Mat4d
 {
 public:
   Mat4d( void );
   Mat4d( const Mat4d& matrix );
+  explicit
+  Mat4d( const Mat4f& matrix );
   virtual
   ~Mat4d( void );
 
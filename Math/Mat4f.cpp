@@ -22,10 +22,12 @@
  */
 
 #include "Mat4f.hpp"
+#include "Profile.hpp"
 
 #include "Vec2f.hpp"
 #include "Vec3f.hpp"
 #include "Quaternion.hpp"
+#include "Mat4d.hpp"
 #include "../GeekMathConstants.hpp"
 
 #include <cmath>
@@ -41,9 +43,18 @@ Mat4f::Mat4f( void )
 
 Mat4f::Mat4f( const Mat4f& matrix )
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4F_COPY, 1 );
+
   memcpy( m_Values, matrix.m_Values, MATRIX_SIZE );
 }
 
+Mat4f::Mat4f( const Mat4d& matrix )
+{
+  for ( unsigned int row = 0; row < 4; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+      m_Values[ row ][ col ] = (float)matrix[ row ][ col ];
+}
+
 Mat4f::Mat4f( const float* values )
 {
   memcpy( m_Values, values, MATRIX_SIZE );
@@ -174,6 +185,8 @@ Mat4f::Transformation( const Quaternion& vector ) const
 Mat4f
 Mat4f::Inverse( void ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4F_INVERSE, 1 );
+
   Mat4f result;
 
   float         inv[ 16 ], det;
@@ -404,6 +417,8 @@ Mat4f::Orthographic( const float Left, const float Right,
 Mat4f
 Mat4f::operator *( const Mat4f& factor ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4F_MULTIPLY, 1 );
+
   Mat4f result;
 
   for ( unsigned int row = 0 ; row < 4 ; row++ )
@@ -26,12 +26,15 @@
 
 class Vec3f;
 class Quaternion;
+class Mat4d;
 
 class Mat4f
 {
 public:
   Mat4f( void );
   Mat4f( const Mat4f& );
+  explicit
+  Mat4f( const Mat4d& matrix );
   Mat4f( const float* );
   virtual
   ~Mat4f( void );
@@ -0,0 +1,114 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fConstSpan.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Mat4fConstSpan.hpp"
+
+#include "Mat4f.hpp"
+#include "Mat4fSpan.hpp"
+
+#include <cstring>
+
+#define PARALLEL_MINIMUM 4096
+
+static const unsigned int MATRIX_SIZE = sizeof( float ) * 16;
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fConstSpan::Mat4fConstSpan( const float* values, const unsigned int count ) :
+  m_Values( values ),
+  m_Count( count )
+{
+  return;
+}
+
+Mat4fConstSpan::Mat4fConstSpan( const Mat4fConstSpan& span ) :
+  m_Values( span.m_Values ),
+  m_Count( span.m_Count )
+{
+  return;
+}
+
+Mat4fConstSpan::Mat4fConstSpan( const Mat4fSpan& span ) :
+  m_Values( span.Values() ),
+  m_Count( span.Count() )
+{
+  return;
+}
+
+Mat4fConstSpan::~Mat4fConstSpan( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fConstView
+Mat4fConstSpan::operator []( const unsigned int i ) const
+{
+  return Mat4fConstView( m_Values + i * 16 );
+}
+
+Mat4fConstSpan
+Mat4fConstSpan::Subspan( const unsigned int first, const unsigned int count ) const
+{
+  return Mat4fConstSpan( m_Values + first * 16, count );
+}
+
+unsigned int
+Mat4fConstSpan::Count( void ) const
+{
+  return m_Count;
+}
+
+const float*
+Mat4fConstSpan::Values( void ) const
+{
+  return m_Values;
+}
+
+void
+Mat4fConstSpan::Get( Mat4f* matrices ) const
+{
+  const int count = (int)m_Count;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+    memcpy( matrices[ i ][ 0 ], m_Values + i * 16, MATRIX_SIZE );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
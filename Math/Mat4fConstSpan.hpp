@@ -0,0 +1,70 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fConstSpan.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_MAT4FCONSTSPAN_HPP_
+#define MATH_MAT4FCONSTSPAN_HPP_
+
+#include "Mat4fConstView.hpp"
+
+class Mat4f;
+class Mat4fSpan;
+
+/*
+ * GeekEngine::Mat4fConstSpan
+ *
+ * Read only Mat4fSpan over 16 * count consecutive floats owned by the
+ * caller, e.g. matrices in a memory mapping opened with PROT_READ. A
+ * Mat4fSpan converts to it implicitly.
+ */
+class Mat4fConstSpan
+{
+public:
+  Mat4fConstSpan( const float* values, const unsigned int count );
+  Mat4fConstSpan( const Mat4fConstSpan& span );
+  Mat4fConstSpan( const Mat4fSpan& span );
+  virtual
+  ~Mat4fConstSpan( void );
+
+  Mat4fConstView
+  operator []( const unsigned int i ) const;
+  Mat4fConstSpan
+  Subspan( const unsigned int first, const unsigned int count ) const;
+  unsigned int
+  Count( void ) const;
+  const float*
+  Values( void ) const;
+
+  void
+  Get( Mat4f* matrices ) const;
+
+protected:
+private:
+  Mat4fConstSpan&
+  operator =( const Mat4fConstSpan& );
+
+  const float* m_Values;
+  unsigned int m_Count;
+
+};
+
+#endif /* MATH_MAT4FCONSTSPAN_HPP_ */
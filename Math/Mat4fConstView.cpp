@@ -0,0 +1,157 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fConstView.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Mat4fConstView.hpp"
+
+#include "Vec3f.hpp"
+#include "Quaternion.hpp"
+#include "Mat4f.hpp"
+#include "Mat4fView.hpp"
+
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fConstView::Mat4fConstView( const float* values ) :
+  m_Values( values )
+{
+  return;
+}
+
+Mat4fConstView::Mat4fConstView( const Mat4fConstView& view ) :
+  m_Values( view.m_Values )
+{
+  return;
+}
+
+Mat4fConstView::Mat4fConstView( const Mat4fView& view ) :
+  m_Values( view.Values() )
+{
+  return;
+}
+
+Mat4fConstView::~Mat4fConstView( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4f
+Mat4fConstView::Get( void ) const
+{
+  return Mat4f( m_Values );
+}
+
+Vec3f
+Mat4fConstView::Transformation( const Vec3f& vector ) const
+{
+  return ( Transformation( Quaternion( vector ) ) ).XYZ();
+}
+
+Quaternion
+Mat4fConstView::Transformation( const Quaternion& vector ) const
+{
+  Quaternion result( 0, 0, 0, 0 );
+
+  for( unsigned int i = 0; i < 4; i++ )
+    for( unsigned int j = 0; j < 4; j++ )
+      result[ i ] += m_Values[ j * 4 + i ] * vector[ j ];
+
+  return result;
+}
+
+Mat4f
+Mat4fConstView::Inverse( void ) const
+{
+  return Get().Inverse();
+}
+
+Mat4f
+Mat4fConstView::Transpose( void ) const
+{
+  return Get().Transpose();
+}
+
+Mat4f
+Mat4fConstView::operator *( const Mat4f& factor ) const
+{
+  Mat4f result;
+
+  for ( unsigned int row = 0 ; row < 4 ; row++ )
+    for ( unsigned int col = 0 ; col < 4; col++ )
+      result.Set( row, col, m_Values[ row * 4 + 0 ] * factor[ 0 ][ col ] +
+                            m_Values[ row * 4 + 1 ] * factor[ 1 ][ col ] +
+                            m_Values[ row * 4 + 2 ] * factor[ 2 ][ col ] +
+                            m_Values[ row * 4 + 3 ] * factor[ 3 ][ col ] );
+
+  return result;
+}
+
+Quaternion
+Mat4fConstView::operator *( const Quaternion& q ) const
+{
+  const float* m = m_Values;
+
+  return Quaternion(
+    m[ 0 ]  * q.X() + m[ 1 ]  * q.Y() + m[ 2 ]  * q.Z() + m[ 3 ]  * q.W(),
+    m[ 4 ]  * q.X() + m[ 5 ]  * q.Y() + m[ 6 ]  * q.Z() + m[ 7 ]  * q.W(),
+    m[ 8 ]  * q.X() + m[ 9 ]  * q.Y() + m[ 10 ] * q.Z() + m[ 11 ] * q.W(),
+    m[ 12 ] * q.X() + m[ 13 ] * q.Y() + m[ 14 ] * q.Z() + m[ 15 ] * q.W()
+  );
+}
+
+const float*
+Mat4fConstView::operator []( const unsigned int row ) const
+{
+  return m_Values + row * 4;
+}
+
+const float*
+Mat4fConstView::Values( void ) const
+{
+  return m_Values;
+}
+
+void
+Mat4fConstView::Print( void ) const
+{
+  for ( unsigned int row = 0; row < 4; row++ )
+    printf( "( %f | %f | %f | %f )\n", m_Values[ row * 4 + 0 ], m_Values[ row * 4 + 1 ],
+                                       m_Values[ row * 4 + 2 ], m_Values[ row * 4 + 3 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,84 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fConstView.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_MAT4FCONSTVIEW_HPP_
+#define MATH_MAT4FCONSTVIEW_HPP_
+
+class Vec3f;
+class Quaternion;
+class Mat4f;
+class Mat4fView;
+
+/*
+ * GeekEngine::Mat4fConstView
+ *
+ * Read only Mat4fView over 16 consecutive floats owned by the caller, in
+ * the row major order of Mat4f::Values, e.g. a matrix in a read only
+ * memory mapping. A Mat4fView converts to it implicitly.
+ */
+class Mat4fConstView
+{
+public:
+  explicit
+  Mat4fConstView( const float* values );
+  Mat4fConstView( const Mat4fConstView& view );
+  Mat4fConstView( const Mat4fView& view );
+  virtual
+  ~Mat4fConstView( void );
+
+  Mat4f
+  Get( void ) const;
+
+  Vec3f
+  Transformation( const Vec3f& ) const;
+  Quaternion
+  Transformation( const Quaternion& ) const;
+  Mat4f
+  Inverse( void ) const;
+  Mat4f
+  Transpose( void ) const;
+
+  Mat4f
+  operator *( const Mat4f& ) const;
+  Quaternion
+  operator *( const Quaternion& ) const;
+
+  const float*
+  operator []( const unsigned int ) const;
+
+  const float*
+  Values( void ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  Mat4fConstView&
+  operator =( const Mat4fConstView& );
+
+  const float* m_Values;
+
+};
+
+#endif /* MATH_MAT4FCONSTVIEW_HPP_ */
@@ -0,0 +1,233 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fSpan.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Mat4fSpan.hpp"
+#include "Profile.hpp"
+
+#include "Mat4f.hpp"
+
+#include <cstring>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+
+static const unsigned int MATRIX_SIZE = sizeof( float ) * 16;
+
+/* result = left * right with all three row major, result may alias either */
+static inline void
+Multiply( const float* left, const float* right, float* result )
+{
+#if defined( __SSE2__ )
+  const __m128 row0 = _mm_loadu_ps( right + 0 );
+  const __m128 row1 = _mm_loadu_ps( right + 4 );
+  const __m128 row2 = _mm_loadu_ps( right + 8 );
+  const __m128 row3 = _mm_loadu_ps( right + 12 );
+  __m128       rows[ 4 ];
+
+  for ( unsigned int row = 0; row < 4; row++ )
+  {
+    const float* l = left + row * 4;
+
+    rows[ row ] = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( l[ 0 ] ), row0 ),
+                                                      _mm_mul_ps( _mm_set1_ps( l[ 1 ] ), row1 ) ),
+                                          _mm_mul_ps( _mm_set1_ps( l[ 2 ] ), row2 ) ),
+                              _mm_mul_ps( _mm_set1_ps( l[ 3 ] ), row3 ) );
+  }
+
+  for ( unsigned int row = 0; row < 4; row++ )
+    _mm_storeu_ps( result + row * 4, rows[ row ] );
+#else
+  float values[ 16 ];
+
+  for ( unsigned int row = 0 ; row < 4 ; row++ )
+    for ( unsigned int col = 0 ; col < 4; col++ )
+      values[ row * 4 + col ] = left[ row * 4 + 0 ] * right[ 0 * 4 + col ] +
+                                left[ row * 4 + 1 ] * right[ 1 * 4 + col ] +
+                                left[ row * 4 + 2 ] * right[ 2 * 4 + col ] +
+                                left[ row * 4 + 3 ] * right[ 3 * 4 + col ];
+
+  memcpy( result, values, MATRIX_SIZE );
+#endif
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fSpan::Mat4fSpan( float* values, const unsigned int count ) :
+  m_Values( values ),
+  m_Count( count )
+{
+  return;
+}
+
+Mat4fSpan::Mat4fSpan( const Mat4fSpan& span ) :
+  m_Values( span.m_Values ),
+  m_Count( span.m_Count )
+{
+  return;
+}
+
+Mat4fSpan::~Mat4fSpan( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fView
+Mat4fSpan::operator []( const unsigned int i ) const
+{
+  return Mat4fView( m_Values + i * 16 );
+}
+
+Mat4fSpan
+Mat4fSpan::Subspan( const unsigned int first, const unsigned int count ) const
+{
+  return Mat4fSpan( m_Values + first * 16, count );
+}
+
+unsigned int
+Mat4fSpan::Count( void ) const
+{
+  return m_Count;
+}
+
+float*
+Mat4fSpan::Values( void ) const
+{
+  return m_Values;
+}
+
+void
+Mat4fSpan::Set( const Mat4f* matrices ) const
+{
+  const int count = (int)m_Count;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+    memcpy( m_Values + i * 16, matrices[ i ].Values(), MATRIX_SIZE );
+}
+
+void
+Mat4fSpan::Get( Mat4f* matrices ) const
+{
+  const int count = (int)m_Count;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+    memcpy( matrices[ i ][ 0 ], m_Values + i * 16, MATRIX_SIZE );
+}
+
+void
+Mat4fSpan::Premultiply( const Mat4f& matrix ) const
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4FSPAN_MULTIPLY, m_Count );
+
+  const int count = (int)m_Count;
+  float     left[ 16 ];
+
+  /* the matrix may live in the span itself */
+  memcpy( left, matrix.Values(), MATRIX_SIZE );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+    Multiply( left, m_Values + i * 16, m_Values + i * 16 );
+}
+
+void
+Mat4fSpan::Postmultiply( const Mat4f& matrix ) const
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_MAT4FSPAN_MULTIPLY, m_Count );
+
+  const int count = (int)m_Count;
+  float     right[ 16 ];
+
+  /* the matrix may live in the span itself */
+  memcpy( right, matrix.Values(), MATRIX_SIZE );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+    Multiply( m_Values + i * 16, right, m_Values + i * 16 );
+}
+
+void
+Mat4fSpan::Transpose( void ) const
+{
+  const int count = (int)m_Count;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < count; i++ )
+  {
+    float* m = m_Values + i * 16;
+
+#if defined( __SSE2__ )
+    __m128 row0 = _mm_loadu_ps( m + 0 );
+    __m128 row1 = _mm_loadu_ps( m + 4 );
+    __m128 row2 = _mm_loadu_ps( m + 8 );
+    __m128 row3 = _mm_loadu_ps( m + 12 );
+
+    _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+
+    _mm_storeu_ps( m + 0, row0 );
+    _mm_storeu_ps( m + 4, row1 );
+    _mm_storeu_ps( m + 8, row2 );
+    _mm_storeu_ps( m + 12, row3 );
+#else
+    for ( unsigned int row = 0; row < 4; row++ )
+      for ( unsigned int col = row + 1; col < 4; col++ )
+      {
+        const float value = m[ row * 4 + col ];
+
+        m[ row * 4 + col ] = m[ col * 4 + row ];
+        m[ col * 4 + row ] = value;
+      }
+#endif
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
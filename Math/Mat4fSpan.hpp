@@ -0,0 +1,80 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fSpan.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_MAT4FSPAN_HPP_
+#define MATH_MAT4FSPAN_HPP_
+
+#include "Mat4fView.hpp"
+
+class Mat4f;
+
+/*
+ * GeekEngine::Mat4fSpan
+ *
+ * A run of 4x4 matrices that aliases 16 * count consecutive floats owned
+ * by the caller, e.g. an instance buffer that is memory mapped or staged
+ * for the GPU. Mat4f itself cannot be laid over such memory as it carries
+ * a virtual table. Like a pointer the span does not own its floats and a
+ * const span still writes through its views, Mat4fConstSpan is the read
+ * only counterpart.
+ *
+ * The batch functions work in place with SSE2 and in parallel when
+ * compiled with OpenMP. Products give the same values as Mat4f::operator*.
+ */
+class Mat4fSpan
+{
+public:
+  Mat4fSpan( float* values, const unsigned int count );
+  Mat4fSpan( const Mat4fSpan& span );
+  virtual
+  ~Mat4fSpan( void );
+
+  Mat4fView
+  operator []( const unsigned int i ) const;
+  Mat4fSpan
+  Subspan( const unsigned int first, const unsigned int count ) const;
+  unsigned int
+  Count( void ) const;
+  float*
+  Values( void ) const;
+
+  void
+  Set( const Mat4f* matrices ) const;
+  void
+  Get( Mat4f* matrices ) const;
+
+  void
+  Premultiply( const Mat4f& matrix ) const;
+  void
+  Postmultiply( const Mat4f& matrix ) const;
+  void
+  Transpose( void ) const;
+
+protected:
+private:
+  float*       m_Values;
+  unsigned int m_Count;
+
+};
+
+#endif /* MATH_MAT4FSPAN_HPP_ */
@@ -0,0 +1,195 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fView.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Mat4fView.hpp"
+
+#include "Vec3f.hpp"
+#include "Quaternion.hpp"
+#include "Mat4f.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+static const unsigned int MATRIX_SIZE = sizeof( float ) * 16;
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fView::Mat4fView( float* values ) :
+  m_Values( values )
+{
+  return;
+}
+
+Mat4fView::Mat4fView( const Mat4fView& view ) :
+  m_Values( view.m_Values )
+{
+  return;
+}
+
+Mat4fView::~Mat4fView( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Mat4fView&
+Mat4fView::operator =( const Mat4fView& matrix )
+{
+  memmove( m_Values, matrix.m_Values, MATRIX_SIZE );
+
+  return *this;
+}
+
+Mat4fView&
+Mat4fView::operator =( const Mat4f& matrix )
+{
+  Set( matrix );
+
+  return *this;
+}
+
+void
+Mat4fView::Set( const Mat4f& matrix )
+{
+  memcpy( m_Values, matrix.Values(), MATRIX_SIZE );
+}
+
+Mat4f
+Mat4fView::Get( void ) const
+{
+  return Mat4f( m_Values );
+}
+
+Vec3f
+Mat4fView::Transformation( const Vec3f& vector ) const
+{
+  return ( Transformation( Quaternion( vector ) ) ).XYZ();
+}
+
+Quaternion
+Mat4fView::Transformation( const Quaternion& vector ) const
+{
+  Quaternion result( 0, 0, 0, 0 );
+
+  for( unsigned int i = 0; i < 4; i++ )
+    for( unsigned int j = 0; j < 4; j++ )
+      result[ i ] += m_Values[ j * 4 + i ] * vector[ j ];
+
+  return result;
+}
+
+Mat4f
+Mat4fView::Inverse( void ) const
+{
+  return Get().Inverse();
+}
+
+Mat4f
+Mat4fView::Transpose( void ) const
+{
+  return Get().Transpose();
+}
+
+Mat4f
+Mat4fView::operator *( const Mat4f& factor ) const
+{
+  Mat4f result;
+
+  for ( unsigned int row = 0 ; row < 4 ; row++ )
+    for ( unsigned int col = 0 ; col < 4; col++ )
+      result.Set( row, col, m_Values[ row * 4 + 0 ] * factor[ 0 ][ col ] +
+                            m_Values[ row * 4 + 1 ] * factor[ 1 ][ col ] +
+                            m_Values[ row * 4 + 2 ] * factor[ 2 ][ col ] +
+                            m_Values[ row * 4 + 3 ] * factor[ 3 ][ col ] );
+
+  return result;
+}
+
+Quaternion
+Mat4fView::operator *( const Quaternion& q ) const
+{
+  const float* m = m_Values;
+
+  return Quaternion(
+    m[ 0 ]  * q.X() + m[ 1 ]  * q.Y() + m[ 2 ]  * q.Z() + m[ 3 ]  * q.W(),
+    m[ 4 ]  * q.X() + m[ 5 ]  * q.Y() + m[ 6 ]  * q.Z() + m[ 7 ]  * q.W(),
+    m[ 8 ]  * q.X() + m[ 9 ]  * q.Y() + m[ 10 ] * q.Z() + m[ 11 ] * q.W(),
+    m[ 12 ] * q.X() + m[ 13 ] * q.Y() + m[ 14 ] * q.Z() + m[ 15 ] * q.W()
+  );
+}
+
+Mat4fView&
+Mat4fView::operator *=( const Mat4f& factor )
+{
+  Set( *this * factor );
+
+  return *this;
+}
+
+float*
+Mat4fView::operator []( const unsigned int row )
+{
+  return m_Values + row * 4;
+}
+
+const float*
+Mat4fView::operator []( const unsigned int row ) const
+{
+  return m_Values + row * 4;
+}
+
+const float*
+Mat4fView::Values( void ) const
+{
+  return m_Values;
+}
+
+void
+Mat4fView::Set( const unsigned int row, const unsigned int col, const float& value )
+{
+  m_Values[ row * 4 + col ] = value;
+}
+
+void
+Mat4fView::Print( void ) const
+{
+  for ( unsigned int row = 0; row < 4; row++ )
+    printf( "( %f | %f | %f | %f )\n", m_Values[ row * 4 + 0 ], m_Values[ row * 4 + 1 ],
+                                       m_Values[ row * 4 + 2 ], m_Values[ row * 4 + 3 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
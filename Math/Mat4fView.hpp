@@ -0,0 +1,95 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Mat4fView.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_MAT4FVIEW_HPP_
+#define MATH_MAT4FVIEW_HPP_
+
+class Vec3f;
+class Quaternion;
+class Mat4f;
+
+/*
+ * GeekEngine::Mat4fView
+ *
+ * A 4x4 matrix that aliases 16 consecutive floats owned by the caller, in
+ * the row major order of Mat4f::Values. Reads and writes go straight to
+ * that memory. Copying a view aliases the same floats, assigning a matrix
+ * or another view writes the values. Results that are new matrices, like
+ * products and inverses, come back as Mat4f. Mat4fConstView is the read
+ * only counterpart.
+ */
+class Mat4fView
+{
+public:
+  explicit
+  Mat4fView( float* values );
+  Mat4fView( const Mat4fView& view );
+  virtual
+  ~Mat4fView( void );
+
+  Mat4fView&
+  operator =( const Mat4fView& matrix );
+  Mat4fView&
+  operator =( const Mat4f& matrix );
+
+  void
+  Set( const Mat4f& matrix );
+  Mat4f
+  Get( void ) const;
+
+  Vec3f
+  Transformation( const Vec3f& ) const;
+  Quaternion
+  Transformation( const Quaternion& ) const;
+  Mat4f
+  Inverse( void ) const;
+  Mat4f
+  Transpose( void ) const;
+
+  Mat4f
+  operator *( const Mat4f& ) const;
+  Quaternion
+  operator *( const Quaternion& ) const;
+  Mat4fView&
+  operator *=( const Mat4f& );
+
+  float*
+  operator []( const unsigned int );
+  const float*
+  operator []( const unsigned int ) const;
+
+  const float*
+  Values( void ) const;
+
+  void
+  Set( const unsigned int row, const unsigned int col, const float& );
+  void
+  Print( void ) const;
+
+protected:
+private:
+  float* m_Values;
+
+};
+
+#endif /* MATH_MAT4FVIEW_HPP_ */
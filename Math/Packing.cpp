@@ -0,0 +1,911 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Packing.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Packing.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Vec4f.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+#define PARALLEL_BLOCK   1024
+#define PACKING_BLOCK    256
+#define SNORM16          32767.0f
+#define SNORM8           127.0f
+#define UNORM16          65535.0f
+#define UNORM8           255.0f
+
+/* round to nearest even like cvtps2dq in the default rounding mode */
+static inline float
+Round( const float value )
+{
+  float       result   = floorf( value );
+  const float fraction = value - result;
+
+  if ( fraction > 0.5f || ( fraction == 0.5f && fmodf( result, 2.0f ) != 0.0f ) ) result += 1.0f;
+
+  return result;
+}
+
+static inline float
+Sign( const float value )
+{
+  return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+/* unfolded square coordinates of codes cx, cy back on the octahedron */
+static inline void
+Unfold( const float cx, const float cy, const float scale, float& x, float& y, float& z )
+{
+  x = cx / scale;
+  y = cy / scale;
+
+  if ( x < -1.0f ) x = -1.0f;
+  if ( y < -1.0f ) y = -1.0f;
+
+  z = 1.0f - fabsf( x ) - fabsf( y );
+
+  if ( z < 0.0f )
+  {
+    const float foldX = ( 1.0f - fabsf( y ) ) * Sign( x );
+    const float foldY = ( 1.0f - fabsf( x ) ) * Sign( y );
+
+    x = foldX;
+    y = foldY;
+  }
+}
+
+/*
+ * Squared sine between the decoded code and x, y, z up to the length of
+ * x, y, z. The cross product keeps the small angles a cosine would round
+ * away in single precision.
+ */
+static inline float
+Misalignment( const float cx, const float cy, const float scale, const float x, const float y, const float z )
+{
+  float dx, dy, dz;
+
+  Unfold( cx, cy, scale, dx, dy, dz );
+
+  const float crossX = dy * z - dz * y;
+  const float crossY = dz * x - dx * z;
+  const float crossZ = dx * y - dy * x;
+
+  return ( crossX * crossX + crossY * crossY + crossZ * crossZ ) / ( dx * dx + dy * dy + dz * dz );
+}
+
+/*
+ * Projects onto the octahedron and unfolds the lower half, then tests the
+ * four codes around the projection. The operations are the ones of
+ * OctahedralEncode4 in the same order so both give the same codes.
+ */
+static inline void
+OctahedralEncode( const float x, const float y, const float z, const float scale, int& cx, int& cy )
+{
+  const float length = fabsf( x ) + fabsf( y ) + fabsf( z );
+  float       px     = length != 0.0f ? x / length : 0.0f;
+  float       py     = length != 0.0f ? y / length : 0.0f;
+
+  if ( z < 0.0f )
+  {
+    const float foldX = ( 1.0f - fabsf( py ) ) * Sign( px );
+    const float foldY = ( 1.0f - fabsf( px ) ) * Sign( py );
+
+    px = foldX;
+    py = foldY;
+  }
+
+  const float fx    = floorf( px * scale );
+  const float fy    = floorf( py * scale );
+  float       bestX = fx;
+  float       bestY = fy;
+  float       best  = Misalignment( fx, fy, scale, x, y, z );
+
+  for ( unsigned int candidate = 1; candidate < 4; candidate++ )
+  {
+    float testX = fx + (float)( candidate & 1 );
+    float testY = fy + (float)( candidate >> 1 );
+
+    if ( testX > scale ) testX = scale;
+    if ( testY > scale ) testY = scale;
+
+    const float misalignment = Misalignment( testX, testY, scale, x, y, z );
+
+    if ( misalignment < best )
+    {
+      best  = misalignment;
+      bestX = testX;
+      bestY = testY;
+    }
+  }
+
+  cx = (int)bestX;
+  cy = (int)bestY;
+}
+
+static inline void
+OctahedralDecode( const int cx, const int cy, const float scale, Vec3f& normal )
+{
+  float x, y, z;
+
+  Unfold( (float)cx, (float)cy, scale, x, y, z );
+
+  const float length = sqrtf( x * x + y * y + z * z );
+
+  normal.Set( x / length, y / length, z / length );
+}
+
+template< class Code >
+static inline Code
+EncodeValue( float value, const float low, const float scale )
+{
+  if ( !( value == value ) ) value = 0.0f;
+
+  value = value < low ? low : value;
+  value = value > 1.0f ? 1.0f : value;
+
+  return (Code)(int)Round( value * scale );
+}
+
+static inline float
+DecodeValue( const float code, const float scale )
+{
+  const float value = code / scale;
+
+  return value < -1.0f ? -1.0f : value;
+}
+
+#if defined( __SSE2__ )
+static inline __m128
+Abs4( const __m128 value )
+{
+  return _mm_andnot_ps( _mm_set1_ps( -0.0f ), value );
+}
+
+static inline __m128
+Select4( const __m128 mask, const __m128 a, const __m128 b )
+{
+  return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+}
+
+static inline __m128
+Sign4( const __m128 value )
+{
+  return Select4( _mm_cmpge_ps( value, _mm_setzero_ps() ), _mm_set1_ps( 1.0f ), _mm_set1_ps( -1.0f ) );
+}
+
+static inline __m128
+Floor4( const __m128 value )
+{
+  const __m128 truncated = _mm_cvtepi32_ps( _mm_cvttps_epi32( value ) );
+
+  return _mm_sub_ps( truncated, _mm_and_ps( _mm_cmpgt_ps( truncated, value ), _mm_set1_ps( 1.0f ) ) );
+}
+
+static inline void
+Unfold4( const __m128 cx, const __m128 cy, const __m128 scale, __m128& x, __m128& y, __m128& z )
+{
+  const __m128 one = _mm_set1_ps( 1.0f );
+
+  x = _mm_max_ps( _mm_div_ps( cx, scale ), _mm_set1_ps( -1.0f ) );
+  y = _mm_max_ps( _mm_div_ps( cy, scale ), _mm_set1_ps( -1.0f ) );
+  z = _mm_sub_ps( _mm_sub_ps( one, Abs4( x ) ), Abs4( y ) );
+
+  const __m128 fold  = _mm_cmplt_ps( z, _mm_setzero_ps() );
+  const __m128 foldX = _mm_mul_ps( _mm_sub_ps( one, Abs4( y ) ), Sign4( x ) );
+  const __m128 foldY = _mm_mul_ps( _mm_sub_ps( one, Abs4( x ) ), Sign4( y ) );
+
+  x = Select4( fold, foldX, x );
+  y = Select4( fold, foldY, y );
+}
+
+static inline __m128
+Misalignment4( const __m128 cx, const __m128 cy, const __m128 scale, const __m128 x, const __m128 y, const __m128 z )
+{
+  __m128 dx, dy, dz;
+
+  Unfold4( cx, cy, scale, dx, dy, dz );
+
+  const __m128 crossX = _mm_sub_ps( _mm_mul_ps( dy, z ), _mm_mul_ps( dz, y ) );
+  const __m128 crossY = _mm_sub_ps( _mm_mul_ps( dz, x ), _mm_mul_ps( dx, z ) );
+  const __m128 crossZ = _mm_sub_ps( _mm_mul_ps( dx, y ), _mm_mul_ps( dy, x ) );
+  const __m128 cross  = _mm_add_ps( _mm_add_ps( _mm_mul_ps( crossX, crossX ), _mm_mul_ps( crossY, crossY ) ),
+                                    _mm_mul_ps( crossZ, crossZ ) );
+  const __m128 length = _mm_add_ps( _mm_add_ps( _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ), _mm_mul_ps( dz, dz ) );
+
+  return _mm_div_ps( cross, length );
+}
+
+static inline void
+OctahedralEncode4( const __m128 x, const __m128 y, const __m128 z, const float scale, __m128i& cx, __m128i& cy )
+{
+  const __m128 one     = _mm_set1_ps( 1.0f );
+  const __m128 scale4  = _mm_set1_ps( scale );
+  const __m128 length  = _mm_add_ps( _mm_add_ps( Abs4( x ), Abs4( y ) ), Abs4( z ) );
+  const __m128 nonZero = _mm_cmpneq_ps( length, _mm_setzero_ps() );
+  __m128       px      = _mm_and_ps( nonZero, _mm_div_ps( x, length ) );
+  __m128       py      = _mm_and_ps( nonZero, _mm_div_ps( y, length ) );
+
+  const __m128 fold  = _mm_cmplt_ps( z, _mm_setzero_ps() );
+  const __m128 foldX = _mm_mul_ps( _mm_sub_ps( one, Abs4( py ) ), Sign4( px ) );
+  const __m128 foldY = _mm_mul_ps( _mm_sub_ps( one, Abs4( px ) ), Sign4( py ) );
+
+  px = Select4( fold, foldX, px );
+  py = Select4( fold, foldY, py );
+
+  const __m128 fx    = Floor4( _mm_mul_ps( px, scale4 ) );
+  const __m128 fy    = Floor4( _mm_mul_ps( py, scale4 ) );
+  __m128       bestX = fx;
+  __m128       bestY = fy;
+  __m128       best  = Misalignment4( fx, fy, scale4, x, y, z );
+
+  for ( unsigned int candidate = 1; candidate < 4; candidate++ )
+  {
+    const __m128 testX        = _mm_min_ps( _mm_add_ps( fx, _mm_set1_ps( (float)( candidate & 1 ) ) ), scale4 );
+    const __m128 testY        = _mm_min_ps( _mm_add_ps( fy, _mm_set1_ps( (float)( candidate >> 1 ) ) ), scale4 );
+    const __m128 misalignment = Misalignment4( testX, testY, scale4, x, y, z );
+    const __m128 better       = _mm_cmplt_ps( misalignment, best );
+
+    best  = Select4( better, misalignment, best );
+    bestX = Select4( better, testX, bestX );
+    bestY = Select4( better, testY, bestY );
+  }
+
+  cx = _mm_cvttps_epi32( bestX );
+  cy = _mm_cvttps_epi32( bestY );
+}
+
+static inline void
+OctahedralDecode4( const __m128i cx, const __m128i cy, const float scale, Vec3f* normals )
+{
+  __m128 x, y, z;
+
+  Unfold4( _mm_cvtepi32_ps( cx ), _mm_cvtepi32_ps( cy ), _mm_set1_ps( scale ), x, y, z );
+
+  const __m128 length = _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+                                                 _mm_mul_ps( z, z ) ) );
+  float        values[ 3 ][ 4 ];
+
+  _mm_storeu_ps( values[ 0 ], _mm_div_ps( x, length ) );
+  _mm_storeu_ps( values[ 1 ], _mm_div_ps( y, length ) );
+  _mm_storeu_ps( values[ 2 ], _mm_div_ps( z, length ) );
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    normals[ i ].Set( values[ 0 ][ i ], values[ 1 ][ i ], values[ 2 ][ i ] );
+}
+
+static inline void
+Gather4( const Vec3f* normals, __m128& x, __m128& y, __m128& z )
+{
+  x = _mm_setr_ps( normals[ 0 ].X(), normals[ 1 ].X(), normals[ 2 ].X(), normals[ 3 ].X() );
+  y = _mm_setr_ps( normals[ 0 ].Y(), normals[ 1 ].Y(), normals[ 2 ].Y(), normals[ 3 ].Y() );
+  z = _mm_setr_ps( normals[ 0 ].Z(), normals[ 1 ].Z(), normals[ 2 ].Z(), normals[ 3 ].Z() );
+}
+
+/* clamps to [ low, 1 ] with NaN as 0 and scales, converted in the default rounding mode */
+static inline __m128i
+Quantize4( const float* values, const float low, const float scale )
+{
+  __m128 value = _mm_loadu_ps( values );
+
+  value = _mm_and_ps( value, _mm_cmpord_ps( value, value ) );
+  value = _mm_min_ps( _mm_max_ps( value, _mm_set1_ps( low ) ), _mm_set1_ps( 1.0f ) );
+
+  return _mm_cvtps_epi32( _mm_mul_ps( value, _mm_set1_ps( scale ) ) );
+}
+
+static inline void
+Dequantize4( const __m128i codes, const float scale, float* values )
+{
+  _mm_storeu_ps( values, _mm_max_ps( _mm_div_ps( _mm_cvtepi32_ps( codes ), _mm_set1_ps( scale ) ),
+                                     _mm_set1_ps( -1.0f ) ) );
+}
+#endif
+
+static void
+Encode( const float* values, const unsigned int count, short* codes )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i code = Quantize4( values + i, -1.0f, SNORM16 );
+
+    _mm_storel_epi64( (__m128i*)( codes + i ), _mm_packs_epi32( code, code ) );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    codes[ i ] = EncodeValue< short >( values[ i ], -1.0f, SNORM16 );
+}
+
+static void
+Encode( const float* values, const unsigned int count, signed char* codes )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i code  = Quantize4( values + i, -1.0f, SNORM8 );
+    const __m128i words = _mm_packs_epi32( code, code );
+    const int     bytes = _mm_cvtsi128_si32( _mm_packs_epi16( words, words ) );
+
+    memcpy( codes + i, &bytes, sizeof( bytes ) );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    codes[ i ] = EncodeValue< signed char >( values[ i ], -1.0f, SNORM8 );
+}
+
+static void
+Encode( const float* values, const unsigned int count, unsigned short* codes )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  /* biased into the signed range for the saturating pack */
+  const __m128i bias = _mm_set1_epi32( 0x8000 );
+
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i code  = _mm_sub_epi32( Quantize4( values + i, 0.0f, UNORM16 ), bias );
+    const __m128i words = _mm_xor_si128( _mm_packs_epi32( code, code ), _mm_set1_epi16( (short)0x8000 ) );
+
+    _mm_storel_epi64( (__m128i*)( codes + i ), words );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    codes[ i ] = EncodeValue< unsigned short >( values[ i ], 0.0f, UNORM16 );
+}
+
+static void
+Encode( const float* values, const unsigned int count, unsigned char* codes )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i code  = Quantize4( values + i, 0.0f, UNORM8 );
+    const __m128i words = _mm_packs_epi32( code, code );
+    const int     bytes = _mm_cvtsi128_si32( _mm_packus_epi16( words, words ) );
+
+    memcpy( codes + i, &bytes, sizeof( bytes ) );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    codes[ i ] = EncodeValue< unsigned char >( values[ i ], 0.0f, UNORM8 );
+}
+
+static void
+Decode( const short* codes, const unsigned int count, float* values )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i words = _mm_loadl_epi64( (const __m128i*)( codes + i ) );
+
+    Dequantize4( _mm_srai_epi32( _mm_unpacklo_epi16( words, words ), 16 ), SNORM16, values + i );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    values[ i ] = DecodeValue( codes[ i ], SNORM16 );
+}
+
+static void
+Decode( const signed char* codes, const unsigned int count, float* values )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    int bytes;
+
+    memcpy( &bytes, codes + i, sizeof( bytes ) );
+
+    const __m128i packed = _mm_cvtsi32_si128( bytes );
+    const __m128i words  = _mm_unpacklo_epi8( packed, packed );
+
+    Dequantize4( _mm_srai_epi32( _mm_unpacklo_epi16( words, words ), 24 ), SNORM8, values + i );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    values[ i ] = DecodeValue( codes[ i ], SNORM8 );
+}
+
+static void
+Decode( const unsigned short* codes, const unsigned int count, float* values )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    const __m128i words = _mm_loadl_epi64( (const __m128i*)( codes + i ) );
+
+    Dequantize4( _mm_unpacklo_epi16( words, _mm_setzero_si128() ), UNORM16, values + i );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    values[ i ] = DecodeValue( codes[ i ], UNORM16 );
+}
+
+static void
+Decode( const unsigned char* codes, const unsigned int count, float* values )
+{
+  unsigned int i = 0;
+
+#if defined( __SSE2__ )
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    int bytes;
+
+    memcpy( &bytes, codes + i, sizeof( bytes ) );
+
+    const __m128i words = _mm_unpacklo_epi8( _mm_cvtsi32_si128( bytes ), _mm_setzero_si128() );
+
+    Dequantize4( _mm_unpacklo_epi16( words, _mm_setzero_si128() ), UNORM8, values + i );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    values[ i ] = DecodeValue( codes[ i ], UNORM8 );
+}
+
+template< class Code >
+static void
+EncodeAll( const float* values, const unsigned int count, Code* codes )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+    Encode( values + first, last - first, codes + first );
+  }
+}
+
+template< class Code >
+static void
+DecodeAll( const Code* codes, const unsigned int count, float* values )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+    Decode( codes + first, last - first, values + first );
+  }
+}
+
+/* vector components are gathered into blocks so the kernels see full registers */
+template< class Vector, class Code >
+static void
+EncodeVectors( const Vector* vectors, const unsigned int count, const unsigned int size, Code* codes )
+{
+  const int blocks = ( count + PACKING_BLOCK - 1 ) / PACKING_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PACKING_BLOCK;
+    const unsigned int last  = first + PACKING_BLOCK < count ? first + PACKING_BLOCK : count;
+    float              buffer[ 4 * PACKING_BLOCK ];
+
+    for ( unsigned int i = first; i < last; i++ )
+      memcpy( buffer + ( i - first ) * size, vectors[ i ].Values(), size * sizeof( float ) );
+
+    Encode( buffer, ( last - first ) * size, codes + first * size );
+  }
+}
+
+template< class Vector, class Code >
+static void
+DecodeVectors( const Code* codes, const unsigned int count, const unsigned int size, Vector* vectors )
+{
+  const int blocks = ( count + PACKING_BLOCK - 1 ) / PACKING_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PACKING_BLOCK;
+    const unsigned int last  = first + PACKING_BLOCK < count ? first + PACKING_BLOCK : count;
+    float              buffer[ 4 * PACKING_BLOCK ];
+
+    Decode( codes + first * size, ( last - first ) * size, buffer );
+
+    for ( unsigned int i = first; i < last; i++ )
+      memcpy( &vectors[ i ][ 0 ], buffer + ( i - first ) * size, size * sizeof( float ) );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Packing::Packing( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+Packing::EncodeOctahedral16( const Vec3f& normal )
+{
+  int cx, cy;
+
+  OctahedralEncode( normal.X(), normal.Y(), normal.Z(), SNORM16, cx, cy );
+
+  return ( (unsigned int)cx & 0xffffu ) | ( (unsigned int)cy << 16 );
+}
+
+Vec3f
+Packing::DecodeOctahedral16( const unsigned int code )
+{
+  Vec3f normal;
+
+  OctahedralDecode( (short)( code & 0xffffu ), (short)( code >> 16 ), SNORM16, normal );
+
+  return normal;
+}
+
+unsigned short
+Packing::EncodeOctahedral8( const Vec3f& normal )
+{
+  int cx, cy;
+
+  OctahedralEncode( normal.X(), normal.Y(), normal.Z(), SNORM8, cx, cy );
+
+  return (unsigned short)( ( (unsigned int)cx & 0xffu ) | ( ( (unsigned int)cy & 0xffu ) << 8 ) );
+}
+
+Vec3f
+Packing::DecodeOctahedral8( const unsigned short code )
+{
+  Vec3f normal;
+
+  OctahedralDecode( (signed char)( code & 0xffu ), (signed char)( code >> 8 ), SNORM8, normal );
+
+  return normal;
+}
+
+void
+Packing::EncodeOctahedral16( const Vec3f* normals, const unsigned int count, unsigned int* codes )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    for ( ; i + 4 <= last; i += 4 )
+    {
+      __m128  x, y, z;
+      __m128i cx, cy;
+
+      Gather4( normals + i, x, y, z );
+      OctahedralEncode4( x, y, z, SNORM16, cx, cy );
+
+      const __m128i code = _mm_or_si128( _mm_and_si128( cx, _mm_set1_epi32( 0xffff ) ), _mm_slli_epi32( cy, 16 ) );
+
+      _mm_storeu_si128( (__m128i*)( codes + i ), code );
+    }
+#endif
+
+    for ( ; i < last; i++ )
+      codes[ i ] = EncodeOctahedral16( normals[ i ] );
+  }
+}
+
+void
+Packing::DecodeOctahedral16( const unsigned int* codes, const unsigned int count, Vec3f* normals )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    for ( ; i + 4 <= last; i += 4 )
+    {
+      const __m128i code = _mm_loadu_si128( (const __m128i*)( codes + i ) );
+
+      OctahedralDecode4( _mm_srai_epi32( _mm_slli_epi32( code, 16 ), 16 ), _mm_srai_epi32( code, 16 ),
+                         SNORM16, normals + i );
+    }
+#endif
+
+    for ( ; i < last; i++ )
+      OctahedralDecode( (short)( codes[ i ] & 0xffffu ), (short)( codes[ i ] >> 16 ), SNORM16, normals[ i ] );
+  }
+}
+
+void
+Packing::EncodeOctahedral8( const Vec3f* normals, const unsigned int count, unsigned short* codes )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    for ( ; i + 4 <= last; i += 4 )
+    {
+      __m128  x, y, z;
+      __m128i cx, cy;
+
+      Gather4( normals + i, x, y, z );
+      OctahedralEncode4( x, y, z, SNORM8, cx, cy );
+
+      /* codes fit 16 bits, biased for the saturating pack */
+      const __m128i code = _mm_or_si128( _mm_and_si128( cx, _mm_set1_epi32( 0xff ) ),
+                                         _mm_slli_epi32( _mm_and_si128( cy, _mm_set1_epi32( 0xff ) ), 8 ) );
+      const __m128i biased = _mm_sub_epi32( code, _mm_set1_epi32( 0x8000 ) );
+
+      _mm_storel_epi64( (__m128i*)( codes + i ),
+                        _mm_xor_si128( _mm_packs_epi32( biased, biased ), _mm_set1_epi16( (short)0x8000 ) ) );
+    }
+#endif
+
+    for ( ; i < last; i++ )
+      codes[ i ] = EncodeOctahedral8( normals[ i ] );
+  }
+}
+
+void
+Packing::DecodeOctahedral8( const unsigned short* codes, const unsigned int count, Vec3f* normals )
+{
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+    unsigned int       i     = first;
+
+#if defined( __SSE2__ )
+    for ( ; i + 4 <= last; i += 4 )
+    {
+      const __m128i words = _mm_loadl_epi64( (const __m128i*)( codes + i ) );
+      const __m128i code  = _mm_unpacklo_epi16( words, _mm_setzero_si128() );
+
+      OctahedralDecode4( _mm_srai_epi32( _mm_slli_epi32( code, 24 ), 24 ),
+                         _mm_srai_epi32( _mm_slli_epi32( code, 16 ), 24 ), SNORM8, normals + i );
+    }
+#endif
+
+    for ( ; i < last; i++ )
+      OctahedralDecode( (signed char)( codes[ i ] & 0xffu ), (signed char)( codes[ i ] >> 8 ), SNORM8, normals[ i ] );
+  }
+}
+
+void
+Packing::EncodeSnorm( const float* values, const unsigned int count, short* codes )
+{
+  EncodeAll( values, count, codes );
+}
+
+void
+Packing::EncodeSnorm( const float* values, const unsigned int count, signed char* codes )
+{
+  EncodeAll( values, count, codes );
+}
+
+void
+Packing::EncodeUnorm( const float* values, const unsigned int count, unsigned short* codes )
+{
+  EncodeAll( values, count, codes );
+}
+
+void
+Packing::EncodeUnorm( const float* values, const unsigned int count, unsigned char* codes )
+{
+  EncodeAll( values, count, codes );
+}
+
+void
+Packing::DecodeSnorm( const short* codes, const unsigned int count, float* values )
+{
+  DecodeAll( codes, count, values );
+}
+
+void
+Packing::DecodeSnorm( const signed char* codes, const unsigned int count, float* values )
+{
+  DecodeAll( codes, count, values );
+}
+
+void
+Packing::DecodeUnorm( const unsigned short* codes, const unsigned int count, float* values )
+{
+  DecodeAll( codes, count, values );
+}
+
+void
+Packing::DecodeUnorm( const unsigned char* codes, const unsigned int count, float* values )
+{
+  DecodeAll( codes, count, values );
+}
+
+void
+Packing::EncodeSnorm( const Vec2f* vectors, const unsigned int count, short* codes )
+{
+  EncodeVectors( vectors, count, 2, codes );
+}
+
+void
+Packing::EncodeSnorm( const Vec2f* vectors, const unsigned int count, signed char* codes )
+{
+  EncodeVectors( vectors, count, 2, codes );
+}
+
+void
+Packing::EncodeUnorm( const Vec2f* vectors, const unsigned int count, unsigned short* codes )
+{
+  EncodeVectors( vectors, count, 2, codes );
+}
+
+void
+Packing::EncodeUnorm( const Vec2f* vectors, const unsigned int count, unsigned char* codes )
+{
+  EncodeVectors( vectors, count, 2, codes );
+}
+
+void
+Packing::DecodeSnorm( const short* codes, const unsigned int count, Vec2f* vectors )
+{
+  DecodeVectors( codes, count, 2, vectors );
+}
+
+void
+Packing::DecodeSnorm( const signed char* codes, const unsigned int count, Vec2f* vectors )
+{
+  DecodeVectors( codes, count, 2, vectors );
+}
+
+void
+Packing::DecodeUnorm( const unsigned short* codes, const unsigned int count, Vec2f* vectors )
+{
+  DecodeVectors( codes, count, 2, vectors );
+}
+
+void
+Packing::DecodeUnorm( const unsigned char* codes, const unsigned int count, Vec2f* vectors )
+{
+  DecodeVectors( codes, count, 2, vectors );
+}
+
+void
+Packing::EncodeSnorm( const Vec4f* vectors, const unsigned int count, short* codes )
+{
+  EncodeVectors( vectors, count, 4, codes );
+}
+
+void
+Packing::EncodeSnorm( const Vec4f* vectors, const unsigned int count, signed char* codes )
+{
+  EncodeVectors( vectors, count, 4, codes );
+}
+
+void
+Packing::EncodeUnorm( const Vec4f* vectors, const unsigned int count, unsigned short* codes )
+{
+  EncodeVectors( vectors, count, 4, codes );
+}
+
+void
+Packing::EncodeUnorm( const Vec4f* vectors, const unsigned int count, unsigned char* codes )
+{
+  EncodeVectors( vectors, count, 4, codes );
+}
+
+void
+Packing::DecodeSnorm( const short* codes, const unsigned int count, Vec4f* vectors )
+{
+  DecodeVectors( codes, count, 4, vectors );
+}
+
+void
+Packing::DecodeSnorm( const signed char* codes, const unsigned int count, Vec4f* vectors )
+{
+  DecodeVectors( codes, count, 4, vectors );
+}
+
+void
+Packing::DecodeUnorm( const unsigned short* codes, const unsigned int count, Vec4f* vectors )
+{
+  DecodeVectors( codes, count, 4, vectors );
+}
+
+void
+Packing::DecodeUnorm( const unsigned char* codes, const unsigned int count, Vec4f* vectors )
+{
+  DecodeVectors( codes, count, 4, vectors );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
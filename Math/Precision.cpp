@@ -0,0 +1,821 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Precision.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Precision.hpp"
+#include "Profile.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec2d.hpp"
+#include "Vec3f.hpp"
+#include "Vec3d.hpp"
+#include "Vec4f.hpp"
+#include "Vec4d.hpp"
+#include "Quaternion.hpp"
+#include "Quaterniond.hpp"
+#include "Mat3f.hpp"
+#include "Mat3d.hpp"
+#include "Mat4f.hpp"
+#include "Mat4d.hpp"
+#include "Aabb3f.hpp"
+#include "Aabb3d.hpp"
+#include "Ray3f.hpp"
+#include "Ray3d.hpp"
+#include "Vec2h.hpp"
+#include "Vec3h.hpp"
+#include "Vec4h.hpp"
+#include "Quaternionh.hpp"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined( __AVX__ ) || defined( __F16C__ )
+  #include <immintrin.h>
+#elif defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+#define PARALLEL_BLOCK   1024
+#define HALF_BLOCK       256
+
+/*
+ * Sets the rounding mode of the calling thread for a batch and returns
+ * the previous state. Without SSE2 rounding follows the environment and
+ * truncation is done in Narrow.
+ */
+static inline unsigned int
+RoundingBegin( const unsigned int mode )
+{
+#if defined( __SSE2__ )
+  const unsigned int state = _mm_getcsr();
+
+  _mm_setcsr( ( state & ~_MM_ROUND_MASK ) |
+              ( mode & PRECISION_TOWARD_ZERO ? _MM_ROUND_TOWARD_ZERO : _MM_ROUND_NEAREST ) );
+
+  return state;
+#else
+  return mode;
+#endif
+}
+
+static inline void
+RoundingEnd( const unsigned int state )
+{
+#if defined( __SSE2__ )
+  _mm_setcsr( state );
+#else
+  (void)state;
+#endif
+}
+
+static inline float
+Narrow( const double value, const unsigned int mode )
+{
+  double clamped = value;
+
+  if ( mode & PRECISION_CLAMP )
+  {
+    if ( clamped > FLT_MAX )  clamped = FLT_MAX;
+    if ( clamped < -FLT_MAX ) clamped = -FLT_MAX;
+  }
+
+  float result = (float)clamped;
+
+  /* one step towards zero when the conversion rounded away from it */
+  if ( ( mode & PRECISION_TOWARD_ZERO ) && fabs( (double)result ) > fabs( clamped ) )
+  {
+    unsigned int bits;
+
+    memcpy( &bits, &result, sizeof( bits ) );
+    bits--;
+    memcpy( &result, &bits, sizeof( result ) );
+  }
+
+  return result;
+}
+
+static inline void
+Narrow( const double* source, float* target, const unsigned int count, const unsigned int mode )
+{
+  unsigned int i = 0;
+
+#if defined( __AVX__ )
+  const __m256d low4  = _mm256_set1_pd( -FLT_MAX );
+  const __m256d high4 = _mm256_set1_pd( FLT_MAX );
+
+  for ( ; i + 4 <= count; i += 4 )
+  {
+    __m256d values = _mm256_loadu_pd( source + i );
+
+    /* NaN passes through as max and min return their second operand */
+    if ( mode & PRECISION_CLAMP ) values = _mm256_min_pd( high4, _mm256_max_pd( low4, values ) );
+
+    _mm_storeu_ps( target + i, _mm256_cvtpd_ps( values ) );
+  }
+#endif
+
+#if defined( __SSE2__ )
+  const __m128d low2  = _mm_set1_pd( -FLT_MAX );
+  const __m128d high2 = _mm_set1_pd( FLT_MAX );
+
+  for ( ; i + 2 <= count; i += 2 )
+  {
+    __m128d values = _mm_loadu_pd( source + i );
+
+    if ( mode & PRECISION_CLAMP ) values = _mm_min_pd( high2, _mm_max_pd( low2, values ) );
+
+    _mm_storel_pi( (__m64*)( target + i ), _mm_cvtpd_ps( values ) );
+  }
+#endif
+
+  for ( ; i < count; i++ )
+    target[ i ] = Narrow( source[ i ], mode );
+}
+
+static inline void
+Widen( const float* source, double* target, const unsigned int count )
+{
+  unsigned int i = 0;
+
+#if defined( __AVX__ )
+  for ( ; i + 4 <= count; i += 4 )
+    _mm256_storeu_pd( target + i, _mm256_cvtps_pd( _mm_loadu_ps( source + i ) ) );
+#endif
+
+#if defined( __SSE2__ )
+  for ( ; i + 2 <= count; i += 2 )
+    _mm_storeu_pd( target + i, _mm_cvtps_pd( _mm_loadl_pi( _mm_setzero_ps(), (const __m64*)( source + i ) ) ) );
+#endif
+
+  for ( ; i < count; i++ )
+    target[ i ] = source[ i ];
+}
+
+/* round to nearest even as F16C does, NaN keeps its upper payload bits */
+static inline unsigned short
+SoftwareHalf( const float value )
+{
+  unsigned int bits;
+
+  memcpy( &bits, &value, sizeof( bits ) );
+
+  const unsigned int sign      = ( bits >> 16 ) & 0x8000u;
+  unsigned int       magnitude = bits & 0x7fffffffu;
+
+  /* 65536 and beyond, infinity and NaN */
+  if ( magnitude >= 0x47800000u )
+    return (unsigned short)( sign | ( magnitude > 0x7f800000u ? 0x7e00u | ( ( magnitude >> 13 ) & 0x3ffu ) : 0x7c00u ) );
+
+  /* below 2^-14 the result is denormal, adding 0.5 leaves the float with
+     2^-24 steps and the addition does the rounding */
+  if ( magnitude < 0x38800000u )
+  {
+    float denormal;
+
+    memcpy( &denormal, &magnitude, sizeof( denormal ) );
+    denormal += 0.5f;
+    memcpy( &magnitude, &denormal, sizeof( magnitude ) );
+
+    return (unsigned short)( sign | ( magnitude - 0x3f000000u ) );
+  }
+
+  /* rebias the exponent and round the 13 dropped bits, a carry may reach
+     the exponent and round to infinity */
+  magnitude += 0xc8000fffu + ( ( magnitude >> 13 ) & 1u );
+
+  return (unsigned short)( sign | ( magnitude >> 13 ) );
+}
+
+static inline float
+SoftwareSingle( const unsigned short half )
+{
+  unsigned int       bits     = ( half & 0x7fffu ) << 13;
+  const unsigned int exponent = bits & 0x0f800000u;
+  float              result;
+
+  bits += 0x38000000u;
+
+  /* infinity and NaN, signaling NaN is quieted as F16C does */
+  if ( exponent == 0x0f800000u )
+    bits = ( bits + 0x38000000u ) | ( half & 0x3ffu ? 0x00400000u : 0u );
+  else if ( exponent == 0 )
+  {
+    /* denormal, renormalized by the float subtraction */
+    bits += 0x00800000u;
+    memcpy( &result, &bits, sizeof( result ) );
+    result -= 6.103515625e-05f;
+    memcpy( &bits, &result, sizeof( bits ) );
+  }
+
+  bits |= ( half & 0x8000u ) << 16;
+  memcpy( &result, &bits, sizeof( result ) );
+
+  return result;
+}
+
+static inline void
+Halves( const float* source, unsigned short* target, const unsigned int count )
+{
+  unsigned int i = 0;
+
+#if defined( __F16C__ )
+  for ( ; i + 8 <= count; i += 8 )
+    _mm_storeu_si128( (__m128i*)( target + i ),
+                      _mm256_cvtps_ph( _mm256_loadu_ps( source + i ), _MM_FROUND_TO_NEAREST_INT ) );
+
+  for ( ; i + 4 <= count; i += 4 )
+    _mm_storel_epi64( (__m128i*)( target + i ), _mm_cvtps_ph( _mm_loadu_ps( source + i ), _MM_FROUND_TO_NEAREST_INT ) );
+#endif
+
+  for ( ; i < count; i++ )
+    target[ i ] = Precision::Half( source[ i ] );
+}
+
+static inline void
+Singles( const unsigned short* source, float* target, const unsigned int count )
+{
+  unsigned int i = 0;
+
+#if defined( __F16C__ )
+  for ( ; i + 8 <= count; i += 8 )
+    _mm256_storeu_ps( target + i, _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i*)( source + i ) ) ) );
+
+  for ( ; i + 4 <= count; i += 4 )
+    _mm_storeu_ps( target + i, _mm_cvtph_ps( _mm_loadl_epi64( (const __m128i*)( source + i ) ) ) );
+#endif
+
+  for ( ; i < count; i++ )
+    target[ i ] = Precision::Single( source[ i ] );
+}
+
+/* first component of the contiguous storage of every type */
+static inline const double* Data( const Vec2d& value )       { return value.Values(); }
+static inline const float*  Data( const Vec2f& value )       { return value.Values(); }
+static inline double*       Data( Vec2d& value )             { return &value[ 0 ]; }
+static inline float*        Data( Vec2f& value )             { return &value[ 0 ]; }
+static inline const double* Data( const Vec3d& value )       { return value.Values(); }
+static inline const float*  Data( const Vec3f& value )       { return value.Values(); }
+static inline double*       Data( Vec3d& value )             { return &value[ 0 ]; }
+static inline float*        Data( Vec3f& value )             { return &value[ 0 ]; }
+static inline const double* Data( const Quaterniond& value ) { return value.Values(); }
+static inline const float*  Data( const Quaternion& value )  { return value.Values(); }
+static inline double*       Data( Quaterniond& value )       { return &value[ 0 ]; }
+static inline float*        Data( Quaternion& value )        { return &value[ 0 ]; }
+static inline const double* Data( const Mat3d& value )       { return value.Values(); }
+static inline const float*  Data( const Mat3f& value )       { return value.Values(); }
+static inline double*       Data( Mat3d& value )             { return value[ 0 ]; }
+static inline float*        Data( Mat3f& value )             { return value[ 0 ]; }
+static inline const double* Data( const Mat4d& value )       { return value.Values(); }
+static inline const float*  Data( const Mat4f& value )       { return value.Values(); }
+static inline double*       Data( Mat4d& value )             { return value[ 0 ]; }
+static inline float*        Data( Mat4f& value )             { return value[ 0 ]; }
+static inline const double* Data( const Aabb3d& value )      { return value[ 0 ]; }
+static inline const float*  Data( const Aabb3f& value )      { return value[ 0 ]; }
+static inline double*       Data( Aabb3d& value )            { return value[ 0 ]; }
+static inline float*        Data( Aabb3f& value )            { return value[ 0 ]; }
+static inline const double* Data( const Ray3d& value )       { return value[ 0 ]; }
+static inline const float*  Data( const Ray3f& value )       { return value[ 0 ]; }
+static inline double*       Data( Ray3d& value )             { return value[ 0 ]; }
+static inline float*        Data( Ray3f& value )             { return value[ 0 ]; }
+static inline const float*  Data( const Vec4f& value )       { return value.Values(); }
+static inline float*        Data( Vec4f& value )             { return &value[ 0 ]; }
+
+static inline const unsigned short* Data( const Vec2h& value )       { return value.Values(); }
+static inline const unsigned short* Data( const Vec3h& value )       { return value.Values(); }
+static inline const unsigned short* Data( const Vec4h& value )       { return value.Values(); }
+static inline const unsigned short* Data( const Quaternionh& value ) { return value.Values(); }
+static inline unsigned short*       Data( Vec2h& value )             { return &value[ 0 ]; }
+static inline unsigned short*       Data( Vec3h& value )             { return &value[ 0 ]; }
+static inline unsigned short*       Data( Vec4h& value )             { return &value[ 0 ]; }
+static inline unsigned short*       Data( Quaternionh& value )       { return &value[ 0 ]; }
+
+/* arrays of the half types are converted as one run of halves */
+typedef char Vec2hPacked[ sizeof( Vec2h ) == 2 * sizeof( unsigned short ) ? 1 : -1 ];
+typedef char Vec3hPacked[ sizeof( Vec3h ) == 3 * sizeof( unsigned short ) ? 1 : -1 ];
+typedef char Vec4hPacked[ sizeof( Vec4h ) == 4 * sizeof( unsigned short ) ? 1 : -1 ];
+typedef char QuaternionhPacked[ sizeof( Quaternionh ) == 4 * sizeof( unsigned short ) ? 1 : -1 ];
+
+/* the rounding mode is per thread, every thread of the team sets its own */
+template< class Source, class Target >
+static void
+NarrowAll( const Source* source, Target* target, const unsigned int count, const unsigned int size,
+           const unsigned int mode )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > PARALLEL_MINIMUM )
+#endif
+  {
+    const unsigned int state = RoundingBegin( mode );
+
+#if defined( _OPENMP )
+    #pragma omp for
+#endif
+    for ( int i = 0; i < (int)count; i++ )
+      Narrow( Data( source[ i ] ), Data( target[ i ] ), size, mode );
+
+    RoundingEnd( state );
+  }
+}
+
+template< class Source, class Target >
+static void
+WidenAll( const Source* source, Target* target, const unsigned int count, const unsigned int size )
+{
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    Widen( Data( source[ i ] ), Data( target[ i ] ), size );
+}
+
+/* float components are gathered into blocks so F16C converts full registers */
+template< class Source, class Target >
+static void
+HalvesAll( const Source* source, Target* target, const unsigned int count, const unsigned int size )
+{
+  const int blocks = ( count + HALF_BLOCK - 1 ) / HALF_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * HALF_BLOCK;
+    const unsigned int last  = first + HALF_BLOCK < count ? first + HALF_BLOCK : count;
+    float              buffer[ 4 * HALF_BLOCK ];
+
+    for ( unsigned int i = first; i < last; i++ )
+      memcpy( buffer + ( i - first ) * size, Data( source[ i ] ), size * sizeof( float ) );
+
+    Halves( buffer, Data( target[ first ] ), ( last - first ) * size );
+  }
+}
+
+template< class Source, class Target >
+static void
+SinglesAll( const Source* source, Target* target, const unsigned int count, const unsigned int size )
+{
+  const int blocks = ( count + HALF_BLOCK - 1 ) / HALF_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * HALF_BLOCK;
+    const unsigned int last  = first + HALF_BLOCK < count ? first + HALF_BLOCK : count;
+    float              buffer[ 4 * HALF_BLOCK ];
+
+    Singles( Data( source[ first ] ), buffer, ( last - first ) * size );
+
+    for ( unsigned int i = first; i < last; i++ )
+      memcpy( Data( target[ i ] ), buffer + ( i - first ) * size, size * sizeof( float ) );
+  }
+}
+
+static inline void
+Kernel( const double* source, float* target, const unsigned int count, const unsigned int mode )
+{
+  Narrow( source, target, count, mode );
+}
+
+static inline void
+Kernel( const float* source, double* target, const unsigned int count, const unsigned int )
+{
+  Widen( source, target, count );
+}
+
+static inline void
+Kernel( const float* source, unsigned short* target, const unsigned int count, const unsigned int )
+{
+  Halves( source, target, count );
+}
+
+static inline void
+Kernel( const unsigned short* source, float* target, const unsigned int count, const unsigned int )
+{
+  Singles( source, target, count );
+}
+
+/* components lying stride bytes apart are gathered into blocks, converted and scattered */
+template< class Source, class Target >
+static void
+StridedAll( const Source* source, const unsigned int sourceStride, Target* target,
+            const unsigned int targetStride, const unsigned int count, const unsigned int size,
+            const unsigned int mode )
+{
+  const int   blocks = ( count + HALF_BLOCK - 1 ) / HALF_BLOCK;
+  const char* input  = reinterpret_cast< const char* >( source );
+  char*       output = reinterpret_cast< char* >( target );
+
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > PARALLEL_MINIMUM )
+#endif
+  {
+    const unsigned int state = RoundingBegin( mode );
+
+#if defined( _OPENMP )
+    #pragma omp for
+#endif
+    for ( int block = 0; block < blocks; block++ )
+    {
+      const unsigned int first = block * HALF_BLOCK;
+      const unsigned int last  = first + HALF_BLOCK < count ? first + HALF_BLOCK : count;
+      Source             gathered[ 4 * HALF_BLOCK ];
+      Target             converted[ 4 * HALF_BLOCK ];
+
+      for ( unsigned int i = first; i < last; i++ )
+        memcpy( gathered + ( i - first ) * size, input + (unsigned long)i * sourceStride, size * sizeof( Source ) );
+
+      Kernel( gathered, converted, ( last - first ) * size, mode );
+
+      for ( unsigned int i = first; i < last; i++ )
+        memcpy( output + (unsigned long)i * targetStride, converted + ( i - first ) * size, size * sizeof( Target ) );
+    }
+
+    RoundingEnd( state );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Precision::Precision( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Precision::Convert( const double* source, float* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > PARALLEL_MINIMUM )
+#endif
+  {
+    const unsigned int state = RoundingBegin( mode );
+
+#if defined( _OPENMP )
+    #pragma omp for
+#endif
+    for ( int block = 0; block < blocks; block++ )
+    {
+      const unsigned int first = block * PARALLEL_BLOCK;
+      const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+      Narrow( source + first, target + first, last - first, mode );
+    }
+
+    RoundingEnd( state );
+  }
+}
+
+void
+Precision::Convert( const float* source, double* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+    Widen( source + first, target + first, last - first );
+  }
+}
+
+void
+Precision::Convert( const Vec2d* source, Vec2f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 2, mode );
+}
+
+void
+Precision::Convert( const Vec2f* source, Vec2d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 2 );
+}
+
+void
+Precision::Convert( const Vec3d* source, Vec3f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 3, mode );
+}
+
+void
+Precision::Convert( const Vec3f* source, Vec3d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 3 );
+}
+
+void
+Precision::Convert( const Vec4d* source, Vec4f* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  for ( unsigned int i = 0; i < count; i++ )
+    target[ i ].Set( (float)source[ i ][ 0 ], (float)source[ i ][ 1 ],
+                     (float)source[ i ][ 2 ], (float)source[ i ][ 3 ] );
+}
+
+void
+Precision::Convert( const Vec4f* source, Vec4d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  for ( unsigned int i = 0; i < count; i++ )
+    target[ i ].Set( source[ i ][ 0 ], source[ i ][ 1 ], source[ i ][ 2 ], source[ i ][ 3 ] );
+}
+
+void
+Precision::Convert( const Quaterniond* source, Quaternion* target, const unsigned int count,
+                    const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 4, mode );
+}
+
+void
+Precision::Convert( const Quaternion* source, Quaterniond* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 4 );
+}
+
+void
+Precision::Convert( const Mat3d* source, Mat3f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 9, mode );
+}
+
+void
+Precision::Convert( const Mat3f* source, Mat3d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 9 );
+}
+
+void
+Precision::Convert( const Mat4d* source, Mat4f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 16, mode );
+}
+
+void
+Precision::Convert( const Mat4f* source, Mat4d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 16 );
+}
+
+void
+Precision::Convert( const Aabb3d* source, Aabb3f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 6, mode );
+}
+
+void
+Precision::Convert( const Aabb3f* source, Aabb3d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 6 );
+}
+
+void
+Precision::Convert( const Ray3d* source, Ray3f* target, const unsigned int count, const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  NarrowAll( source, target, count, 6, mode );
+}
+
+void
+Precision::Convert( const Ray3f* source, Ray3d* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  WidenAll( source, target, count, 6 );
+}
+
+unsigned short
+Precision::Half( const float value )
+{
+#if defined( __F16C__ )
+  return _cvtss_sh( value, _MM_FROUND_TO_NEAREST_INT );
+#else
+  return SoftwareHalf( value );
+#endif
+}
+
+float
+Precision::Single( const unsigned short half )
+{
+#if defined( __F16C__ )
+  return _cvtsh_ss( half );
+#else
+  return SoftwareSingle( half );
+#endif
+}
+
+void
+Precision::Convert( const float* source, unsigned short* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+    Halves( source + first, target + first, last - first );
+  }
+}
+
+void
+Precision::Convert( const unsigned short* source, float* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  const int blocks = ( count + PARALLEL_BLOCK - 1 ) / PARALLEL_BLOCK;
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int block = 0; block < blocks; block++ )
+  {
+    const unsigned int first = block * PARALLEL_BLOCK;
+    const unsigned int last  = first + PARALLEL_BLOCK < count ? first + PARALLEL_BLOCK : count;
+
+    Singles( source + first, target + first, last - first );
+  }
+}
+
+void
+Precision::Convert( const Vec2f* source, Vec2h* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  HalvesAll( source, target, count, 2 );
+}
+
+void
+Precision::Convert( const Vec2h* source, Vec2f* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  SinglesAll( source, target, count, 2 );
+}
+
+void
+Precision::Convert( const Vec3f* source, Vec3h* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  HalvesAll( source, target, count, 3 );
+}
+
+void
+Precision::Convert( const Vec3h* source, Vec3f* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  SinglesAll( source, target, count, 3 );
+}
+
+void
+Precision::Convert( const Vec4f* source, Vec4h* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  HalvesAll( source, target, count, 4 );
+}
+
+void
+Precision::Convert( const Vec4h* source, Vec4f* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  SinglesAll( source, target, count, 4 );
+}
+
+void
+Precision::Convert( const Quaternion* source, Quaternionh* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  HalvesAll( source, target, count, 4 );
+}
+
+void
+Precision::Convert( const Quaternionh* source, Quaternion* target, const unsigned int count )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  SinglesAll( source, target, count, 4 );
+}
+
+void
+Precision::Convert( const double* source, const unsigned int sourceStride, float* target,
+                    const unsigned int targetStride, const unsigned int count, const unsigned int size,
+                    const unsigned int mode )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  StridedAll( source, sourceStride, target, targetStride, count, size, mode );
+}
+
+void
+Precision::Convert( const float* source, const unsigned int sourceStride, double* target,
+                    const unsigned int targetStride, const unsigned int count, const unsigned int size )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  StridedAll( source, sourceStride, target, targetStride, count, size, PRECISION_NEAREST );
+}
+
+void
+Precision::Convert( const float* source, const unsigned int sourceStride, unsigned short* target,
+                    const unsigned int targetStride, const unsigned int count, const unsigned int size )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  StridedAll( source, sourceStride, target, targetStride, count, size, PRECISION_NEAREST );
+}
+
+void
+Precision::Convert( const unsigned short* source, const unsigned int sourceStride, float* target,
+                    const unsigned int targetStride, const unsigned int count, const unsigned int size )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_PRECISION_CONVERT, count );
+
+  StridedAll( source, sourceStride, target, targetStride, count, size, PRECISION_NEAREST );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,173 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Precision.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_PRECISION_HPP_
+#define MATH_PRECISION_HPP_
+
+class Vec2f;
+class Vec2d;
+class Vec3f;
+class Vec3d;
+class Vec4f;
+class Vec4d;
+class Quaternion;
+class Quaterniond;
+class Mat3f;
+class Mat3d;
+class Mat4f;
+class Mat4d;
+class Aabb3f;
+class Aabb3d;
+class Ray3f;
+class Ray3d;
+class Vec2h;
+class Vec3h;
+class Vec4h;
+class Quaternionh;
+
+enum PrecisionMode
+{
+  PRECISION_NEAREST     = 0,
+  PRECISION_TOWARD_ZERO = 1,
+  PRECISION_CLAMP       = 2
+};
+
+/*
+ * GeekEngine::Precision
+ *
+ * Bulk conversion between the double and float families. Narrowing uses
+ * cvtpd2ps, four values at a time with AVX and two with SSE2, widening
+ * uses cvtps2pd and is exact. The single value conversions are the
+ * explicit constructors of the types themselves.
+ *
+ * Narrowing rounds to nearest even regardless of the rounding mode the
+ * caller runs in, PRECISION_TOWARD_ZERO truncates instead. Values beyond
+ * the float range become infinity unless PRECISION_CLAMP is given, which
+ * saturates them to +-FLT_MAX, NaN stays NaN. The modes can be combined.
+ * Vec4d stores floats, its conversions are plain copies.
+ *
+ * Half floats convert with F16C when compiled for it and in software
+ * otherwise, both round to nearest even and give identical bits. Half and
+ * Single convert single values. All batch functions run in parallel when
+ * compiled with OpenMP.
+ *
+ * The strided overloads convert size components, at most four, of count
+ * elements that lie sourceStride and targetStride bytes apart, e.g. one
+ * attribute of an interleaved vertex buffer. The rest of each record is
+ * left alone.
+ */
+class Precision
+{
+public:
+  static void
+  Convert( const double* source, float* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const float* source, double* target, const unsigned int count );
+
+  static void
+  Convert( const Vec2d* source, Vec2f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Vec2f* source, Vec2d* target, const unsigned int count );
+  static void
+  Convert( const Vec3d* source, Vec3f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Vec3f* source, Vec3d* target, const unsigned int count );
+  static void
+  Convert( const Vec4d* source, Vec4f* target, const unsigned int count );
+  static void
+  Convert( const Vec4f* source, Vec4d* target, const unsigned int count );
+  static void
+  Convert( const Quaterniond* source, Quaternion* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Quaternion* source, Quaterniond* target, const unsigned int count );
+  static void
+  Convert( const Mat3d* source, Mat3f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Mat3f* source, Mat3d* target, const unsigned int count );
+  static void
+  Convert( const Mat4d* source, Mat4f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Mat4f* source, Mat4d* target, const unsigned int count );
+  static void
+  Convert( const Aabb3d* source, Aabb3f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Aabb3f* source, Aabb3d* target, const unsigned int count );
+  static void
+  Convert( const Ray3d* source, Ray3f* target, const unsigned int count,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const Ray3f* source, Ray3d* target, const unsigned int count );
+
+  static unsigned short
+  Half( const float value );
+  static float
+  Single( const unsigned short half );
+  static void
+  Convert( const float* source, unsigned short* target, const unsigned int count );
+  static void
+  Convert( const unsigned short* source, float* target, const unsigned int count );
+  static void
+  Convert( const Vec2f* source, Vec2h* target, const unsigned int count );
+  static void
+  Convert( const Vec2h* source, Vec2f* target, const unsigned int count );
+  static void
+  Convert( const Vec3f* source, Vec3h* target, const unsigned int count );
+  static void
+  Convert( const Vec3h* source, Vec3f* target, const unsigned int count );
+  static void
+  Convert( const Vec4f* source, Vec4h* target, const unsigned int count );
+  static void
+  Convert( const Vec4h* source, Vec4f* target, const unsigned int count );
+  static void
+  Convert( const Quaternion* source, Quaternionh* target, const unsigned int count );
+  static void
+  Convert( const Quaternionh* source, Quaternion* target, const unsigned int count );
+
+  static void
+  Convert( const double* source, const unsigned int sourceStride, float* target,
+           const unsigned int targetStride, const unsigned int count, const unsigned int size,
+           const unsigned int mode = PRECISION_NEAREST );
+  static void
+  Convert( const float* source, const unsigned int sourceStride, double* target,
+           const unsigned int targetStride, const unsigned int count, const unsigned int size );
+  static void
+  Convert( const float* source, const unsigned int sourceStride, unsigned short* target,
+           const unsigned int targetStride, const unsigned int count, const unsigned int size );
+  static void
+  Convert( const unsigned short* source, const unsigned int sourceStride, float* target,
+           const unsigned int targetStride, const unsigned int count, const unsigned int size );
+
+protected:
+private:
+  Precision( void );
+
+};
+
+#endif /* MATH_PRECISION_HPP_ */
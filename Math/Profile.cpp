@@ -0,0 +1,265 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Profile.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Profile.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined( GEEKMATH_PROFILE )
+
+#if defined( GEEKMATH_PROFILE_CYCLES )
+  #if defined( _MSC_VER )
+    #include <intrin.h>
+  #elif defined( __i386__ ) || defined( __x86_64__ )
+    #include <x86intrin.h>
+  #endif
+#endif
+
+#if defined( _MSC_VER )
+  #define PROFILE_THREAD __declspec( thread )
+#else
+  #define PROFILE_THREAD __thread
+#endif
+
+/* records of one thread, blocks stay in the list after their thread ended */
+struct ProfileBlock
+{
+  ProfileRecord records[ PROFILE_COUNTERS ];
+  ProfileBlock* next;
+};
+
+static ProfileBlock* volatile       g_Blocks = NULL;
+static PROFILE_THREAD ProfileBlock* t_Block  = NULL;
+
+static void
+Push( ProfileBlock* block )
+{
+#if defined( _MSC_VER )
+  do
+    block->next = g_Blocks;
+  while ( _InterlockedCompareExchangePointer( reinterpret_cast< void* volatile* >( &g_Blocks ), block,
+                                              block->next ) != block->next );
+#else
+  do
+    block->next = g_Blocks;
+  while ( !__sync_bool_compare_and_swap( &g_Blocks, block->next, block ) );
+#endif
+}
+
+#if defined( GEEKMATH_PROFILE_CYCLES )
+static inline GMUInt64
+Cycles( void )
+{
+#if defined( _MSC_VER ) || defined( __i386__ ) || defined( __x86_64__ )
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static inline unsigned int
+Bucket( GMUInt64 cycles )
+{
+  unsigned int bucket = 0;
+
+  for ( ; cycles > 1 && bucket < PROFILE_BUCKETS - 1; cycles >>= 1 )
+    bucket++;
+
+  return bucket;
+}
+#endif
+
+#endif
+
+/* C++98 printf has no 64 bit conversion, writes value into the end of text */
+static const char*
+Decimal( GMUInt64 value, char* text, const unsigned int size )
+{
+  char* digit = text + size - 1;
+
+  *digit = 0;
+
+  do
+  {
+    *--digit = static_cast< char >( '0' + value % 10 );
+    value   /= 10;
+  }
+  while ( value != 0 );
+
+  return digit;
+}
+
+static const char* NAMES[ PROFILE_COUNTERS ] =
+{
+  "Vec3f::Vec3f( const Vec3f& )",
+  "Quaternion::Quaternion( const Quaternion& )",
+  "Quaternion::SLerp",
+  "Quaterniond::SLerp",
+  "Mat4f::Mat4f( const Mat4f& )",
+  "Mat4f::operator *",
+  "Mat4f::Inverse",
+  "Mat4d::Mat4d( const Mat4d& )",
+  "Mat4d::operator *",
+  "Mat4d::Inverse",
+  "Mat4fSpan::Premultiply/Postmultiply",
+  "Affine3f::Multiply",
+  "Affine3d::Multiply",
+  "Interleaved::TransformPoints/Directions",
+  "Interleaved::Normalize",
+  "Precision::Convert",
+  "Upload::Write",
+  "Text::Parse"
+};
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Profile::Profile( void ) { return; }
+
+#if defined( GEEKMATH_PROFILE )
+ProfileScope::ProfileScope( const unsigned int counter, const unsigned int elements )
+  : m_Record( Profile::Records() + counter )
+{
+  m_Record->calls++;
+  m_Record->elements += elements;
+
+#if defined( GEEKMATH_PROFILE_CYCLES )
+  m_Start = Cycles();
+#endif
+}
+
+ProfileScope::~ProfileScope( void )
+{
+#if defined( GEEKMATH_PROFILE_CYCLES )
+  const GMUInt64 cycles = Cycles() - m_Start;
+
+  m_Record->cycles += cycles;
+  m_Record->histogram[ Bucket( cycles ) ]++;
+#endif
+}
+
+void
+ProfileScope::Count( const unsigned int elements )
+{
+  m_Record->elements += elements;
+}
+#endif
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+bool
+Profile::Enabled( void )
+{
+#if defined( GEEKMATH_PROFILE )
+  return true;
+#else
+  return false;
+#endif
+}
+
+const char*
+Profile::Name( const unsigned int counter )
+{
+  return counter < PROFILE_COUNTERS ? NAMES[ counter ] : "";
+}
+
+void
+Profile::Snapshot( ProfileRecord* records )
+{
+  memset( records, 0, PROFILE_COUNTERS * sizeof( ProfileRecord ) );
+
+#if defined( GEEKMATH_PROFILE )
+  for ( const ProfileBlock* block = g_Blocks; block != NULL; block = block->next )
+    for ( unsigned int counter = 0; counter < PROFILE_COUNTERS; counter++ )
+    {
+      const ProfileRecord& source = block->records[ counter ];
+      ProfileRecord&       target = records[ counter ];
+
+      target.calls    += source.calls;
+      target.elements += source.elements;
+      target.cycles   += source.cycles;
+
+      for ( unsigned int bucket = 0; bucket < PROFILE_BUCKETS; bucket++ )
+        target.histogram[ bucket ] += source.histogram[ bucket ];
+    }
+#endif
+}
+
+void
+Profile::Reset( void )
+{
+#if defined( GEEKMATH_PROFILE )
+  for ( ProfileBlock* block = g_Blocks; block != NULL; block = block->next )
+    memset( block->records, 0, sizeof( block->records ) );
+#endif
+}
+
+void
+Profile::Print( void )
+{
+  ProfileRecord records[ PROFILE_COUNTERS ];
+  char          calls[ 21 ], elements[ 21 ], cycles[ 21 ];
+
+  Snapshot( records );
+
+  for ( unsigned int counter = 0; counter < PROFILE_COUNTERS; counter++ )
+    if ( records[ counter ].calls > 0 )
+      printf( "%-42s %12s calls %14s elements %16s cycles\n", NAMES[ counter ],
+              Decimal( records[ counter ].calls, calls, sizeof( calls ) ),
+              Decimal( records[ counter ].elements, elements, sizeof( elements ) ),
+              Decimal( records[ counter ].cycles, cycles, sizeof( cycles ) ) );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+ProfileRecord*
+Profile::Records( void )
+{
+#if defined( GEEKMATH_PROFILE )
+  if ( t_Block == NULL )
+  {
+    t_Block = new ProfileBlock;
+    memset( t_Block, 0, sizeof( ProfileBlock ) );
+    Push( t_Block );
+  }
+
+  return t_Block->records;
+#else
+  return NULL;
+#endif
+}
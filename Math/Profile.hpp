@@ -0,0 +1,143 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Profile.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_PROFILE_HPP_
+#define MATH_PROFILE_HPP_
+
+#include "UInt64.hpp"
+
+enum ProfileCounter
+{
+  PROFILE_VEC3F_COPY            = 0,
+  PROFILE_QUATERNION_COPY       = 1,
+  PROFILE_QUATERNION_SLERP      = 2,
+  PROFILE_QUATERNIOND_SLERP     = 3,
+  PROFILE_MAT4F_COPY            = 4,
+  PROFILE_MAT4F_MULTIPLY        = 5,
+  PROFILE_MAT4F_INVERSE         = 6,
+  PROFILE_MAT4D_COPY            = 7,
+  PROFILE_MAT4D_MULTIPLY        = 8,
+  PROFILE_MAT4D_INVERSE         = 9,
+  PROFILE_MAT4FSPAN_MULTIPLY    = 10,
+  PROFILE_AFFINE3F_MULTIPLY     = 11,
+  PROFILE_AFFINE3D_MULTIPLY     = 12,
+  PROFILE_INTERLEAVED_TRANSFORM = 13,
+  PROFILE_INTERLEAVED_NORMALIZE = 14,
+  PROFILE_PRECISION_CONVERT     = 15,
+  PROFILE_UPLOAD_WRITE          = 16,
+  PROFILE_TEXT_PARSE            = 17,
+  PROFILE_COUNTERS              = 18
+};
+
+/* log2 buckets of the cycles per call, the last one takes everything above */
+#define PROFILE_BUCKETS 32
+
+struct ProfileRecord
+{
+  GMUInt64 calls;
+  GMUInt64 elements;
+  GMUInt64 cycles;
+  GMUInt64 histogram[ PROFILE_BUCKETS ];
+};
+
+/*
+ * GeekEngine::Profile
+ *
+ * Call statistics of the library compiled with GEEKMATH_PROFILE. The
+ * instrumented entry points count their calls and the elements they
+ * process, with GEEKMATH_PROFILE_CYCLES also the time stamp counter cycles
+ * per call into a histogram where bucket b holds the calls that took
+ * [ 2^b, 2^( b + 1 ) ) cycles. Each thread counts into its own records,
+ * so counting takes no locks and no atomics.
+ *
+ * Snapshot sums the records of all threads that ever counted into
+ * PROFILE_COUNTERS records indexed by ProfileCounter, Reset clears them.
+ * Both read other threads' counters without synchronization and are
+ * meant for quiet moments such as the end of a frame. Print writes the
+ * used counters with printf.
+ *
+ * Without GEEKMATH_PROFILE the entry points compile to exactly the same
+ * code as before, Snapshot returns zeros and Enabled false.
+ */
+class Profile
+{
+public:
+  static bool
+  Enabled( void );
+  static const char*
+  Name( const unsigned int counter );
+
+  static void
+  Snapshot( ProfileRecord* records );
+  static void
+  Reset( void );
+  static void
+  Print( void );
+
+protected:
+private:
+  friend class ProfileScope;
+
+  Profile( void );
+
+  static ProfileRecord*
+  Records( void );
+
+};
+
+#if defined( GEEKMATH_PROFILE )
+
+/*
+ * Counts one call of counter for the scope it lives in. Count adds
+ * elements known only at the end, e.g. how many values a parse read.
+ */
+class ProfileScope
+{
+public:
+  ProfileScope( const unsigned int counter, const unsigned int elements );
+  ~ProfileScope( void );
+
+  void
+  Count( const unsigned int elements );
+
+protected:
+private:
+  ProfileRecord* m_Record;
+#if defined( GEEKMATH_PROFILE_CYCLES )
+  GMUInt64       m_Start;
+#endif
+
+  ProfileScope( const ProfileScope& );
+  ProfileScope&
+  operator =( const ProfileScope& );
+
+};
+
+  #define GEEKMATH_PROFILE_SCOPE( counter, elements ) ProfileScope profileScope( counter, elements )
+  #define GEEKMATH_PROFILE_COUNT( elements ) profileScope.Count( elements )
+#else
+  #define GEEKMATH_PROFILE_SCOPE( counter, elements )
+  #define GEEKMATH_PROFILE_COUNT( elements )
+#endif
+
+#endif /* MATH_PROFILE_HPP_ */
@@ -22,6 +22,7 @@
  */
 
 #include "Quaternion.hpp"
+#include "Profile.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -30,6 +31,7 @@
 #include "Mat4f.hpp"
 #include "Vec2f.hpp"
 #include "Vec3f.hpp"
+#include "Quaterniond.hpp"
 
 Quaternion::Quaternion( const Mat4f& matrix )
 {
@@ -98,12 +100,22 @@ Quaternion::Quaternion( const Vec3f& vector )
 
 Quaternion::Quaternion( const Quaternion& vector )
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_QUATERNION_COPY, 1 );
+
   m_Values[ 0 ] = vector.m_Values[ 0 ];
   m_Values[ 1 ] = vector.m_Values[ 1 ];
   m_Values[ 2 ] = vector.m_Values[ 2 ];
   m_Values[ 3 ] = vector.m_Values[ 3 ];
 }
 
+Quaternion::Quaternion( const Quaterniond& vector )
+{
+  m_Values[ 0 ] = (float)vector[ 0 ];
+  m_Values[ 1 ] = (float)vector[ 1 ];
+  m_Values[ 2 ] = (float)vector[ 2 ];
+  m_Values[ 3 ] = (float)vector[ 3 ];
+}
+
 Quaternion::Quaternion( const Vec3f& Axis, const float Angle )
 {
   float sinHalfAngle = sinf( Angle / 2 );
@@ -280,6 +292,8 @@ Quaternion::NLerp( const Quaternion& Destination, const float LerpFactor, const
 Quaternion
 Quaternion::SLerp( const Quaternion& Destination, const float LerpFactor, const bool shortestPath ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_QUATERNION_SLERP, 1 );
+
   Quaternion correctedDest( Destination );
   float cos = Dot( Destination );
 
@@ -28,6 +28,7 @@ class Mat4f;
 class Vec2f;
 class Vec3f;
 class Vec4f;
+class Quaterniond;
 
 class Quaternion
 {
@@ -36,6 +37,8 @@ public:
   Quaternion( const Vec2f& vector );
   Quaternion( const Vec3f& vector );
   Quaternion( const Quaternion& vector );
+  explicit
+  Quaternion( const Quaterniond& vector );
   Quaternion( const Vec3f& Axis, const float Angle );
   Quaternion( const float x = 0.0f, const float y = 0.0f, const float z = 0.0f, const float w = 1.0f );
   virtual
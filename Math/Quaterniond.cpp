@@ -22,6 +22,7 @@
  */
 
 #include "Quaterniond.hpp"
+#include "Profile.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -30,6 +31,7 @@
 #include "Mat4d.hpp"
 #include "Vec2d.hpp"
 #include "Vec3d.hpp"
+#include "Quaternion.hpp"
 
 Quaterniond::Quaterniond( const Mat4d& matrix )
 {
@@ -104,6 +106,14 @@ Quaterniond::Quaterniond( const Quaterniond& vector )
   m_Values[ 3 ] = vector.m_Values[ 3 ];
 }
 
+Quaterniond::Quaterniond( const Quaternion& vector )
+{
+  m_Values[ 0 ] = vector[ 0 ];
+  m_Values[ 1 ] = vector[ 1 ];
+  m_Values[ 2 ] = vector[ 2 ];
+  m_Values[ 3 ] = vector[ 3 ];
+}
+
 Quaterniond::Quaterniond( const Vec3d& Axis, const double Angle )
 {
   double sinHalfAngle = sinf( Angle / 2 );
@@ -280,6 +290,8 @@ Quaterniond::NLerp( const Quaterniond& Destination, const double LerpFactor, con
 Quaterniond
 Quaterniond::SLerp( const Quaterniond& Destination, const double LerpFactor, const bool shortestPath ) const
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_QUATERNIOND_SLERP, 1 );
+
   Quaterniond correctedDest( Destination );
   double cos = Dot( Destination );
 
@@ -28,6 +28,7 @@ class Vec2d;
 class Vec3d;
 class Vec4d;
 class Mat4d;
+class Quaternion;
 
 class Quaterniond
 {
@@ -36,6 +37,8 @@ public:
   Quaterniond( const Vec2d& vector );
   Quaterniond( const Vec3d& vector );
   Quaterniond( const Quaterniond& vector );
+  explicit
+  Quaterniond( const Quaternion& vector );
   Quaterniond( const Vec3d& Axis, const double Angle );
   Quaterniond( const double x = 0.0f, const double y = 0.0f, const double z = 0.0f, const double w = 1.0f );
   virtual
@@ -0,0 +1,166 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Quaternionh.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Quaternionh.hpp"
+
+#include "Quaternion.hpp"
+#include "Precision.hpp"
+
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Quaternionh::Quaternionh( void )
+{
+  m_Values[ 0 ] = 0;
+  m_Values[ 1 ] = 0;
+  m_Values[ 2 ] = 0;
+  m_Values[ 3 ] = 0;
+}
+
+Quaternionh::Quaternionh( const Quaternionh& quaternion )
+{
+  m_Values[ 0 ] = quaternion.m_Values[ 0 ];
+  m_Values[ 1 ] = quaternion.m_Values[ 1 ];
+  m_Values[ 2 ] = quaternion.m_Values[ 2 ];
+  m_Values[ 3 ] = quaternion.m_Values[ 3 ];
+}
+
+Quaternionh::Quaternionh( const Quaternion& quaternion )
+{
+  Set( quaternion );
+}
+
+Quaternionh::Quaternionh( const float x, const float y, const float z, const float w )
+{
+  Set( x, y, z, w );
+}
+
+Quaternionh::~Quaternionh( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Quaternionh::Set( const float x, const float y, const float z, const float w )
+{
+  m_Values[ 0 ] = Precision::Half( x );
+  m_Values[ 1 ] = Precision::Half( y );
+  m_Values[ 2 ] = Precision::Half( z );
+  m_Values[ 3 ] = Precision::Half( w );
+}
+
+void
+Quaternionh::Set( const Quaternion& quaternion )
+{
+  m_Values[ 0 ] = Precision::Half( quaternion[ 0 ] );
+  m_Values[ 1 ] = Precision::Half( quaternion[ 1 ] );
+  m_Values[ 2 ] = Precision::Half( quaternion[ 2 ] );
+  m_Values[ 3 ] = Precision::Half( quaternion[ 3 ] );
+}
+
+Quaternion
+Quaternionh::Get( void ) const
+{
+  return Quaternion( X(), Y(), Z(), W() );
+}
+
+float
+Quaternionh::X( void ) const
+{
+  return Precision::Single( m_Values[ 0 ] );
+}
+
+float
+Quaternionh::Y( void ) const
+{
+  return Precision::Single( m_Values[ 1 ] );
+}
+
+float
+Quaternionh::Z( void ) const
+{
+  return Precision::Single( m_Values[ 2 ] );
+}
+
+float
+Quaternionh::W( void ) const
+{
+  return Precision::Single( m_Values[ 3 ] );
+}
+
+bool
+Quaternionh::operator ==( const Quaternionh& expr ) const
+{
+  return  m_Values[ 0 ] == expr.m_Values[ 0 ] &&
+          m_Values[ 1 ] == expr.m_Values[ 1 ] &&
+          m_Values[ 2 ] == expr.m_Values[ 2 ] &&
+          m_Values[ 3 ] == expr.m_Values[ 3 ];
+}
+
+bool
+Quaternionh::operator !=( const Quaternionh& expr ) const
+{
+  return !( *this == expr );
+}
+
+unsigned short&
+Quaternionh::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+unsigned short
+Quaternionh::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Quaternionh::Print( void ) const
+{
+  printf( "( %f | %f | %f | %f )\n", Precision::Single( m_Values[ 0 ] ), Precision::Single( m_Values[ 1 ] ), Precision::Single( m_Values[ 2 ] ), Precision::Single( m_Values[ 3 ] ) );
+}
+
+const unsigned short*
+Quaternionh::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
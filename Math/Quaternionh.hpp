@@ -0,0 +1,87 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Quaternionh.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_QUATERNIONH_HPP_
+#define MATH_QUATERNIONH_HPP_
+
+class Quaternion;
+
+/*
+ * GeekEngine::Quaternionh
+ *
+ * A quaternion stored as 4 IEEE 754 half floats, 8 bytes without padding,
+ * for vertex and instance streams that do not need float precision. There
+ * is no virtual destructor so that arrays stay packed and can be handed to
+ * the GPU as they are. Components are rounded to nearest even when set,
+ * values beyond 65504 become infinity. Precision::Convert converts whole
+ * arrays from and to Quaternion.
+ */
+class Quaternionh
+{
+public:
+  Quaternionh( void );
+  Quaternionh( const Quaternionh& quaternion );
+  explicit
+  Quaternionh( const Quaternion& quaternion );
+  Quaternionh( const float x, const float y, const float z, const float w );
+  ~Quaternionh( void );
+
+  void
+  Set( const float x, const float y, const float z, const float w );
+  void
+  Set( const Quaternion& quaternion );
+  Quaternion
+  Get( void ) const;
+
+  float
+  X( void ) const;
+  float
+  Y( void ) const;
+  float
+  Z( void ) const;
+  float
+  W( void ) const;
+
+  bool
+  operator ==( const Quaternionh& expr ) const;
+  bool
+  operator !=( const Quaternionh& expr ) const;
+
+  unsigned short&
+  operator []( unsigned int i );
+  unsigned short
+  operator []( unsigned int i ) const;
+
+  void
+  Print( void ) const;
+
+  const unsigned short*
+  Values( void ) const;
+
+protected:
+private:
+  unsigned short m_Values[ 4 ];
+
+};
+
+#endif /* MATH_QUATERNIONH_HPP_ */
@@ -0,0 +1,85 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Ray3d.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_RAY3D_HPP_
+#define MATH_RAY3D_HPP_
+
+class Vec3d;
+class Aabb3d;
+
+/*
+ * GeekEngine::Ray3d
+ *
+ * Half line starting at origin. The direction is stored as given, At( t )
+ * and the distances returned by Intersects are in multiples of its length.
+ */
+class Ray3f;
+
+class Ray3d
+{
+public:
+  Ray3d( void );
+  Ray3d( const Ray3d& );
+  explicit
+  Ray3d( const Ray3f& other );
+  Ray3d( const Vec3d& origin, const Vec3d& direction );
+  virtual
+  ~Ray3d( void );
+
+  void
+  Set( const Vec3d& origin, const Vec3d& direction );
+  void
+  Origin( const Vec3d& origin );
+  void
+  Direction( const Vec3d& direction );
+
+  Vec3d
+  Origin( void ) const;
+  Vec3d
+  Direction( void ) const;
+  Vec3d
+  At( const double t ) const;
+
+  bool
+  Intersects( const Aabb3d& box, double& tNear, double& tFar ) const;
+
+  bool
+  operator ==( const Ray3d& expr ) const;
+  bool
+  operator !=( const Ray3d& expr ) const;
+
+  double*
+  operator []( const unsigned int );
+  const double*
+  operator []( const unsigned int ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  double m_Values[ 2 ][ 3 ];
+
+};
+
+#endif /* MATH_RAY3D_HPP_ */
@@ -0,0 +1,192 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Ray3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Ray3f.hpp"
+
+#include "Vec3f.hpp"
+#include "Aabb3f.hpp"
+#include "Ray3d.hpp"
+
+#include <cfloat>
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Ray3f::Ray3f( void )
+{
+  m_Values[ 0 ][ 0 ] = m_Values[ 0 ][ 1 ] = m_Values[ 0 ][ 2 ] = 0.0f;
+  m_Values[ 1 ][ 0 ] = m_Values[ 1 ][ 1 ] = 0.0f;
+  m_Values[ 1 ][ 2 ] = -1.0f;
+}
+
+Ray3f::Ray3f( const Ray3f& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = other.m_Values[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = other.m_Values[ 1 ][ i ];
+  }
+}
+
+Ray3f::Ray3f( const Ray3d& other )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    m_Values[ 0 ][ i ] = (float)other[ 0 ][ i ];
+    m_Values[ 1 ][ i ] = (float)other[ 1 ][ i ];
+  }
+}
+
+Ray3f::Ray3f( const Vec3f& origin, const Vec3f& direction )
+{
+  Set( origin, direction );
+}
+
+Ray3f::~Ray3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Ray3f::Set( const Vec3f& origin, const Vec3f& direction )
+{
+  Origin( origin );
+  Direction( direction );
+}
+
+void
+Ray3f::Origin( const Vec3f& origin )
+{
+  m_Values[ 0 ][ 0 ] = origin.X();
+  m_Values[ 0 ][ 1 ] = origin.Y();
+  m_Values[ 0 ][ 2 ] = origin.Z();
+}
+
+void
+Ray3f::Direction( const Vec3f& direction )
+{
+  m_Values[ 1 ][ 0 ] = direction.X();
+  m_Values[ 1 ][ 1 ] = direction.Y();
+  m_Values[ 1 ][ 2 ] = direction.Z();
+}
+
+Vec3f
+Ray3f::Origin( void ) const
+{
+  return Vec3f( m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ] );
+}
+
+Vec3f
+Ray3f::Direction( void ) const
+{
+  return Vec3f( m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+Vec3f
+Ray3f::At( const float t ) const
+{
+  return Vec3f( m_Values[ 0 ][ 0 ] + m_Values[ 1 ][ 0 ] * t,
+                m_Values[ 0 ][ 1 ] + m_Values[ 1 ][ 1 ] * t,
+                m_Values[ 0 ][ 2 ] + m_Values[ 1 ][ 2 ] * t );
+}
+
+bool
+Ray3f::Intersects( const Aabb3f& box, float& tNear, float& tFar ) const
+{
+  float enter = 0.0f;
+  float leave = FLT_MAX;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    /* slab test, a zero direction gives +-inf and keeps the slab open */
+    const float inv = 1.0f / m_Values[ 1 ][ i ];
+    float       t0  = ( box[ 0 ][ i ] - m_Values[ 0 ][ i ] ) * inv;
+    float       t1  = ( box[ 1 ][ i ] - m_Values[ 0 ][ i ] ) * inv;
+
+    if ( t0 > t1 ) { const float swap = t0; t0 = t1; t1 = swap; }
+
+    enter = t0 > enter ? t0 : enter;
+    leave = t1 < leave ? t1 : leave;
+  }
+
+  if ( enter > leave ) return false;
+
+  tNear = enter;
+  tFar  = leave;
+
+  return true;
+}
+
+bool
+Ray3f::operator ==( const Ray3f& expr ) const
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    if ( m_Values[ 0 ][ i ] != expr.m_Values[ 0 ][ i ] ||
+         m_Values[ 1 ][ i ] != expr.m_Values[ 1 ][ i ] )
+      return false;
+
+  return true;
+}
+
+bool
+Ray3f::operator !=( const Ray3f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float*
+Ray3f::operator []( const unsigned int index )
+{
+  return m_Values[ index ];
+}
+
+const float*
+Ray3f::operator []( const unsigned int index ) const
+{
+  return m_Values[ index ];
+}
+
+void
+Ray3f::Print( void ) const
+{
+  printf( "( %f | %f | %f ) -> ( %f | %f | %f )\n",
+          m_Values[ 0 ][ 0 ], m_Values[ 0 ][ 1 ], m_Values[ 0 ][ 2 ],
+          m_Values[ 1 ][ 0 ], m_Values[ 1 ][ 1 ], m_Values[ 1 ][ 2 ] );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
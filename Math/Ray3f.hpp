@@ -0,0 +1,85 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Ray3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_RAY3F_HPP_
+#define MATH_RAY3F_HPP_
+
+class Vec3f;
+class Aabb3f;
+
+/*
+ * GeekEngine::Ray3f
+ *
+ * Half line starting at origin. The direction is stored as given, At( t )
+ * and the distances returned by Intersects are in multiples of its length.
+ */
+class Ray3d;
+
+class Ray3f
+{
+public:
+  Ray3f( void );
+  Ray3f( const Ray3f& );
+  explicit
+  Ray3f( const Ray3d& other );
+  Ray3f( const Vec3f& origin, const Vec3f& direction );
+  virtual
+  ~Ray3f( void );
+
+  void
+  Set( const Vec3f& origin, const Vec3f& direction );
+  void
+  Origin( const Vec3f& origin );
+  void
+  Direction( const Vec3f& direction );
+
+  Vec3f
+  Origin( void ) const;
+  Vec3f
+  Direction( void ) const;
+  Vec3f
+  At( const float t ) const;
+
+  bool
+  Intersects( const Aabb3f& box, float& tNear, float& tFar ) const;
+
+  bool
+  operator ==( const Ray3f& expr ) const;
+  bool
+  operator !=( const Ray3f& expr ) const;
+
+  float*
+  operator []( const unsigned int );
+  const float*
+  operator []( const unsigned int ) const;
+
+  void
+  Print( void ) const;
+
+protected:
+private:
+  float m_Values[ 2 ][ 3 ];
+
+};
+
+#endif /* MATH_RAY3F_HPP_ */
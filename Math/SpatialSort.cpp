@@ -0,0 +1,486 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file SpatialSort.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "SpatialSort.hpp"
+
+#include "Vec2i.hpp"
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Aabb2f.hpp"
+#include "Aabb3f.hpp"
+
+#include <cstring>
+#include <vector>
+
+#if defined( __BMI2__ )
+  #include <immintrin.h>
+#endif
+
+#define PARALLEL_CHUNKS 64
+#define PARALLEL_MINIMUM 4096
+#define RADIX_BITS 8
+#define RADIX_BUCKETS ( 1 << RADIX_BITS )
+
+/* spreads the low 16 bits of value to every second bit */
+static inline unsigned int
+Spread2( unsigned int value )
+{
+#if defined( __BMI2__ )
+  return _pdep_u32( value, 0x55555555u );
+#else
+  value &= 0x0000ffffu;
+  value = ( value | ( value << 8 ) ) & 0x00ff00ffu;
+  value = ( value | ( value << 4 ) ) & 0x0f0f0f0fu;
+  value = ( value | ( value << 2 ) ) & 0x33333333u;
+  value = ( value | ( value << 1 ) ) & 0x55555555u;
+
+  return value;
+#endif
+}
+
+/* spreads the low 10 bits of value to every third bit */
+static inline unsigned int
+Spread3( unsigned int value )
+{
+#if defined( __BMI2__ )
+  return _pdep_u32( value, 0x09249249u );
+#else
+  value &= 0x000003ffu;
+  value = ( value | ( value << 16 ) ) & 0x030000ffu;
+  value = ( value | ( value << 8 ) )  & 0x0300f00fu;
+  value = ( value | ( value << 4 ) )  & 0x030c30c3u;
+  value = ( value | ( value << 2 ) )  & 0x09249249u;
+
+  return value;
+#endif
+}
+
+/* spreads the low 21 bits of value to every third bit of a 64 bit word */
+static inline GMUInt64
+Spread3Wide( const unsigned int bits )
+{
+#if defined( __BMI2__ ) && defined( __x86_64__ )
+  return _pdep_u64( bits, GEEKMATH_UINT64( 0x12492492, 0x49249249 ) );
+#else
+  GMUInt64 value = bits & 0x1fffffu;
+
+  value = ( value | ( value << 32 ) ) & GEEKMATH_UINT64( 0x001f0000, 0x0000ffff );
+  value = ( value | ( value << 16 ) ) & GEEKMATH_UINT64( 0x001f0000, 0xff0000ff );
+  value = ( value | ( value << 8 ) )  & GEEKMATH_UINT64( 0x100f00f0, 0x0f00f00f );
+  value = ( value | ( value << 4 ) )  & GEEKMATH_UINT64( 0x10c30c30, 0xc30c30c3 );
+  value = ( value | ( value << 2 ) )  & GEEKMATH_UINT64( 0x12492492, 0x49249249 );
+
+  return value;
+#endif
+}
+
+/*
+ * Skilling's transform ( "Programming the Hilbert curve", 2004 ) turns the
+ * low bits of the three coordinates into the transposed Hilbert index,
+ * interleaving its bits with the first axis most significant gives the
+ * code.
+ */
+static void
+Transpose( unsigned int* axes, const unsigned int bits )
+{
+  const unsigned int top = 1u << ( bits - 1 );
+  unsigned int       t;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+    axes[ i ] &= ( top << 1 ) - 1;
+
+  for ( unsigned int q = top; q > 1; q >>= 1 )
+  {
+    const unsigned int p = q - 1;
+
+    for ( unsigned int i = 0; i < 3; i++ )
+    {
+      if ( axes[ i ] & q )
+        axes[ 0 ] ^= p;
+      else
+      {
+        t          = ( axes[ 0 ] ^ axes[ i ] ) & p;
+        axes[ 0 ] ^= t;
+        axes[ i ] ^= t;
+      }
+    }
+  }
+
+  axes[ 1 ] ^= axes[ 0 ];
+  axes[ 2 ] ^= axes[ 1 ];
+
+  t = 0;
+
+  for ( unsigned int q = top; q > 1; q >>= 1 )
+    if ( axes[ 2 ] & q ) t ^= q - 1;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+    axes[ i ] ^= t;
+}
+
+/*
+ * Every pass counts the digits per chunk, turns the counts into per chunk
+ * offsets ( digit major, so equal digits keep their chunk order ) and
+ * scatters each chunk in order, which keeps the sort stable. Passes in
+ * which all keys share the digit are skipped.
+ */
+template< typename Code >
+static void
+RadixSort( Code* codes, unsigned int* order, const unsigned int count )
+{
+  if ( count == 0 ) return;
+
+  std::vector< Code >         codeBuffer( count );
+  std::vector< unsigned int > orderBuffer( count );
+  std::vector< unsigned int > offsets( PARALLEL_CHUNKS * RADIX_BUCKETS );
+  Code*                       sourceCodes  = codes;
+  unsigned int*               sourceOrder  = order;
+  Code*                       targetCodes  = &codeBuffer[ 0 ];
+  unsigned int*               targetOrder  = &orderBuffer[ 0 ];
+  const unsigned int          chunk        = ( count + PARALLEL_CHUNKS - 1 ) / PARALLEL_CHUNKS;
+  const int                   chunks       = ( count + chunk - 1 ) / chunk;
+
+  for ( unsigned int i = 0; i < count; i++ )
+    order[ i ] = i;
+
+  for ( unsigned int shift = 0; shift < sizeof( Code ) * 8; shift += RADIX_BITS )
+  {
+    unsigned int* histogram = &offsets[ 0 ];
+
+#if defined( _OPENMP )
+    #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+    for ( int c = 0; c < chunks; c++ )
+    {
+      unsigned int*      counts = histogram + c * RADIX_BUCKETS;
+      const unsigned int first  = c * chunk;
+      const unsigned int last   = first + chunk < count ? first + chunk : count;
+
+      memset( counts, 0, RADIX_BUCKETS * sizeof( unsigned int ) );
+
+      for ( unsigned int i = first; i < last; i++ )
+        counts[ ( sourceCodes[ i ] >> shift ) & ( RADIX_BUCKETS - 1 ) ]++;
+    }
+
+    bool         skip  = false;
+    unsigned int start = 0;
+
+    for ( unsigned int digit = 0; digit < RADIX_BUCKETS; digit++ )
+    {
+      unsigned int total = 0;
+
+      for ( int c = 0; c < chunks; c++ )
+      {
+        const unsigned int n = histogram[ c * RADIX_BUCKETS + digit ];
+
+        histogram[ c * RADIX_BUCKETS + digit ] = start + total;
+        total += n;
+      }
+
+      if ( total == count ) skip = true;
+
+      start += total;
+    }
+
+    if ( skip ) continue;
+
+#if defined( _OPENMP )
+    #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+    for ( int c = 0; c < chunks; c++ )
+    {
+      unsigned int*      next  = histogram + c * RADIX_BUCKETS;
+      const unsigned int first = c * chunk;
+      const unsigned int last  = first + chunk < count ? first + chunk : count;
+
+      for ( unsigned int i = first; i < last; i++ )
+      {
+        const unsigned int target = next[ ( sourceCodes[ i ] >> shift ) & ( RADIX_BUCKETS - 1 ) ]++;
+
+        targetCodes[ target ] = sourceCodes[ i ];
+        targetOrder[ target ] = sourceOrder[ i ];
+      }
+    }
+
+    Code*         swapCodes = sourceCodes; sourceCodes = targetCodes; targetCodes = swapCodes;
+    unsigned int* swapOrder = sourceOrder; sourceOrder = targetOrder; targetOrder = swapOrder;
+  }
+
+  if ( sourceCodes != codes )
+  {
+    memcpy( codes, sourceCodes, count * sizeof( Code ) );
+    memcpy( order, sourceOrder, count * sizeof( unsigned int ) );
+  }
+}
+
+/* maps value into [ 0, cells - 1 ] relative to min with scale = cells / extent */
+static inline unsigned int
+Quantize( const float value, const float min, const float scale, const unsigned int cells )
+{
+  const float cell = ( value - min ) * scale;
+
+  if ( !( cell > 0.0f ) ) return 0;
+
+  return cell >= (float)( cells - 1 ) ? cells - 1 : (unsigned int)cell;
+}
+
+static inline float
+Scale( const float extent, const unsigned int cells )
+{
+  return extent > 0.0f ? cells / extent : 0.0f;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+SpatialSort::SpatialSort( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+SpatialSort::Morton( const unsigned int x, const unsigned int y )
+{
+  return Spread2( x ) | ( Spread2( y ) << 1 );
+}
+
+unsigned int
+SpatialSort::Morton( const unsigned int x, const unsigned int y, const unsigned int z )
+{
+  return Spread3( x ) | ( Spread3( y ) << 1 ) | ( Spread3( z ) << 2 );
+}
+
+unsigned int
+SpatialSort::Morton( const Vec2i& cell )
+{
+  return Morton( cell.X(), cell.Y() );
+}
+
+/*
+ * Quadrant by quadrant from the top bit, rotating and mirroring the
+ * remaining bits into the orientation of the curve inside the quadrant.
+ */
+unsigned int
+SpatialSort::Hilbert( const unsigned int x, const unsigned int y )
+{
+  unsigned int rx, ry, code = 0;
+  unsigned int px = x & 0xffffu;
+  unsigned int py = y & 0xffffu;
+
+  for ( unsigned int s = 1u << 15; s > 0; s >>= 1 )
+  {
+    rx = ( px & s ) ? 1 : 0;
+    ry = ( py & s ) ? 1 : 0;
+
+    code += s * s * ( ( 3 * rx ) ^ ry );
+
+    if ( ry == 0 )
+    {
+      if ( rx == 1 )
+      {
+        px = 0xffffu - px;
+        py = 0xffffu - py;
+      }
+
+      const unsigned int swap = px;
+
+      px = py;
+      py = swap;
+    }
+  }
+
+  return code;
+}
+
+unsigned int
+SpatialSort::Hilbert( const unsigned int x, const unsigned int y, const unsigned int z )
+{
+  unsigned int axes[ 3 ] = { x, y, z };
+
+  Transpose( axes, 10 );
+
+  return Morton( axes[ 2 ], axes[ 1 ], axes[ 0 ] );
+}
+
+unsigned int
+SpatialSort::Hilbert( const Vec2i& cell )
+{
+  return Hilbert( cell.X(), cell.Y() );
+}
+
+GMUInt64
+SpatialSort::Morton64( const unsigned int x, const unsigned int y, const unsigned int z )
+{
+  return Spread3Wide( x ) | ( Spread3Wide( y ) << 1 ) | ( Spread3Wide( z ) << 2 );
+}
+
+GMUInt64
+SpatialSort::Hilbert64( const unsigned int x, const unsigned int y, const unsigned int z )
+{
+  unsigned int axes[ 3 ] = { x, y, z };
+
+  Transpose( axes, 21 );
+
+  return Morton64( axes[ 2 ], axes[ 1 ], axes[ 0 ] );
+}
+
+void
+SpatialSort::Morton( const Vec2f* points, const unsigned int count, const Aabb2f& bounds, unsigned int* codes )
+{
+  const float min[ 2 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ] };
+  const float scale[ 2 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 16 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 16 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Morton( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 16 ),
+                         Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 16 ) );
+}
+
+void
+SpatialSort::Morton( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, unsigned int* codes )
+{
+  const float min[ 3 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ], bounds[ 0 ][ 2 ] };
+  const float scale[ 3 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 10 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 10 ),
+                             Scale( bounds[ 1 ][ 2 ] - min[ 2 ], 1u << 10 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Morton( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 10 ),
+                         Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 10 ),
+                         Quantize( points[ i ].Z(), min[ 2 ], scale[ 2 ], 1u << 10 ) );
+}
+
+void
+SpatialSort::Hilbert( const Vec2f* points, const unsigned int count, const Aabb2f& bounds, unsigned int* codes )
+{
+  const float min[ 2 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ] };
+  const float scale[ 2 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 16 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 16 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Hilbert( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 16 ),
+                          Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 16 ) );
+}
+
+void
+SpatialSort::Hilbert( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, unsigned int* codes )
+{
+  const float min[ 3 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ], bounds[ 0 ][ 2 ] };
+  const float scale[ 3 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 10 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 10 ),
+                             Scale( bounds[ 1 ][ 2 ] - min[ 2 ], 1u << 10 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Hilbert( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 10 ),
+                          Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 10 ),
+                          Quantize( points[ i ].Z(), min[ 2 ], scale[ 2 ], 1u << 10 ) );
+}
+
+void
+SpatialSort::Morton( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, GMUInt64* codes )
+{
+  const float min[ 3 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ], bounds[ 0 ][ 2 ] };
+  const float scale[ 3 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 21 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 21 ),
+                             Scale( bounds[ 1 ][ 2 ] - min[ 2 ], 1u << 21 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Morton64( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 21 ),
+                           Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 21 ),
+                           Quantize( points[ i ].Z(), min[ 2 ], scale[ 2 ], 1u << 21 ) );
+}
+
+void
+SpatialSort::Hilbert( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, GMUInt64* codes )
+{
+  const float min[ 3 ]   = { bounds[ 0 ][ 0 ], bounds[ 0 ][ 1 ], bounds[ 0 ][ 2 ] };
+  const float scale[ 3 ] = { Scale( bounds[ 1 ][ 0 ] - min[ 0 ], 1u << 21 ),
+                             Scale( bounds[ 1 ][ 1 ] - min[ 1 ], 1u << 21 ),
+                             Scale( bounds[ 1 ][ 2 ] - min[ 2 ], 1u << 21 ) };
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    codes[ i ] = Hilbert64( Quantize( points[ i ].X(), min[ 0 ], scale[ 0 ], 1u << 21 ),
+                            Quantize( points[ i ].Y(), min[ 1 ], scale[ 1 ], 1u << 21 ),
+                            Quantize( points[ i ].Z(), min[ 2 ], scale[ 2 ], 1u << 21 ) );
+}
+
+void
+SpatialSort::Sort( unsigned int* codes, unsigned int* order, const unsigned int count )
+{
+  RadixSort( codes, order, count );
+}
+
+/* 63 bit codes take up to eight passes, all zero top digits are skipped */
+void
+SpatialSort::Sort( GMUInt64* codes, unsigned int* order, const unsigned int count )
+{
+  RadixSort( codes, order, count );
+}
+
+void
+SpatialSort::Reorder( const void* source, void* target, const unsigned int size,
+                      const unsigned int* order, const unsigned int count )
+{
+  const char* from = static_cast< const char* >( source );
+  char*       to   = static_cast< char* >( target );
+
+#if defined( _OPENMP )
+  #pragma omp parallel for if ( count > PARALLEL_MINIMUM )
+#endif
+  for ( int i = 0; i < (int)count; i++ )
+    memcpy( to + (unsigned long)i * size, from + (unsigned long)order[ i ] * size, size );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
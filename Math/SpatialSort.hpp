@@ -0,0 +1,102 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file SpatialSort.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_SPATIALSORT_HPP_
+#define MATH_SPATIALSORT_HPP_
+
+#include "UInt64.hpp"
+
+class Vec2i;
+class Vec2f;
+class Vec3f;
+class Aabb2f;
+class Aabb3f;
+
+/*
+ * GeekEngine::SpatialSort
+ *
+ * Space filling curve codes and a radix sort to bring arrays into spatially
+ * coherent order. Codes are 32 bit: 2D codes interleave 16 bits per axis,
+ * 3D codes 10 bits per axis. Morton64 and Hilbert64, and the batch
+ * encoders writing GMUInt64 codes, give 63 bit 3D codes with 21 bits per
+ * axis for point clouds that need more than 1024 cells per axis; GMUInt64
+ * is the guarded 64 bit typedef of UInt64.hpp.
+ * Morton codes use BMI2 pdep when compiled for it. Hilbert codes keep
+ * consecutive codes in neighbouring cells and give better locality at a
+ * higher encoding cost.
+ *
+ * The batch encoders quantize positions against bounds onto the full grid,
+ * positions outside are clamped. Sort orders codes ascending with a stable
+ * LSD radix sort and writes the original index of every sorted element to
+ * order; Reorder then gathers any payload array of size byte elements with
+ * target[ i ] = source[ order[ i ] ]. All batch functions run in parallel
+ * when compiled with OpenMP.
+ */
+class SpatialSort
+{
+public:
+  static unsigned int
+  Morton( const unsigned int x, const unsigned int y );
+  static unsigned int
+  Morton( const unsigned int x, const unsigned int y, const unsigned int z );
+  static unsigned int
+  Morton( const Vec2i& cell );
+  static unsigned int
+  Hilbert( const unsigned int x, const unsigned int y );
+  static unsigned int
+  Hilbert( const unsigned int x, const unsigned int y, const unsigned int z );
+  static unsigned int
+  Hilbert( const Vec2i& cell );
+  static GMUInt64
+  Morton64( const unsigned int x, const unsigned int y, const unsigned int z );
+  static GMUInt64
+  Hilbert64( const unsigned int x, const unsigned int y, const unsigned int z );
+
+  static void
+  Morton( const Vec2f* points, const unsigned int count, const Aabb2f& bounds, unsigned int* codes );
+  static void
+  Morton( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, unsigned int* codes );
+  static void
+  Hilbert( const Vec2f* points, const unsigned int count, const Aabb2f& bounds, unsigned int* codes );
+  static void
+  Hilbert( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, unsigned int* codes );
+  static void
+  Morton( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, GMUInt64* codes );
+  static void
+  Hilbert( const Vec3f* points, const unsigned int count, const Aabb3f& bounds, GMUInt64* codes );
+
+  static void
+  Sort( unsigned int* codes, unsigned int* order, const unsigned int count );
+  static void
+  Sort( GMUInt64* codes, unsigned int* order, const unsigned int count );
+  static void
+  Reorder( const void* source, void* target, const unsigned int size,
+           const unsigned int* order, const unsigned int count );
+
+protected:
+private:
+  SpatialSort( void );
+
+};
+
+#endif /* MATH_SPATIALSORT_HPP_ */
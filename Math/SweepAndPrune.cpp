@@ -0,0 +1,428 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file SweepAndPrune.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "SweepAndPrune.hpp"
+
+#include "Aabb3f.hpp"
+
+#include <algorithm>
+
+/* more insertions than objects / SWEEP_RESORT since the last sort resort from scratch */
+#define SWEEP_RESORT 16
+
+/* minima sort before maxima of the same value so touching boxes overlap */
+static bool
+EndpointLess( const SweepEndpoint& a, const SweepEndpoint& b )
+{
+  return a.value < b.value || ( a.value == b.value && ( a.data & 1 ) < ( b.data & 1 ) );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+SweepAndPrune::SweepAndPrune( const unsigned int axes ) :
+  m_Axes( 0 ),
+  m_SweepAxis( 0 ),
+  m_Objects( 0 ),
+  m_Inserted( 0 )
+{
+  Axes( axes );
+}
+
+SweepAndPrune::SweepAndPrune( const SweepAndPrune& other ) :
+  m_Axes( other.m_Axes ),
+  m_SweepAxis( other.m_SweepAxis ),
+  m_Objects( other.m_Objects ),
+  m_Inserted( other.m_Inserted ),
+  m_Boxes( other.m_Boxes ),
+  m_Alive( other.m_Alive ),
+  m_Free( other.m_Free ),
+  m_Active( other.m_Active ),
+  m_ActiveSlot( other.m_ActiveSlot ),
+  m_ActiveBounds( other.m_ActiveBounds ),
+  m_Pairs( other.m_Pairs )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Endpoints[ i ] = other.m_Endpoints[ i ];
+}
+
+SweepAndPrune::~SweepAndPrune( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+SweepAndPrune::Add( const Aabb3f& box )
+{
+  unsigned int id;
+
+  if ( m_Free.empty() )
+  {
+    id = m_Alive.size();
+
+    m_Boxes.resize( m_Boxes.size() + 6 );
+    m_Alive.push_back( 0 );
+    m_ActiveSlot.push_back( 0 );
+  }
+  else
+  {
+    id = m_Free.back();
+    m_Free.pop_back();
+  }
+
+  m_Alive[ id ] = 1;
+  Update( id, box );
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    if ( !( m_Axes & ( 1 << axis ) ) ) continue;
+
+    SweepEndpoint endpoint;
+
+    endpoint.value = box[ 0 ][ axis ];
+    endpoint.data  = id << 1;
+    m_Endpoints[ axis ].push_back( endpoint );
+
+    endpoint.value = box[ 1 ][ axis ];
+    endpoint.data  = ( id << 1 ) | 1;
+    m_Endpoints[ axis ].push_back( endpoint );
+  }
+
+  m_Objects++;
+  m_Inserted++;
+
+  return id;
+}
+
+void
+SweepAndPrune::Remove( const unsigned int id )
+{
+  if ( id >= m_Alive.size() || !m_Alive[ id ] ) return;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    std::vector< SweepEndpoint >& endpoints = m_Endpoints[ axis ];
+    unsigned int                  kept      = 0;
+
+    for ( unsigned int i = 0; i < endpoints.size(); i++ )
+      if ( ( endpoints[ i ].data >> 1 ) != id )
+        endpoints[ kept++ ] = endpoints[ i ];
+
+    endpoints.resize( kept );
+  }
+
+  m_Alive[ id ] = 0;
+  m_Free.push_back( id );
+  m_Objects--;
+}
+
+void
+SweepAndPrune::Update( const unsigned int id, const Aabb3f& box )
+{
+  float* values = &m_Boxes[ id * 6 ];
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    values[ i ]     = box[ 0 ][ i ];
+    values[ 3 + i ] = box[ 1 ][ i ];
+  }
+}
+
+void
+SweepAndPrune::Update( const Aabb3f* boxes, const unsigned int count )
+{
+  for ( unsigned int i = 0; i < count; i++ )
+    Update( i, boxes[ i ] );
+}
+
+void
+SweepAndPrune::Clear( void )
+{
+  for ( unsigned int i = 0; i < 3; i++ )
+    m_Endpoints[ i ].clear();
+
+  m_Boxes.clear();
+  m_Alive.clear();
+  m_Free.clear();
+  m_Active.clear();
+  m_ActiveSlot.clear();
+  m_ActiveBounds.clear();
+  m_Pairs.clear();
+
+  m_Objects  = 0;
+  m_Inserted = 0;
+}
+
+void
+SweepAndPrune::Axes( const unsigned int axes )
+{
+  unsigned int enabled = axes & SWEEP_ALL;
+
+  if ( !enabled ) enabled = SWEEP_X;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    const unsigned int bit = 1 << axis;
+
+    if ( ( enabled & bit ) && !( m_Axes & bit ) )
+      Rebuild( axis );
+    else if ( !( enabled & bit ) )
+      m_Endpoints[ axis ].clear();
+  }
+
+  m_Axes = enabled;
+
+  if ( !( m_Axes & ( 1 << m_SweepAxis ) ) )
+    m_SweepAxis = m_Axes & SWEEP_X ? 0 : m_Axes & SWEEP_Y ? 1 : 2;
+}
+
+unsigned int
+SweepAndPrune::Axes( void ) const
+{
+  return m_Axes;
+}
+
+unsigned int
+SweepAndPrune::SweepAxis( void ) const
+{
+  return m_SweepAxis;
+}
+
+unsigned int
+SweepAndPrune::Objects( void ) const
+{
+  return m_Objects;
+}
+
+unsigned int
+SweepAndPrune::FindPairs( void )
+{
+  double sum[ 3 ]   = { 0.0, 0.0, 0.0 };
+  double sumSq[ 3 ] = { 0.0, 0.0, 0.0 };
+
+  for ( unsigned int id = 0; id < m_Alive.size(); id++ )
+  {
+    if ( !m_Alive[ id ] ) continue;
+
+    const float* box = &m_Boxes[ id * 6 ];
+
+    for ( unsigned int axis = 0; axis < 3; axis++ )
+    {
+      const double center = box[ axis ] + box[ 3 + axis ];
+
+      sum[ axis ]   += center;
+      sumSq[ axis ] += center * center;
+    }
+  }
+
+  /* sweep where the centers spread the most, n * variance compared */
+  double spread = -1.0;
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    if ( !( m_Axes & ( 1 << axis ) ) ) continue;
+
+    const double variance = m_Objects ? sumSq[ axis ] - sum[ axis ] * sum[ axis ] / m_Objects : 0.0;
+
+    if ( variance > spread )
+    {
+      spread      = variance;
+      m_SweepAxis = axis;
+    }
+  }
+
+  for ( unsigned int axis = 0; axis < 3; axis++ )
+  {
+    if ( !( m_Axes & ( 1 << axis ) ) ) continue;
+
+    Refresh( axis );
+
+    if ( m_Inserted * SWEEP_RESORT > m_Objects )
+      std::sort( m_Endpoints[ axis ].begin(), m_Endpoints[ axis ].end(), EndpointLess );
+    else
+      Sort( axis );
+  }
+
+  m_Inserted = 0;
+
+  Sweep( m_SweepAxis );
+
+  return m_Pairs.size();
+}
+
+unsigned int
+SweepAndPrune::Pairs( void ) const
+{
+  return m_Pairs.size();
+}
+
+const SweepPair&
+SweepAndPrune::Pair( const unsigned int pair ) const
+{
+  return m_Pairs[ pair ];
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+void
+SweepAndPrune::Refresh( const unsigned int axis )
+{
+  SweepEndpoint*     endpoints = m_Endpoints[ axis ].empty() ? 0 : &m_Endpoints[ axis ][ 0 ];
+  const float*       boxes     = m_Boxes.empty() ? 0 : &m_Boxes[ 0 ];
+  const unsigned int count     = m_Endpoints[ axis ].size();
+
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    const unsigned int data = endpoints[ i ].data;
+
+    endpoints[ i ].value = boxes[ ( data >> 1 ) * 6 + ( data & 1 ) * 3 + axis ];
+  }
+}
+
+void
+SweepAndPrune::Sort( const unsigned int axis )
+{
+  std::vector< SweepEndpoint >& endpoints = m_Endpoints[ axis ];
+
+  for ( unsigned int i = 1; i < endpoints.size(); i++ )
+  {
+    const SweepEndpoint endpoint = endpoints[ i ];
+    unsigned int        j        = i;
+
+    while ( j > 0 && EndpointLess( endpoint, endpoints[ j - 1 ] ) )
+    {
+      endpoints[ j ] = endpoints[ j - 1 ];
+      j--;
+    }
+
+    endpoints[ j ] = endpoint;
+  }
+}
+
+void
+SweepAndPrune::Rebuild( const unsigned int axis )
+{
+  std::vector< SweepEndpoint >& endpoints = m_Endpoints[ axis ];
+
+  endpoints.clear();
+
+  for ( unsigned int id = 0; id < m_Alive.size(); id++ )
+  {
+    if ( !m_Alive[ id ] ) continue;
+
+    SweepEndpoint endpoint;
+
+    endpoint.value = m_Boxes[ id * 6 + axis ];
+    endpoint.data  = id << 1;
+    endpoints.push_back( endpoint );
+
+    endpoint.value = m_Boxes[ id * 6 + 3 + axis ];
+    endpoint.data  = ( id << 1 ) | 1;
+    endpoints.push_back( endpoint );
+  }
+
+  std::sort( endpoints.begin(), endpoints.end(), EndpointLess );
+}
+
+void
+SweepAndPrune::Sweep( const unsigned int axis )
+{
+  const std::vector< SweepEndpoint >& endpoints = m_Endpoints[ axis ];
+  const unsigned int                  a1        = ( axis + 1 ) % 3;
+  const unsigned int                  a2        = ( axis + 2 ) % 3;
+
+  m_Pairs.clear();
+  m_Active.clear();
+  m_ActiveBounds.clear();
+
+  for ( unsigned int i = 0; i < endpoints.size(); i++ )
+  {
+    const unsigned int id = endpoints[ i ].data >> 1;
+
+    if ( endpoints[ i ].data & 1 )
+    {
+      const unsigned int slot = m_ActiveSlot[ id ];
+
+      /* empty boxes never became active */
+      if ( slot >= m_Active.size() || m_Active[ slot ] != id ) continue;
+
+      /* swap remove, the bounds of the active set stay packed */
+      const unsigned int last = m_Active.size() - 1;
+
+      m_Active[ slot ]                  = m_Active[ last ];
+      m_ActiveSlot[ m_Active[ slot ] ] = slot;
+
+      for ( unsigned int k = 0; k < 4; k++ )
+        m_ActiveBounds[ slot * 4 + k ] = m_ActiveBounds[ last * 4 + k ];
+
+      m_Active.pop_back();
+      m_ActiveBounds.resize( last * 4 );
+
+      continue;
+    }
+
+    const float* box = &m_Boxes[ id * 6 ];
+    const float  min1 = box[ a1 ], max1 = box[ 3 + a1 ];
+    const float  min2 = box[ a2 ], max2 = box[ 3 + a2 ];
+
+    /* empty, inverted or NaN boxes overlap nothing and are skipped */
+    if ( !( box[ 0 ] <= box[ 3 ] && box[ 1 ] <= box[ 4 ] && box[ 2 ] <= box[ 5 ] ) ) continue;
+
+    for ( unsigned int j = 0; j < m_Active.size(); j++ )
+    {
+      /* evaluated without short circuit, misses are hard to predict */
+      const float* ob      = &m_ActiveBounds[ j * 4 ];
+      const int    overlap = ( min1 <= ob[ 1 ] ) & ( max1 >= ob[ 0 ] ) &
+                             ( min2 <= ob[ 3 ] ) & ( max2 >= ob[ 2 ] );
+
+      if ( !overlap ) continue;
+
+      const unsigned int other = m_Active[ j ];
+      SweepPair          pair;
+
+      pair.first  = id < other ? id : other;
+      pair.second = id < other ? other : id;
+      m_Pairs.push_back( pair );
+    }
+
+    m_ActiveSlot[ id ] = m_Active.size();
+    m_Active.push_back( id );
+    m_ActiveBounds.push_back( min1 );
+    m_ActiveBounds.push_back( max1 );
+    m_ActiveBounds.push_back( min2 );
+    m_ActiveBounds.push_back( max2 );
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
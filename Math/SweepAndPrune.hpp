@@ -0,0 +1,134 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file SweepAndPrune.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_SWEEPANDPRUNE_HPP_
+#define MATH_SWEEPANDPRUNE_HPP_
+
+#include <vector>
+
+class Aabb3f;
+
+enum SweepAxis
+{
+  SWEEP_X   = 1,
+  SWEEP_Y   = 2,
+  SWEEP_Z   = 4,
+  SWEEP_ALL = SWEEP_X | SWEEP_Y | SWEEP_Z
+};
+
+/*
+ * Box endpoint on one axis, data holds the object id shifted left by one
+ * with the lowest bit set for the maximum.
+ */
+struct SweepEndpoint
+{
+  float         value;
+  unsigned int  data;
+};
+
+/* overlapping objects, first < second */
+struct SweepPair
+{
+  unsigned int  first;
+  unsigned int  second;
+};
+
+/*
+ * GeekEngine::SweepAndPrune
+ *
+ * Broadphase over moving axis aligned boxes. The endpoints of all boxes are
+ * kept sorted on every enabled axis and FindPairs only has to restore the
+ * order with an insertion sort, which is close to linear while objects move
+ * coherently between frames; after many insertions the lists are sorted
+ * from scratch instead. The sweep runs along the enabled axis on which the
+ * box centers spread the most and checks the remaining axes directly.
+ *
+ * Ids returned by Add are reused after Remove. Update( boxes, count ) sets
+ * the boxes of ids 0 to count - 1, which all have to be alive. Pairs are
+ * written to an internal buffer that keeps its capacity, so a steady state
+ * simulation does not allocate per frame. Touching boxes overlap. Empty,
+ * inverted or NaN boxes, such as a default Aabb3f, are kept but take no
+ * part in the sweep until they are updated to a valid box.
+ */
+class SweepAndPrune
+{
+public:
+  SweepAndPrune( const unsigned int axes = SWEEP_ALL );
+  SweepAndPrune( const SweepAndPrune& );
+  virtual
+  ~SweepAndPrune( void );
+
+  unsigned int
+  Add( const Aabb3f& box );
+  void
+  Remove( const unsigned int id );
+  void
+  Update( const unsigned int id, const Aabb3f& box );
+  void
+  Update( const Aabb3f* boxes, const unsigned int count );
+  void
+  Clear( void );
+
+  void
+  Axes( const unsigned int axes );
+  unsigned int
+  Axes( void ) const;
+  unsigned int
+  SweepAxis( void ) const;
+  unsigned int
+  Objects( void ) const;
+
+  unsigned int
+  FindPairs( void );
+  unsigned int
+  Pairs( void ) const;
+  const SweepPair&
+  Pair( const unsigned int pair ) const;
+
+protected:
+  void
+  Refresh( const unsigned int axis );
+  void
+  Sort( const unsigned int axis );
+  void
+  Rebuild( const unsigned int axis );
+  void
+  Sweep( const unsigned int axis );
+
+private:
+  unsigned int                  m_Axes;
+  unsigned int                  m_SweepAxis;
+  unsigned int                  m_Objects;
+  unsigned int                  m_Inserted;
+  std::vector< float >          m_Boxes;
+  std::vector< unsigned char >  m_Alive;
+  std::vector< unsigned int >   m_Free;
+  std::vector< SweepEndpoint >  m_Endpoints[ 3 ];
+  std::vector< unsigned int >   m_Active;
+  std::vector< unsigned int >   m_ActiveSlot;
+  std::vector< float >          m_ActiveBounds;
+  std::vector< SweepPair >      m_Pairs;
+
+};
+
+#endif /* MATH_SWEEPANDPRUNE_HPP_ */
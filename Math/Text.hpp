@@ -0,0 +1,205 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Text.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TEXT_HPP_
+#define MATH_TEXT_HPP_
+
+#include <cstddef>
+
+class Vec2f;
+class Vec3f;
+class Vec4f;
+class Quaternion;
+class Mat3f;
+class Mat4f;
+class Affine3f;
+class Vec2d;
+class Vec3d;
+class Vec4d;
+class Quaterniond;
+class Mat3d;
+class Mat4d;
+class Affine3d;
+class Vec2i;
+class Vec3i;
+class Mat3i;
+class Mat4i;
+class Vec2h;
+class Vec3h;
+class Vec4h;
+class Quaternionh;
+
+/*
+ * GeekEngine::Text
+ *
+ * Locale independent formatting and parsing without allocation, meant for
+ * logs and text files with millions of values where printf and strtod are
+ * too slow. ToChars writes into [first, last) without a terminating NUL
+ * and returns the end of the text, or NULL if it does not fit. FromChars
+ * skips leading whitespace, reads one value from [first, last) and returns
+ * the end of what it read, or NULL and leaves value alone if there is no
+ * valid number.
+ *
+ * Floats and doubles are written with the fewest digits that read back to
+ * the same bits, closest to the exact value among those, in fixed or
+ * exponent notation as in "%f" or "%e", whichever is shorter, e.g. 0.1,
+ * 1e+20, -2.5e-07, inf and nan. This takes at most 15 characters for a
+ * float and 24 for a double. Reading is correctly rounded for any number
+ * of digits. Both use Schubfach and Eisel-Lemire with one shared table of
+ * powers of ten, input with more than 19 significant digits that is too
+ * close to a halfway point for them falls back to big integers.
+ *
+ * The vectors, quaternions and matrices are their components in member
+ * order, rows first, separated by single spaces. Vec4d is written with
+ * float precision as it stores floats, half types through their float
+ * value, which reads back to the same half.
+ *
+ * Parse reads up to capacity whitespace separated values and returns how
+ * many it read. It stops at the first text that is not a number, stop is
+ * set to where it stopped, so a stream can be parsed in blocks by moving
+ * the rest of a block to the front of the next. With stop, a value that
+ * runs up to last may go on in the next block and is left there unless
+ * end marks the final block. Without stop the text is taken as complete.
+ */
+class Text
+{
+public:
+  static char*
+  ToChars( char* first, char* last, const float value );
+  static char*
+  ToChars( char* first, char* last, const double value );
+  static char*
+  ToChars( char* first, char* last, const int value );
+  static char*
+  ToChars( char* first, char* last, const Vec2f& value );
+  static char*
+  ToChars( char* first, char* last, const Vec3f& value );
+  static char*
+  ToChars( char* first, char* last, const Vec4f& value );
+  static char*
+  ToChars( char* first, char* last, const Quaternion& value );
+  static char*
+  ToChars( char* first, char* last, const Mat3f& value );
+  static char*
+  ToChars( char* first, char* last, const Mat4f& value );
+  static char*
+  ToChars( char* first, char* last, const Affine3f& value );
+  static char*
+  ToChars( char* first, char* last, const Vec2d& value );
+  static char*
+  ToChars( char* first, char* last, const Vec3d& value );
+  static char*
+  ToChars( char* first, char* last, const Vec4d& value );
+  static char*
+  ToChars( char* first, char* last, const Quaterniond& value );
+  static char*
+  ToChars( char* first, char* last, const Mat3d& value );
+  static char*
+  ToChars( char* first, char* last, const Mat4d& value );
+  static char*
+  ToChars( char* first, char* last, const Affine3d& value );
+  static char*
+  ToChars( char* first, char* last, const Vec2i& value );
+  static char*
+  ToChars( char* first, char* last, const Vec3i& value );
+  static char*
+  ToChars( char* first, char* last, const Mat3i& value );
+  static char*
+  ToChars( char* first, char* last, const Mat4i& value );
+  static char*
+  ToChars( char* first, char* last, const Vec2h& value );
+  static char*
+  ToChars( char* first, char* last, const Vec3h& value );
+  static char*
+  ToChars( char* first, char* last, const Vec4h& value );
+  static char*
+  ToChars( char* first, char* last, const Quaternionh& value );
+
+  static const char*
+  FromChars( const char* first, const char* last, float& value );
+  static const char*
+  FromChars( const char* first, const char* last, double& value );
+  static const char*
+  FromChars( const char* first, const char* last, int& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec2f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec3f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec4f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Quaternion& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat3f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat4f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Affine3f& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec2d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec3d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec4d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Quaterniond& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat3d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat4d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Affine3d& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec2i& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec3i& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat3i& value );
+  static const char*
+  FromChars( const char* first, const char* last, Mat4i& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec2h& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec3h& value );
+  static const char*
+  FromChars( const char* first, const char* last, Vec4h& value );
+  static const char*
+  FromChars( const char* first, const char* last, Quaternionh& value );
+
+  static unsigned int
+  Parse( const char* first, const char* last, float* values, const unsigned int capacity,
+         const char** stop = NULL, const bool end = false );
+  static unsigned int
+  Parse( const char* first, const char* last, double* values, const unsigned int capacity,
+         const char** stop = NULL, const bool end = false );
+  static unsigned int
+  Parse( const char* first, const char* last, int* values, const unsigned int capacity,
+         const char** stop = NULL, const bool end = false );
+
+protected:
+private:
+  Text( void );
+
+};
+
+#endif /* MATH_TEXT_HPP_ */
@@ -0,0 +1,169 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Track.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Track.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Track::Track( void ) :
+  m_Interpolation( TRACK_LINEAR )
+{
+  return;
+}
+
+Track::Track( const Track& other ) :
+  m_Times( other.m_Times ),
+  m_Interpolation( other.m_Interpolation )
+{
+  return;
+}
+
+Track::~Track( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Track::Interpolation( const TrackInterpolation mode )
+{
+  m_Interpolation = mode;
+}
+
+TrackInterpolation
+Track::Interpolation( void ) const
+{
+  return m_Interpolation;
+}
+
+unsigned int
+Track::Keys( void ) const
+{
+  return m_Times.size();
+}
+
+float
+Track::Time( const unsigned int key ) const
+{
+  return m_Times[ key ];
+}
+
+float
+Track::Duration( void ) const
+{
+  if ( m_Times.empty() ) return 0.0f;
+
+  return m_Times.back() - m_Times.front();
+}
+
+unsigned int
+Track::Seek( const float time ) const
+{
+  const unsigned int count = m_Times.size();
+
+  if ( count < 2 || time <= m_Times[ 0 ] ) return 0;
+  if ( time >= m_Times[ count - 1 ] ) return count - 1;
+
+  unsigned int low  = 0;
+  unsigned int high = count - 1;
+
+  /* invariant: m_Times[ low ] <= time < m_Times[ high ] */
+  while ( high - low > 1 )
+  {
+    const unsigned int mid = ( low + high ) / 2;
+
+    if ( m_Times[ mid ] <= time ) low  = mid;
+    else                          high = mid;
+  }
+
+  return low;
+}
+
+unsigned int
+Track::Seek( const float time, unsigned int& cursor ) const
+{
+  const unsigned int count = m_Times.size();
+
+  if ( cursor >= count || time < m_Times[ cursor ] )
+    return cursor = Seek( time );
+
+  /* forward playback moves at most a few keys per sample */
+  while ( cursor + 1 < count && m_Times[ cursor + 1 ] <= time )
+    cursor++;
+
+  return cursor;
+}
+
+float
+Track::Factor( const unsigned int key, const float time ) const
+{
+  if ( key + 1 >= m_Times.size() ) return 0.0f;
+
+  const float span = m_Times[ key + 1 ] - m_Times[ key ];
+
+  if ( span <= 0.0f ) return 0.0f;
+
+  const float factor = ( time - m_Times[ key ] ) / span;
+
+  if ( factor < 0.0f ) return 0.0f;
+  if ( factor > 1.0f ) return 1.0f;
+
+  return factor;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+void
+Track::AddTime( const float time )
+{
+  m_Times.push_back( time );
+}
+
+void
+Track::ClearTimes( void )
+{
+  m_Times.clear();
+}
+
+void
+Track::Neighbours( const unsigned int key, unsigned int& prev, unsigned int& next, unsigned int& after ) const
+{
+  const unsigned int last = m_Times.empty() ? 0 : m_Times.size() - 1;
+
+  prev  = key > 0 ? key - 1 : key;
+  next  = key < last ? key + 1 : last;
+  after = next < last ? next + 1 : last;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,84 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Track.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TRACK_HPP_
+#define MATH_TRACK_HPP_
+
+#include <vector>
+
+enum TrackInterpolation
+{
+  TRACK_STEP,
+  TRACK_LINEAR,
+  TRACK_CUBIC
+};
+
+/*
+ * GeekEngine::Track
+ *
+ * Key times shared by all keyframe tracks. Keys have to be added in
+ * ascending time order. Lookups take a cursor (index of the last key pair
+ * used) so sequential playback walks forward instead of searching again.
+ */
+class Track
+{
+public:
+  Track( void );
+  Track( const Track& );
+  virtual
+  ~Track( void );
+
+  void
+  Interpolation( const TrackInterpolation mode );
+  TrackInterpolation
+  Interpolation( void ) const;
+
+  unsigned int
+  Keys( void ) const;
+  float
+  Time( const unsigned int key ) const;
+  float
+  Duration( void ) const;
+
+  unsigned int
+  Seek( const float time ) const;
+  unsigned int
+  Seek( const float time, unsigned int& cursor ) const;
+  float
+  Factor( const unsigned int key, const float time ) const;
+
+protected:
+  void
+  AddTime( const float time );
+  void
+  ClearTimes( void );
+  void
+  Neighbours( const unsigned int key, unsigned int& prev, unsigned int& next, unsigned int& after ) const;
+
+private:
+  std::vector< float >  m_Times;
+  TrackInterpolation    m_Interpolation;
+
+};
+
+#endif /* MATH_TRACK_HPP_ */
@@ -0,0 +1,127 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackFloat.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "TrackFloat.hpp"
+
+static float
+CatmullRom( const float p0, const float p1, const float p2, const float p3, const float t )
+{
+  const float t2 = t * t;
+  const float t3 = t2 * t;
+
+  return 0.5f * ( 2.0f * p1 +
+                  ( p2 - p0 ) * t +
+                  ( 2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 ) * t2 +
+                  ( 3.0f * ( p1 - p2 ) + p3 - p0 ) * t3 );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+TrackFloat::TrackFloat( void ) : Track() { return; }
+
+TrackFloat::TrackFloat( const TrackFloat& other ) :
+  Track( other ),
+  m_Values( other.m_Values )
+{
+  return;
+}
+
+TrackFloat::~TrackFloat( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+TrackFloat::AddKey( const float time, const float value )
+{
+  AddTime( time );
+  m_Values.push_back( value );
+}
+
+void
+TrackFloat::Clear( void )
+{
+  ClearTimes();
+  m_Values.clear();
+}
+
+float
+TrackFloat::Value( const unsigned int key ) const
+{
+  return m_Values[ key ];
+}
+
+float
+TrackFloat::Sample( const float time ) const
+{
+  if ( m_Values.empty() ) return 0.0f;
+
+  return Evaluate( Seek( time ), time );
+}
+
+float
+TrackFloat::Sample( const float time, unsigned int& cursor ) const
+{
+  if ( m_Values.empty() ) return 0.0f;
+
+  return Evaluate( Seek( time, cursor ), time );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+float
+TrackFloat::Evaluate( const unsigned int key, const float time ) const
+{
+  unsigned int prev, next, after;
+
+  Neighbours( key, prev, next, after );
+
+  const float t = Factor( key, time );
+
+  switch ( Interpolation() )
+  {
+    case TRACK_STEP:
+      return m_Values[ key ];
+
+    case TRACK_CUBIC:
+      return CatmullRom( m_Values[ prev ], m_Values[ key ], m_Values[ next ], m_Values[ after ], t );
+
+    case TRACK_LINEAR:
+    default:
+      return m_Values[ key ] + ( m_Values[ next ] - m_Values[ key ] ) * t;
+  }
+}
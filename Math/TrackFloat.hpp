@@ -0,0 +1,64 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackFloat.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TRACKFLOAT_HPP_
+#define MATH_TRACKFLOAT_HPP_
+
+#include "Track.hpp"
+
+#include <vector>
+
+/*
+ * GeekEngine::TrackFloat
+ */
+class TrackFloat : public Track
+{
+public:
+  TrackFloat( void );
+  TrackFloat( const TrackFloat& );
+  virtual
+  ~TrackFloat( void );
+
+  void
+  AddKey( const float time, const float value );
+  void
+  Clear( void );
+
+  float
+  Value( const unsigned int key ) const;
+
+  float
+  Sample( const float time ) const;
+  float
+  Sample( const float time, unsigned int& cursor ) const;
+
+protected:
+private:
+  float
+  Evaluate( const unsigned int key, const float time ) const;
+
+  std::vector< float > m_Values;
+
+};
+
+#endif /* MATH_TRACKFLOAT_HPP_ */
@@ -0,0 +1,217 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackQuaternion.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "TrackQuaternion.hpp"
+
+#include "Quaternion.hpp"
+
+#include <cmath>
+
+#define SLERP_THRESHOLD 0.9995f
+
+static float
+CatmullRom( const float p0, const float p1, const float p2, const float p3, const float t )
+{
+  const float t2 = t * t;
+  const float t3 = t2 * t;
+
+  return 0.5f * ( 2.0f * p1 +
+                  ( p2 - p0 ) * t +
+                  ( 2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 ) * t2 +
+                  ( 3.0f * ( p1 - p2 ) + p3 - p0 ) * t3 );
+}
+
+static float
+Dot( const float* a, const float* b )
+{
+  return a[ 0 ] * b[ 0 ] + a[ 1 ] * b[ 1 ] + a[ 2 ] * b[ 2 ] + a[ 3 ] * b[ 3 ];
+}
+
+static void
+Normalize( float* q )
+{
+  const float lengthSq = Dot( q, q );
+
+  if ( lengthSq == 0.0f )
+  {
+    q[ 0 ] = q[ 1 ] = q[ 2 ] = 0.0f; q[ 3 ] = 1.0f;
+    return;
+  }
+
+  const float invLength = 1.0f / sqrtf( lengthSq );
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    q[ i ] *= invLength;
+}
+
+/* copies q into out, flipped into the hemisphere of reference */
+static void
+Align( const float* reference, const float* q, float* out )
+{
+  const float sign = Dot( reference, q ) < 0.0f ? -1.0f : 1.0f;
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    out[ i ] = q[ i ] * sign;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+TrackQuaternion::TrackQuaternion( void ) : Track() { return; }
+
+TrackQuaternion::TrackQuaternion( const TrackQuaternion& other ) :
+  Track( other ),
+  m_Values( other.m_Values )
+{
+  return;
+}
+
+TrackQuaternion::~TrackQuaternion( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+TrackQuaternion::AddKey( const float time, const Quaternion& value )
+{
+  AddTime( time );
+  m_Values.push_back( value.X() );
+  m_Values.push_back( value.Y() );
+  m_Values.push_back( value.Z() );
+  m_Values.push_back( value.W() );
+}
+
+void
+TrackQuaternion::Clear( void )
+{
+  ClearTimes();
+  m_Values.clear();
+}
+
+Quaternion
+TrackQuaternion::Value( const unsigned int key ) const
+{
+  const float* v = &m_Values[ key * 4 ];
+
+  return Quaternion( v[ 0 ], v[ 1 ], v[ 2 ], v[ 3 ] );
+}
+
+Quaternion
+TrackQuaternion::Sample( const float time ) const
+{
+  if ( m_Values.empty() ) return Quaternion();
+
+  float out[ 4 ];
+
+  Evaluate( Seek( time ), time, out );
+
+  return Quaternion( out[ 0 ], out[ 1 ], out[ 2 ], out[ 3 ] );
+}
+
+Quaternion
+TrackQuaternion::Sample( const float time, unsigned int& cursor ) const
+{
+  float out[ 4 ];
+
+  Sample( time, cursor, out );
+
+  return Quaternion( out[ 0 ], out[ 1 ], out[ 2 ], out[ 3 ] );
+}
+
+void
+TrackQuaternion::Sample( const float time, unsigned int& cursor, float* out ) const
+{
+  if ( m_Values.empty() )
+  {
+    out[ 0 ] = out[ 1 ] = out[ 2 ] = 0.0f; out[ 3 ] = 1.0f;
+    return;
+  }
+
+  Evaluate( Seek( time, cursor ), time, out );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+TrackQuaternion::Evaluate( const unsigned int key, const float time, float* out ) const
+{
+  unsigned int prev, next, after;
+
+  Neighbours( key, prev, next, after );
+
+  const float  t  = Factor( key, time );
+  const float* p1 = &m_Values[ key * 4 ];
+  float        p0[ 4 ], p2[ 4 ], p3[ 4 ];
+
+  if ( Interpolation() == TRACK_STEP || t == 0.0f )
+  {
+    for ( unsigned int i = 0; i < 4; i++ )
+      out[ i ] = p1[ i ];
+    return;
+  }
+
+  Align( p1, &m_Values[ next * 4 ], p2 );
+
+  if ( Interpolation() == TRACK_CUBIC )
+  {
+    Align( p1, &m_Values[ prev  * 4 ], p0 );
+    Align( p2, &m_Values[ after * 4 ], p3 );
+
+    for ( unsigned int i = 0; i < 4; i++ )
+      out[ i ] = CatmullRom( p0[ i ], p1[ i ], p2[ i ], p3[ i ], t );
+
+    Normalize( out );
+    return;
+  }
+
+  const float cosAngle = Dot( p1, p2 );
+  float       src      = 1.0f - t;
+  float       dest     = t;
+
+  if ( cosAngle < SLERP_THRESHOLD )
+  {
+    const float angle  = acosf( cosAngle );
+    const float invSin = 1.0f / sinf( angle );
+
+    src  = sinf( src  * angle ) * invSin;
+    dest = sinf( dest * angle ) * invSin;
+  }
+
+  for ( unsigned int i = 0; i < 4; i++ )
+    out[ i ] = p1[ i ] * src + p2[ i ] * dest;
+
+  Normalize( out );
+}
@@ -0,0 +1,172 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackSampler.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "TrackSampler.hpp"
+
+#include "TrackFloat.hpp"
+#include "TrackVec3f.hpp"
+#include "TrackQuaternion.hpp"
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+TrackSampler::TrackSampler( void ) { return; }
+
+TrackSampler::TrackSampler( const TrackSampler& other ) :
+  m_FloatTracks( other.m_FloatTracks ),
+  m_Vec3fTracks( other.m_Vec3fTracks ),
+  m_QuaternionTracks( other.m_QuaternionTracks ),
+  m_FloatCursors( other.m_FloatCursors ),
+  m_Vec3fCursors( other.m_Vec3fCursors ),
+  m_QuaternionCursors( other.m_QuaternionCursors )
+{
+  return;
+}
+
+TrackSampler::~TrackSampler( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+TrackSampler::Add( const TrackFloat* track )
+{
+  m_FloatTracks.push_back( track );
+  m_FloatCursors.push_back( 0 );
+
+  return m_FloatTracks.size() - 1;
+}
+
+unsigned int
+TrackSampler::Add( const TrackVec3f* track )
+{
+  m_Vec3fTracks.push_back( track );
+  m_Vec3fCursors.push_back( 0 );
+
+  return m_Vec3fTracks.size() - 1;
+}
+
+unsigned int
+TrackSampler::Add( const TrackQuaternion* track )
+{
+  m_QuaternionTracks.push_back( track );
+  m_QuaternionCursors.push_back( 0 );
+
+  return m_QuaternionTracks.size() - 1;
+}
+
+void
+TrackSampler::Clear( void )
+{
+  m_FloatTracks.clear();
+  m_Vec3fTracks.clear();
+  m_QuaternionTracks.clear();
+
+  m_FloatCursors.clear();
+  m_Vec3fCursors.clear();
+  m_QuaternionCursors.clear();
+}
+
+void
+TrackSampler::Rewind( void )
+{
+  m_FloatCursors.assign( m_FloatCursors.size(), 0 );
+  m_Vec3fCursors.assign( m_Vec3fCursors.size(), 0 );
+  m_QuaternionCursors.assign( m_QuaternionCursors.size(), 0 );
+}
+
+unsigned int
+TrackSampler::FloatTracks( void ) const
+{
+  return m_FloatTracks.size();
+}
+
+unsigned int
+TrackSampler::Vec3fTracks( void ) const
+{
+  return m_Vec3fTracks.size();
+}
+
+unsigned int
+TrackSampler::QuaternionTracks( void ) const
+{
+  return m_QuaternionTracks.size();
+}
+
+void
+TrackSampler::SampleFloat( const float time, float* values )
+{
+  const unsigned int count = m_FloatTracks.size();
+
+  for ( unsigned int i = 0; i < count; i++ )
+    values[ i ] = m_FloatTracks[ i ]->Sample( time, m_FloatCursors[ i ] );
+}
+
+void
+TrackSampler::SampleVec3f( const float time, float* x, float* y, float* z )
+{
+  const unsigned int count = m_Vec3fTracks.size();
+  float              value[ 3 ];
+
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    m_Vec3fTracks[ i ]->Sample( time, m_Vec3fCursors[ i ], value );
+
+    x[ i ] = value[ 0 ];
+    y[ i ] = value[ 1 ];
+    z[ i ] = value[ 2 ];
+  }
+}
+
+void
+TrackSampler::SampleQuaternion( const float time, float* x, float* y, float* z, float* w )
+{
+  const unsigned int count = m_QuaternionTracks.size();
+  float              value[ 4 ];
+
+  for ( unsigned int i = 0; i < count; i++ )
+  {
+    m_QuaternionTracks[ i ]->Sample( time, m_QuaternionCursors[ i ], value );
+
+    x[ i ] = value[ 0 ];
+    y[ i ] = value[ 1 ];
+    z[ i ] = value[ 2 ];
+    w[ i ] = value[ 3 ];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,87 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackSampler.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TRACKSAMPLER_HPP_
+#define MATH_TRACKSAMPLER_HPP_
+
+#include <vector>
+
+class TrackFloat;
+class TrackVec3f;
+class TrackQuaternion;
+
+/*
+ * GeekEngine::TrackSampler
+ *
+ * Samples many tracks at one point in time, keeping a cursor per track so
+ * forward playback costs amortized O(1) per track. Results are written as
+ * structure of arrays, one output array per component, in the order the
+ * tracks were added. The tracks are not owned and have to outlive the
+ * sampler.
+ */
+class TrackSampler
+{
+public:
+  TrackSampler( void );
+  TrackSampler( const TrackSampler& );
+  virtual
+  ~TrackSampler( void );
+
+  unsigned int
+  Add( const TrackFloat* track );
+  unsigned int
+  Add( const TrackVec3f* track );
+  unsigned int
+  Add( const TrackQuaternion* track );
+  void
+  Clear( void );
+  void
+  Rewind( void );
+
+  unsigned int
+  FloatTracks( void ) const;
+  unsigned int
+  Vec3fTracks( void ) const;
+  unsigned int
+  QuaternionTracks( void ) const;
+
+  void
+  SampleFloat( const float time, float* values );
+  void
+  SampleVec3f( const float time, float* x, float* y, float* z );
+  void
+  SampleQuaternion( const float time, float* x, float* y, float* z, float* w );
+
+protected:
+private:
+  std::vector< const TrackFloat* >      m_FloatTracks;
+  std::vector< const TrackVec3f* >      m_Vec3fTracks;
+  std::vector< const TrackQuaternion* > m_QuaternionTracks;
+
+  std::vector< unsigned int >           m_FloatCursors;
+  std::vector< unsigned int >           m_Vec3fCursors;
+  std::vector< unsigned int >           m_QuaternionCursors;
+
+};
+
+#endif /* MATH_TRACKSAMPLER_HPP_ */
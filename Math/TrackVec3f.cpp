@@ -0,0 +1,161 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackVec3f.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "TrackVec3f.hpp"
+
+#include "Vec3f.hpp"
+
+static float
+CatmullRom( const float p0, const float p1, const float p2, const float p3, const float t )
+{
+  const float t2 = t * t;
+  const float t3 = t2 * t;
+
+  return 0.5f * ( 2.0f * p1 +
+                  ( p2 - p0 ) * t +
+                  ( 2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 ) * t2 +
+                  ( 3.0f * ( p1 - p2 ) + p3 - p0 ) * t3 );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+TrackVec3f::TrackVec3f( void ) : Track() { return; }
+
+TrackVec3f::TrackVec3f( const TrackVec3f& other ) :
+  Track( other ),
+  m_Values( other.m_Values )
+{
+  return;
+}
+
+TrackVec3f::~TrackVec3f( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+TrackVec3f::AddKey( const float time, const Vec3f& value )
+{
+  AddTime( time );
+  m_Values.push_back( value.X() );
+  m_Values.push_back( value.Y() );
+  m_Values.push_back( value.Z() );
+}
+
+void
+TrackVec3f::Clear( void )
+{
+  ClearTimes();
+  m_Values.clear();
+}
+
+Vec3f
+TrackVec3f::Value( const unsigned int key ) const
+{
+  const float* v = &m_Values[ key * 3 ];
+
+  return Vec3f( v[ 0 ], v[ 1 ], v[ 2 ] );
+}
+
+Vec3f
+TrackVec3f::Sample( const float time ) const
+{
+  if ( m_Values.empty() ) return Vec3f();
+
+  float out[ 3 ];
+
+  Evaluate( Seek( time ), time, out );
+
+  return Vec3f( out[ 0 ], out[ 1 ], out[ 2 ] );
+}
+
+Vec3f
+TrackVec3f::Sample( const float time, unsigned int& cursor ) const
+{
+  float out[ 3 ];
+
+  Sample( time, cursor, out );
+
+  return Vec3f( out[ 0 ], out[ 1 ], out[ 2 ] );
+}
+
+void
+TrackVec3f::Sample( const float time, unsigned int& cursor, float* out ) const
+{
+  if ( m_Values.empty() )
+  {
+    out[ 0 ] = out[ 1 ] = out[ 2 ] = 0.0f;
+    return;
+  }
+
+  Evaluate( Seek( time, cursor ), time, out );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+TrackVec3f::Evaluate( const unsigned int key, const float time, float* out ) const
+{
+  unsigned int prev, next, after;
+
+  Neighbours( key, prev, next, after );
+
+  const float  t  = Factor( key, time );
+  const float* p0 = &m_Values[ prev  * 3 ];
+  const float* p1 = &m_Values[ key   * 3 ];
+  const float* p2 = &m_Values[ next  * 3 ];
+  const float* p3 = &m_Values[ after * 3 ];
+
+  switch ( Interpolation() )
+  {
+    case TRACK_STEP:
+      for ( unsigned int i = 0; i < 3; i++ )
+        out[ i ] = p1[ i ];
+      break;
+
+    case TRACK_CUBIC:
+      for ( unsigned int i = 0; i < 3; i++ )
+        out[ i ] = CatmullRom( p0[ i ], p1[ i ], p2[ i ], p3[ i ], t );
+      break;
+
+    case TRACK_LINEAR:
+    default:
+      for ( unsigned int i = 0; i < 3; i++ )
+        out[ i ] = p1[ i ] + ( p2[ i ] - p1[ i ] ) * t;
+      break;
+  }
+}
@@ -0,0 +1,70 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file TrackVec3f.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TRACKVEC3F_HPP_
+#define MATH_TRACKVEC3F_HPP_
+
+#include "Track.hpp"
+
+#include <vector>
+
+class Vec3f;
+
+/*
+ * GeekEngine::TrackVec3f
+ *
+ * Keys are stored as packed x, y, z floats.
+ */
+class TrackVec3f : public Track
+{
+public:
+  TrackVec3f( void );
+  TrackVec3f( const TrackVec3f& );
+  virtual
+  ~TrackVec3f( void );
+
+  void
+  AddKey( const float time, const Vec3f& value );
+  void
+  Clear( void );
+
+  Vec3f
+  Value( const unsigned int key ) const;
+
+  Vec3f
+  Sample( const float time ) const;
+  Vec3f
+  Sample( const float time, unsigned int& cursor ) const;
+  void
+  Sample( const float time, unsigned int& cursor, float* out ) const;
+
+protected:
+private:
+  void
+  Evaluate( const unsigned int key, const float time, float* out ) const;
+
+  std::vector< float > m_Values;
+
+};
+
+#endif /* MATH_TRACKVEC3F_HPP_ */
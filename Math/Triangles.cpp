@@ -0,0 +1,227 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Triangles.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Triangles.hpp"
+
+#include "Vec3f.hpp"
+
+#define TRIANGLE_PACKET   8
+#define TRIANGLE_EPSILON  1e-8f
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Triangles::Triangles( void ) { return; }
+
+Triangles::Triangles( const Triangles& other )
+{
+  for ( unsigned int i = 0; i < COMPONENTS; i++ )
+    m_Values[ i ] = other.m_Values[ i ];
+}
+
+Triangles::~Triangles( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Triangles::Add( const Vec3f& a, const Vec3f& b, const Vec3f& c )
+{
+  m_Values[ V0X ].push_back( a.X() );
+  m_Values[ V0Y ].push_back( a.Y() );
+  m_Values[ V0Z ].push_back( a.Z() );
+  m_Values[ E1X ].push_back( b.X() - a.X() );
+  m_Values[ E1Y ].push_back( b.Y() - a.Y() );
+  m_Values[ E1Z ].push_back( b.Z() - a.Z() );
+  m_Values[ E2X ].push_back( c.X() - a.X() );
+  m_Values[ E2Y ].push_back( c.Y() - a.Y() );
+  m_Values[ E2Z ].push_back( c.Z() - a.Z() );
+}
+
+void
+Triangles::Clear( void )
+{
+  for ( unsigned int i = 0; i < COMPONENTS; i++ )
+    m_Values[ i ].clear();
+}
+
+unsigned int
+Triangles::Count( void ) const
+{
+  return m_Values[ V0X ].size();
+}
+
+int
+Triangles::Intersect( const Vec3f& origin, const Vec3f& direction, const float maxDistance,
+                      float& t, float& u, float& v ) const
+{
+  const unsigned int count = Count();
+  const float        ox = origin.X(),    oy = origin.Y(),    oz = origin.Z();
+  const float        dx = direction.X(), dy = direction.Y(), dz = direction.Z();
+  int                closest  = -1;
+  float              distance = maxDistance;
+
+  for ( unsigned int base = 0; base < count; base += TRIANGLE_PACKET )
+  {
+    const unsigned int lanes = count - base < TRIANGLE_PACKET ? count - base : TRIANGLE_PACKET;
+    const float*       v0x = &m_Values[ V0X ][ base ];
+    const float*       v0y = &m_Values[ V0Y ][ base ];
+    const float*       v0z = &m_Values[ V0Z ][ base ];
+    const float*       e1x = &m_Values[ E1X ][ base ];
+    const float*       e1y = &m_Values[ E1Y ][ base ];
+    const float*       e1z = &m_Values[ E1Z ][ base ];
+    const float*       e2x = &m_Values[ E2X ][ base ];
+    const float*       e2y = &m_Values[ E2Y ][ base ];
+    const float*       e2z = &m_Values[ E2Z ][ base ];
+    float              laneT[ TRIANGLE_PACKET ];
+    float              laneU[ TRIANGLE_PACKET ];
+    float              laneV[ TRIANGLE_PACKET ];
+    bool               laneHit[ TRIANGLE_PACKET ];
+
+    /* branch free over the packet, laneHit masks the misses */
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const float px  = dy * e2z[ i ] - dz * e2y[ i ];
+      const float py  = dz * e2x[ i ] - dx * e2z[ i ];
+      const float pz  = dx * e2y[ i ] - dy * e2x[ i ];
+      const float det = e1x[ i ] * px + e1y[ i ] * py + e1z[ i ] * pz;
+      const float inv = 1.0f / det;
+      const float sx  = ox - v0x[ i ];
+      const float sy  = oy - v0y[ i ];
+      const float sz  = oz - v0z[ i ];
+      const float bu  = ( sx * px + sy * py + sz * pz ) * inv;
+      const float qx  = sy * e1z[ i ] - sz * e1y[ i ];
+      const float qy  = sz * e1x[ i ] - sx * e1z[ i ];
+      const float qz  = sx * e1y[ i ] - sy * e1x[ i ];
+      const float bv  = ( dx * qx + dy * qy + dz * qz ) * inv;
+      const float d   = ( e2x[ i ] * qx + e2y[ i ] * qy + e2z[ i ] * qz ) * inv;
+      const bool  hit = ( det > TRIANGLE_EPSILON || det < -TRIANGLE_EPSILON ) &&
+                        bu >= 0.0f && bv >= 0.0f && bu + bv <= 1.0f && d >= 0.0f;
+
+      laneHit[ i ] = hit;
+      laneT[ i ]   = d;
+      laneU[ i ]   = bu;
+      laneV[ i ]   = bv;
+    }
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+      if ( laneHit[ i ] && laneT[ i ] < distance )
+      {
+        distance = laneT[ i ];
+        closest  = base + i;
+        u        = laneU[ i ];
+        v        = laneV[ i ];
+      }
+  }
+
+  if ( closest >= 0 ) t = distance;
+
+  return closest;
+}
+
+unsigned int
+Triangles::Intersect( const unsigned int triangle,
+                      const float* originX, const float* originY, const float* originZ,
+                      const float* directionX, const float* directionY, const float* directionZ,
+                      const unsigned int rays, float* t, float* u, float* v, int* hit ) const
+{
+  const float  v0x = m_Values[ V0X ][ triangle ];
+  const float  v0y = m_Values[ V0Y ][ triangle ];
+  const float  v0z = m_Values[ V0Z ][ triangle ];
+  const float  e1x = m_Values[ E1X ][ triangle ];
+  const float  e1y = m_Values[ E1Y ][ triangle ];
+  const float  e1z = m_Values[ E1Z ][ triangle ];
+  const float  e2x = m_Values[ E2X ][ triangle ];
+  const float  e2y = m_Values[ E2Y ][ triangle ];
+  const float  e2z = m_Values[ E2Z ][ triangle ];
+  unsigned int updated = 0;
+
+  for ( unsigned int base = 0; base < rays; base += TRIANGLE_PACKET )
+  {
+    const unsigned int lanes = rays - base < TRIANGLE_PACKET ? rays - base : TRIANGLE_PACKET;
+    float              laneT[ TRIANGLE_PACKET ];
+    float              laneU[ TRIANGLE_PACKET ];
+    float              laneV[ TRIANGLE_PACKET ];
+    bool               laneHit[ TRIANGLE_PACKET ];
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const unsigned int r = base + i;
+
+      const float px  = directionY[ r ] * e2z - directionZ[ r ] * e2y;
+      const float py  = directionZ[ r ] * e2x - directionX[ r ] * e2z;
+      const float pz  = directionX[ r ] * e2y - directionY[ r ] * e2x;
+      const float det = e1x * px + e1y * py + e1z * pz;
+      const float inv = 1.0f / det;
+      const float sx  = originX[ r ] - v0x;
+      const float sy  = originY[ r ] - v0y;
+      const float sz  = originZ[ r ] - v0z;
+      const float bu  = ( sx * px + sy * py + sz * pz ) * inv;
+      const float qx  = sy * e1z - sz * e1y;
+      const float qy  = sz * e1x - sx * e1z;
+      const float qz  = sx * e1y - sy * e1x;
+      const float bv  = ( directionX[ r ] * qx + directionY[ r ] * qy + directionZ[ r ] * qz ) * inv;
+      const float d   = ( e2x * qx + e2y * qy + e2z * qz ) * inv;
+      const bool  ok  = ( det > TRIANGLE_EPSILON || det < -TRIANGLE_EPSILON ) &&
+                        bu >= 0.0f && bv >= 0.0f && bu + bv <= 1.0f && d >= 0.0f;
+
+      laneHit[ i ] = ok;
+      laneT[ i ]   = d;
+      laneU[ i ]   = bu;
+      laneV[ i ]   = bv;
+    }
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const unsigned int r = base + i;
+
+      if ( !laneHit[ i ] || laneT[ i ] >= t[ r ] ) continue;
+
+      t[ r ] = laneT[ i ];
+      u[ r ] = laneU[ i ];
+      v[ r ] = laneV[ i ];
+
+      if ( hit ) hit[ r ] = triangle;
+
+      updated++;
+    }
+  }
+
+  return updated;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,227 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Trianglesd.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Trianglesd.hpp"
+
+#include "Vec3d.hpp"
+
+#define TRIANGLE_PACKET   8
+#define TRIANGLE_EPSILON  1e-12
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Trianglesd::Trianglesd( void ) { return; }
+
+Trianglesd::Trianglesd( const Trianglesd& other )
+{
+  for ( unsigned int i = 0; i < COMPONENTS; i++ )
+    m_Values[ i ] = other.m_Values[ i ];
+}
+
+Trianglesd::~Trianglesd( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Trianglesd::Add( const Vec3d& a, const Vec3d& b, const Vec3d& c )
+{
+  m_Values[ V0X ].push_back( a.X() );
+  m_Values[ V0Y ].push_back( a.Y() );
+  m_Values[ V0Z ].push_back( a.Z() );
+  m_Values[ E1X ].push_back( b.X() - a.X() );
+  m_Values[ E1Y ].push_back( b.Y() - a.Y() );
+  m_Values[ E1Z ].push_back( b.Z() - a.Z() );
+  m_Values[ E2X ].push_back( c.X() - a.X() );
+  m_Values[ E2Y ].push_back( c.Y() - a.Y() );
+  m_Values[ E2Z ].push_back( c.Z() - a.Z() );
+}
+
+void
+Trianglesd::Clear( void )
+{
+  for ( unsigned int i = 0; i < COMPONENTS; i++ )
+    m_Values[ i ].clear();
+}
+
+unsigned int
+Trianglesd::Count( void ) const
+{
+  return m_Values[ V0X ].size();
+}
+
+int
+Trianglesd::Intersect( const Vec3d& origin, const Vec3d& direction, const double maxDistance,
+                      double& t, double& u, double& v ) const
+{
+  const unsigned int count = Count();
+  const double       ox = origin.X(),    oy = origin.Y(),    oz = origin.Z();
+  const double       dx = direction.X(), dy = direction.Y(), dz = direction.Z();
+  int                closest  = -1;
+  double             distance = maxDistance;
+
+  for ( unsigned int base = 0; base < count; base += TRIANGLE_PACKET )
+  {
+    const unsigned int lanes = count - base < TRIANGLE_PACKET ? count - base : TRIANGLE_PACKET;
+    const double*      v0x = &m_Values[ V0X ][ base ];
+    const double*      v0y = &m_Values[ V0Y ][ base ];
+    const double*      v0z = &m_Values[ V0Z ][ base ];
+    const double*      e1x = &m_Values[ E1X ][ base ];
+    const double*      e1y = &m_Values[ E1Y ][ base ];
+    const double*      e1z = &m_Values[ E1Z ][ base ];
+    const double*      e2x = &m_Values[ E2X ][ base ];
+    const double*      e2y = &m_Values[ E2Y ][ base ];
+    const double*      e2z = &m_Values[ E2Z ][ base ];
+    double             laneT[ TRIANGLE_PACKET ];
+    double             laneU[ TRIANGLE_PACKET ];
+    double             laneV[ TRIANGLE_PACKET ];
+    bool               laneHit[ TRIANGLE_PACKET ];
+
+    /* branch free over the packet, laneHit masks the misses */
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const double px  = dy * e2z[ i ] - dz * e2y[ i ];
+      const double py  = dz * e2x[ i ] - dx * e2z[ i ];
+      const double pz  = dx * e2y[ i ] - dy * e2x[ i ];
+      const double det = e1x[ i ] * px + e1y[ i ] * py + e1z[ i ] * pz;
+      const double inv = 1.0 / det;
+      const double sx  = ox - v0x[ i ];
+      const double sy  = oy - v0y[ i ];
+      const double sz  = oz - v0z[ i ];
+      const double bu  = ( sx * px + sy * py + sz * pz ) * inv;
+      const double qx  = sy * e1z[ i ] - sz * e1y[ i ];
+      const double qy  = sz * e1x[ i ] - sx * e1z[ i ];
+      const double qz  = sx * e1y[ i ] - sy * e1x[ i ];
+      const double bv  = ( dx * qx + dy * qy + dz * qz ) * inv;
+      const double d   = ( e2x[ i ] * qx + e2y[ i ] * qy + e2z[ i ] * qz ) * inv;
+      const bool   hit = ( det > TRIANGLE_EPSILON || det < -TRIANGLE_EPSILON ) &&
+                        bu >= 0.0 && bv >= 0.0 && bu + bv <= 1.0 && d >= 0.0;
+
+      laneHit[ i ] = hit;
+      laneT[ i ]   = d;
+      laneU[ i ]   = bu;
+      laneV[ i ]   = bv;
+    }
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+      if ( laneHit[ i ] && laneT[ i ] < distance )
+      {
+        distance = laneT[ i ];
+        closest  = base + i;
+        u        = laneU[ i ];
+        v        = laneV[ i ];
+      }
+  }
+
+  if ( closest >= 0 ) t = distance;
+
+  return closest;
+}
+
+unsigned int
+Trianglesd::Intersect( const unsigned int triangle,
+                      const double* originX, const double* originY, const double* originZ,
+                      const double* directionX, const double* directionY, const double* directionZ,
+                      const unsigned int rays, double* t, double* u, double* v, int* hit ) const
+{
+  const double v0x = m_Values[ V0X ][ triangle ];
+  const double v0y = m_Values[ V0Y ][ triangle ];
+  const double v0z = m_Values[ V0Z ][ triangle ];
+  const double e1x = m_Values[ E1X ][ triangle ];
+  const double e1y = m_Values[ E1Y ][ triangle ];
+  const double e1z = m_Values[ E1Z ][ triangle ];
+  const double e2x = m_Values[ E2X ][ triangle ];
+  const double e2y = m_Values[ E2Y ][ triangle ];
+  const double e2z = m_Values[ E2Z ][ triangle ];
+  unsigned int updated = 0;
+
+  for ( unsigned int base = 0; base < rays; base += TRIANGLE_PACKET )
+  {
+    const unsigned int lanes = rays - base < TRIANGLE_PACKET ? rays - base : TRIANGLE_PACKET;
+    double             laneT[ TRIANGLE_PACKET ];
+    double             laneU[ TRIANGLE_PACKET ];
+    double             laneV[ TRIANGLE_PACKET ];
+    bool               laneHit[ TRIANGLE_PACKET ];
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const unsigned int r = base + i;
+
+      const double px  = directionY[ r ] * e2z - directionZ[ r ] * e2y;
+      const double py  = directionZ[ r ] * e2x - directionX[ r ] * e2z;
+      const double pz  = directionX[ r ] * e2y - directionY[ r ] * e2x;
+      const double det = e1x * px + e1y * py + e1z * pz;
+      const double inv = 1.0 / det;
+      const double sx  = originX[ r ] - v0x;
+      const double sy  = originY[ r ] - v0y;
+      const double sz  = originZ[ r ] - v0z;
+      const double bu  = ( sx * px + sy * py + sz * pz ) * inv;
+      const double qx  = sy * e1z - sz * e1y;
+      const double qy  = sz * e1x - sx * e1z;
+      const double qz  = sx * e1y - sy * e1x;
+      const double bv  = ( directionX[ r ] * qx + directionY[ r ] * qy + directionZ[ r ] * qz ) * inv;
+      const double d   = ( e2x * qx + e2y * qy + e2z * qz ) * inv;
+      const bool   ok  = ( det > TRIANGLE_EPSILON || det < -TRIANGLE_EPSILON ) &&
+                        bu >= 0.0 && bv >= 0.0 && bu + bv <= 1.0 && d >= 0.0;
+
+      laneHit[ i ] = ok;
+      laneT[ i ]   = d;
+      laneU[ i ]   = bu;
+      laneV[ i ]   = bv;
+    }
+
+    for ( unsigned int i = 0; i < lanes; i++ )
+    {
+      const unsigned int r = base + i;
+
+      if ( !laneHit[ i ] || laneT[ i ] >= t[ r ] ) continue;
+
+      t[ r ] = laneT[ i ];
+      u[ r ] = laneU[ i ];
+      v[ r ] = laneV[ i ];
+
+      if ( hit ) hit[ r ] = triangle;
+
+      updated++;
+    }
+  }
+
+  return updated;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
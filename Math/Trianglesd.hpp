@@ -0,0 +1,84 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Trianglesd.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_TRIANGLESD_HPP_
+#define MATH_TRIANGLESD_HPP_
+
+#include <vector>
+
+class Vec3d;
+
+/*
+ * GeekEngine::Trianglesd
+ *
+ * Triangle soup stored as structure of arrays ( first vertex and both edge
+ * vectors ) for Moeller-Trumbore ray intersection in packets.
+ *
+ * Intersect( ray ) tests one ray against all triangles, 8 per step, and
+ * returns the index of the closest hit or -1. Intersect( triangle, rays )
+ * tests a packet of rays given as structure of arrays against one
+ * triangle; t has to hold the current closest distance per ray and is
+ * only overwritten, together with u, v and hit, by closer hits. It returns
+ * how many rays were updated. Both take INFINITY as the distance without
+ * limit. u and v are the barycentrics of the hit relative to the second
+ * and third vertex.
+ */
+class Trianglesd
+{
+public:
+  Trianglesd( void );
+  Trianglesd( const Trianglesd& );
+  virtual
+  ~Trianglesd( void );
+
+  void
+  Add( const Vec3d& a, const Vec3d& b, const Vec3d& c );
+  void
+  Clear( void );
+  unsigned int
+  Count( void ) const;
+
+  int
+  Intersect( const Vec3d& origin, const Vec3d& direction, const double maxDistance,
+             double& t, double& u, double& v ) const;
+  unsigned int
+  Intersect( const unsigned int triangle,
+             const double* originX, const double* originY, const double* originZ,
+             const double* directionX, const double* directionY, const double* directionZ,
+             const unsigned int rays, double* t, double* u, double* v, int* hit ) const;
+
+protected:
+private:
+  enum Component
+  {
+    V0X, V0Y, V0Z,
+    E1X, E1Y, E1Z,
+    E2X, E2Y, E2Z,
+    COMPONENTS
+  };
+
+  std::vector< double > m_Values[ COMPONENTS ];
+
+};
+
+#endif /* MATH_TRIANGLESD_HPP_ */
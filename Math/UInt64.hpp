@@ -0,0 +1,50 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file UInt64.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_UINT64_HPP_
+#define MATH_UINT64_HPP_
+
+/*
+ * GeekEngine::GMUInt64
+ *
+ * The one 64 bit integer of the library. C++98 has none, so every public
+ * 64 bit value goes through this typedef: unsigned __int64 with MSVC and
+ * unsigned long long elsewhere, with the -Wlong-long warning of pedantic
+ * C++98 builds suppressed just for the typedef. GEEKMATH_UINT64 writes a
+ * constant from its two 32 bit halves as the ull suffix can not be
+ * silenced the same way.
+ */
+#if defined( _MSC_VER )
+  typedef unsigned __int64 GMUInt64;
+#elif defined( __GNUC__ )
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wlong-long"
+  typedef unsigned long long GMUInt64;
+  #pragma GCC diagnostic pop
+#else
+  typedef unsigned long long GMUInt64;
+#endif
+
+#define GEEKMATH_UINT64( high, low ) ( static_cast< GMUInt64 >( high ) << 32 | static_cast< GMUInt64 >( low ) )
+
+#endif /* MATH_UINT64_HPP_ */
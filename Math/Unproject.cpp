@@ -0,0 +1,179 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Unproject.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Unproject.hpp"
+
+#include "Vec3f.hpp"
+#include "Mat4f.hpp"
+#include "Ray3f.hpp"
+
+#include <cmath>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Unproject::Unproject( void )
+{
+  for ( unsigned int r = 0; r < 4; r++ )
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = r == c ? 1.0f : 0.0f;
+
+  Viewport( 0.0f, 0.0f, 1.0f, 1.0f );
+}
+
+Unproject::Unproject( const Unproject& other )
+{
+  for ( unsigned int r = 0; r < 4; r++ )
+  {
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = other.m_Inverse[ r ][ c ];
+
+    m_Viewport[ r ] = other.m_Viewport[ r ];
+  }
+}
+
+Unproject::Unproject( const Mat4f& viewProjection,
+                      const float x, const float y, const float width, const float height )
+{
+  ViewProjection( viewProjection );
+  Viewport( x, y, width, height );
+}
+
+Unproject::~Unproject( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Unproject::ViewProjection( const Mat4f& viewProjection )
+{
+  const Mat4f inverse = viewProjection.Inverse();
+
+  for ( unsigned int r = 0; r < 4; r++ )
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = inverse[ r ][ c ];
+}
+
+void
+Unproject::Viewport( const float x, const float y, const float width, const float height )
+{
+  m_Viewport[ 0 ] = x;
+  m_Viewport[ 1 ] = y;
+  m_Viewport[ 2 ] = width;
+  m_Viewport[ 3 ] = height;
+}
+
+Vec3f
+Unproject::Point( const float screenX, const float screenY, const float depth ) const
+{
+  const float ndcX = 2.0f * ( screenX - m_Viewport[ 0 ] ) / m_Viewport[ 2 ] - 1.0f;
+  const float ndcY = 1.0f - 2.0f * ( screenY - m_Viewport[ 1 ] ) / m_Viewport[ 3 ];
+  float       p[ 4 ];
+
+  for ( unsigned int r = 0; r < 4; r++ )
+    p[ r ] = m_Inverse[ r ][ 0 ] * ndcX + m_Inverse[ r ][ 1 ] * ndcY +
+             m_Inverse[ r ][ 2 ] * depth + m_Inverse[ r ][ 3 ];
+
+  return Vec3f( p[ 0 ] / p[ 3 ], p[ 1 ] / p[ 3 ], p[ 2 ] / p[ 3 ] );
+}
+
+Ray3f
+Unproject::Ray( const float screenX, const float screenY ) const
+{
+  const Vec3f near = Point( screenX, screenY, -1.0f );
+  const Vec3f mid  = Point( screenX, screenY,  0.0f );
+
+  return Ray3f( near, ( mid - near ).Normalize() );
+}
+
+void
+Unproject::Tile( const unsigned int x, const unsigned int y,
+                 const unsigned int width, const unsigned int height,
+                 float* originX, float* originY, float* originZ,
+                 float* directionX, float* directionY, float* directionZ ) const
+{
+  /*
+   * The unprojected homogeneous points are linear in the pixel position,
+   * so each row starts from a base point at both depths and only adds the
+   * first inverse column per pixel before the perspective divide. The
+   * second point is taken at depth 0, which stays finite for projections
+   * with an infinite far plane.
+   */
+  const float scaleX  = 2.0f / m_Viewport[ 2 ];
+  const float offsetX = ( x + 0.5f - m_Viewport[ 0 ] ) * scaleX - 1.0f;
+
+  for ( unsigned int j = 0; j < height; j++ )
+  {
+    const float        ndcY     = 1.0f - 2.0f * ( y + j + 0.5f - m_Viewport[ 1 ] ) / m_Viewport[ 3 ];
+    const float        row[ 4 ] = { m_Inverse[ 0 ][ 1 ] * ndcY + m_Inverse[ 0 ][ 3 ],
+                                    m_Inverse[ 1 ][ 1 ] * ndcY + m_Inverse[ 1 ][ 3 ],
+                                    m_Inverse[ 2 ][ 1 ] * ndcY + m_Inverse[ 2 ][ 3 ],
+                                    m_Inverse[ 3 ][ 1 ] * ndcY + m_Inverse[ 3 ][ 3 ] };
+    const unsigned int offset   = j * width;
+
+    for ( unsigned int i = 0; i < width; i++ )
+    {
+      const float ndcX = offsetX + i * scaleX;
+
+      const float nx = row[ 0 ] + m_Inverse[ 0 ][ 0 ] * ndcX - m_Inverse[ 0 ][ 2 ];
+      const float ny = row[ 1 ] + m_Inverse[ 1 ][ 0 ] * ndcX - m_Inverse[ 1 ][ 2 ];
+      const float nz = row[ 2 ] + m_Inverse[ 2 ][ 0 ] * ndcX - m_Inverse[ 2 ][ 2 ];
+      const float nw = row[ 3 ] + m_Inverse[ 3 ][ 0 ] * ndcX - m_Inverse[ 3 ][ 2 ];
+      const float mx = row[ 0 ] + m_Inverse[ 0 ][ 0 ] * ndcX;
+      const float my = row[ 1 ] + m_Inverse[ 1 ][ 0 ] * ndcX;
+      const float mz = row[ 2 ] + m_Inverse[ 2 ][ 0 ] * ndcX;
+      const float mw = row[ 3 ] + m_Inverse[ 3 ][ 0 ] * ndcX;
+
+      const float nearW = 1.0f / nw;
+      const float midW  = 1.0f / mw;
+      const float ox    = nx * nearW, oy = ny * nearW, oz = nz * nearW;
+      const float dx    = mx * midW - ox;
+      const float dy    = my * midW - oy;
+      const float dz    = mz * midW - oz;
+      const float scale = 1.0f / sqrtf( dx * dx + dy * dy + dz * dz );
+
+      originX[ offset + i ]    = ox;
+      originY[ offset + i ]    = oy;
+      originZ[ offset + i ]    = oz;
+      directionX[ offset + i ] = dx * scale;
+      directionY[ offset + i ] = dy * scale;
+      directionZ[ offset + i ] = dz * scale;
+    }
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
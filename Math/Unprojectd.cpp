@@ -0,0 +1,179 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Unprojectd.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Unprojectd.hpp"
+
+#include "Vec3d.hpp"
+#include "Mat4d.hpp"
+#include "Ray3d.hpp"
+
+#include <cmath>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Unprojectd::Unprojectd( void )
+{
+  for ( unsigned int r = 0; r < 4; r++ )
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = r == c ? 1.0 : 0.0;
+
+  Viewport( 0.0, 0.0, 1.0, 1.0 );
+}
+
+Unprojectd::Unprojectd( const Unprojectd& other )
+{
+  for ( unsigned int r = 0; r < 4; r++ )
+  {
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = other.m_Inverse[ r ][ c ];
+
+    m_Viewport[ r ] = other.m_Viewport[ r ];
+  }
+}
+
+Unprojectd::Unprojectd( const Mat4d& viewProjection,
+                      const double x, const double y, const double width, const double height )
+{
+  ViewProjection( viewProjection );
+  Viewport( x, y, width, height );
+}
+
+Unprojectd::~Unprojectd( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Unprojectd::ViewProjection( const Mat4d& viewProjection )
+{
+  const Mat4d inverse = viewProjection.Inverse();
+
+  for ( unsigned int r = 0; r < 4; r++ )
+    for ( unsigned int c = 0; c < 4; c++ )
+      m_Inverse[ r ][ c ] = inverse[ r ][ c ];
+}
+
+void
+Unprojectd::Viewport( const double x, const double y, const double width, const double height )
+{
+  m_Viewport[ 0 ] = x;
+  m_Viewport[ 1 ] = y;
+  m_Viewport[ 2 ] = width;
+  m_Viewport[ 3 ] = height;
+}
+
+Vec3d
+Unprojectd::Point( const double screenX, const double screenY, const double depth ) const
+{
+  const double ndcX = 2.0 * ( screenX - m_Viewport[ 0 ] ) / m_Viewport[ 2 ] - 1.0;
+  const double ndcY = 1.0 - 2.0 * ( screenY - m_Viewport[ 1 ] ) / m_Viewport[ 3 ];
+  double       p[ 4 ];
+
+  for ( unsigned int r = 0; r < 4; r++ )
+    p[ r ] = m_Inverse[ r ][ 0 ] * ndcX + m_Inverse[ r ][ 1 ] * ndcY +
+             m_Inverse[ r ][ 2 ] * depth + m_Inverse[ r ][ 3 ];
+
+  return Vec3d( p[ 0 ] / p[ 3 ], p[ 1 ] / p[ 3 ], p[ 2 ] / p[ 3 ] );
+}
+
+Ray3d
+Unprojectd::Ray( const double screenX, const double screenY ) const
+{
+  const Vec3d near = Point( screenX, screenY, -1.0 );
+  const Vec3d mid  = Point( screenX, screenY,  0.0 );
+
+  return Ray3d( near, ( mid - near ).Normalize() );
+}
+
+void
+Unprojectd::Tile( const unsigned int x, const unsigned int y,
+                 const unsigned int width, const unsigned int height,
+                 double* originX, double* originY, double* originZ,
+                 double* directionX, double* directionY, double* directionZ ) const
+{
+  /*
+   * The unprojected homogeneous points are linear in the pixel position,
+   * so each row starts from a base point at both depths and only adds the
+   * first inverse column per pixel before the perspective divide. The
+   * second point is taken at depth 0, which stays finite for projections
+   * with an infinite far plane.
+   */
+  const double scaleX  = 2.0 / m_Viewport[ 2 ];
+  const double offsetX = ( x + 0.5 - m_Viewport[ 0 ] ) * scaleX - 1.0;
+
+  for ( unsigned int j = 0; j < height; j++ )
+  {
+    const double       ndcY     = 1.0 - 2.0 * ( y + j + 0.5 - m_Viewport[ 1 ] ) / m_Viewport[ 3 ];
+    const double       row[ 4 ] = { m_Inverse[ 0 ][ 1 ] * ndcY + m_Inverse[ 0 ][ 3 ],
+                                   m_Inverse[ 1 ][ 1 ] * ndcY + m_Inverse[ 1 ][ 3 ],
+                                   m_Inverse[ 2 ][ 1 ] * ndcY + m_Inverse[ 2 ][ 3 ],
+                                   m_Inverse[ 3 ][ 1 ] * ndcY + m_Inverse[ 3 ][ 3 ] };
+    const unsigned int offset   = j * width;
+
+    for ( unsigned int i = 0; i < width; i++ )
+    {
+      const double ndcX = offsetX + i * scaleX;
+
+      const double nx = row[ 0 ] + m_Inverse[ 0 ][ 0 ] * ndcX - m_Inverse[ 0 ][ 2 ];
+      const double ny = row[ 1 ] + m_Inverse[ 1 ][ 0 ] * ndcX - m_Inverse[ 1 ][ 2 ];
+      const double nz = row[ 2 ] + m_Inverse[ 2 ][ 0 ] * ndcX - m_Inverse[ 2 ][ 2 ];
+      const double nw = row[ 3 ] + m_Inverse[ 3 ][ 0 ] * ndcX - m_Inverse[ 3 ][ 2 ];
+      const double mx = row[ 0 ] + m_Inverse[ 0 ][ 0 ] * ndcX;
+      const double my = row[ 1 ] + m_Inverse[ 1 ][ 0 ] * ndcX;
+      const double mz = row[ 2 ] + m_Inverse[ 2 ][ 0 ] * ndcX;
+      const double mw = row[ 3 ] + m_Inverse[ 3 ][ 0 ] * ndcX;
+
+      const double nearW = 1.0 / nw;
+      const double midW  = 1.0 / mw;
+      const double ox    = nx * nearW, oy = ny * nearW, oz = nz * nearW;
+      const double dx    = mx * midW - ox;
+      const double dy    = my * midW - oy;
+      const double dz    = mz * midW - oz;
+      const double scale = 1.0 / sqrt( dx * dx + dy * dy + dz * dz );
+
+      originX[ offset + i ]    = ox;
+      originY[ offset + i ]    = oy;
+      originZ[ offset + i ]    = oz;
+      directionX[ offset + i ] = dx * scale;
+      directionY[ offset + i ] = dy * scale;
+      directionZ[ offset + i ] = dz * scale;
+    }
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
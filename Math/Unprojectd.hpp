@@ -0,0 +1,80 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Unprojectd.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_UNPROJECTD_HPP_
+#define MATH_UNPROJECTD_HPP_
+
+class Vec3d;
+class Mat4d;
+class Ray3d;
+
+/*
+ * GeekEngine::Unprojectd
+ *
+ * Maps window coordinates back into world space. The inverse of the view
+ * projection matrix ( column vectors, clip = M * v ) is computed once when
+ * the matrix is set and reused for every point and ray.
+ *
+ * Window coordinates are in pixels relative to the viewport set with
+ * Viewport, x grows to the right and y downwards as for mouse positions.
+ * Depth is given in normalized device coordinates, -1 on the near and 1 on
+ * the far plane.
+ *
+ * Rays start on the near plane and have a normalized direction. Tile
+ * generates the rays through the centers of a width x height block of
+ * pixels, row by row, into structure of arrays outputs of width * height
+ * floats each.
+ */
+class Unprojectd
+{
+public:
+  Unprojectd( void );
+  Unprojectd( const Unprojectd& );
+  Unprojectd( const Mat4d& viewProjection,
+             const double x, const double y, const double width, const double height );
+  virtual
+  ~Unprojectd( void );
+
+  void
+  ViewProjection( const Mat4d& viewProjection );
+  void
+  Viewport( const double x, const double y, const double width, const double height );
+
+  Vec3d
+  Point( const double screenX, const double screenY, const double depth ) const;
+  Ray3d
+  Ray( const double screenX, const double screenY ) const;
+  void
+  Tile( const unsigned int x, const unsigned int y,
+        const unsigned int width, const unsigned int height,
+        double* originX, double* originY, double* originZ,
+        double* directionX, double* directionY, double* directionZ ) const;
+
+protected:
+private:
+  double m_Inverse[ 4 ][ 4 ];
+  double m_Viewport[ 4 ];
+
+};
+
+#endif /* MATH_UNPROJECTD_HPP_ */
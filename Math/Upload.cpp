@@ -0,0 +1,188 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Upload.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Upload.hpp"
+#include "Profile.hpp"
+
+#include "Mat4f.hpp"
+#include "Mat4d.hpp"
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINIMUM 4096
+
+#if defined( __SSE2__ )
+static inline void
+Rows( const Mat4f& matrix, __m128* rows )
+{
+  const float* m = matrix.Values();
+
+  for ( unsigned int row = 0; row < 4; row++ )
+    rows[ row ] = _mm_loadu_ps( m + row * 4 );
+}
+
+static inline void
+Rows( const Mat4d& matrix, __m128* rows )
+{
+  const double* m = matrix.Values();
+
+  for ( unsigned int row = 0; row < 4; row++ )
+    rows[ row ] = _mm_movelh_ps( _mm_cvtpd_ps( _mm_loadu_pd( m + row * 4 ) ),
+                                 _mm_cvtpd_ps( _mm_loadu_pd( m + row * 4 + 2 ) ) );
+}
+
+template< bool Stream >
+static inline void
+Store( float* destination, const __m128 value )
+{
+  if ( Stream )
+    _mm_stream_ps( destination, value );
+  else
+    _mm_storeu_ps( destination, value );
+}
+
+template< bool Stream, class Matrix >
+static inline void
+WriteMatrix( const Matrix& matrix, const unsigned int layout, float* destination )
+{
+  __m128 rows[ 4 ];
+
+  Rows( matrix, rows );
+
+  if ( layout == UPLOAD_COLUMN_MAJOR_4X4 || layout == UPLOAD_COLUMN_MAJOR_3X4 )
+    _MM_TRANSPOSE4_PS( rows[ 0 ], rows[ 1 ], rows[ 2 ], rows[ 3 ] );
+
+  if ( layout == UPLOAD_COLUMN_MAJOR_3X4 )
+  {
+    float packed[ 16 ];
+
+    /* each store overwrites the unused fourth value of the previous column */
+    for ( unsigned int col = 0; col < 4; col++ )
+      _mm_storeu_ps( packed + col * 3, rows[ col ] );
+
+    for ( unsigned int i = 0; i < 3; i++ )
+      Store< Stream >( destination + i * 4, _mm_loadu_ps( packed + i * 4 ) );
+
+    return;
+  }
+
+  const unsigned int count = layout == UPLOAD_ROW_MAJOR_3X4 ? 3 : 4;
+
+  for ( unsigned int row = 0; row < count; row++ )
+    Store< Stream >( destination + row * 4, rows[ row ] );
+}
+#else
+template< bool Stream, class Matrix >
+static inline void
+WriteMatrix( const Matrix& matrix, const unsigned int layout, float* destination )
+{
+  const bool         columns = layout == UPLOAD_COLUMN_MAJOR_4X4 || layout == UPLOAD_COLUMN_MAJOR_3X4;
+  const unsigned int count   = layout == UPLOAD_ROW_MAJOR_4X4 || layout == UPLOAD_COLUMN_MAJOR_4X4 ? 4 : 3;
+
+  for ( unsigned int row = 0; row < count; row++ )
+    for ( unsigned int col = 0; col < 4; col++ )
+    {
+      if ( columns )
+        destination[ col * count + row ] = (float)matrix[ row ][ col ];
+      else
+        destination[ row * 4 + col ] = (float)matrix[ row ][ col ];
+    }
+}
+#endif
+
+template< class Matrix >
+static void
+WriteAll( const Matrix* matrices, const unsigned int count, const unsigned int layout, float* destination )
+{
+  const unsigned int size    = Upload::Size( layout );
+  const bool         aligned = ( (unsigned long)destination & 15 ) == 0;
+
+#if defined( _OPENMP )
+  #pragma omp parallel if ( count > PARALLEL_MINIMUM )
+#endif
+  {
+#if defined( _OPENMP )
+    #pragma omp for
+#endif
+    for ( int i = 0; i < (int)count; i++ )
+    {
+      if ( aligned )
+        WriteMatrix< true >( matrices[ i ], layout, destination + i * size );
+      else
+        WriteMatrix< false >( matrices[ i ], layout, destination + i * size );
+    }
+
+#if defined( __SSE2__ )
+    /* streamed stores of this thread are visible before the writer returns */
+    _mm_sfence();
+#endif
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Upload::Upload( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+unsigned int
+Upload::Size( const unsigned int layout )
+{
+  return layout == UPLOAD_ROW_MAJOR_3X4 || layout == UPLOAD_COLUMN_MAJOR_3X4 ? 12 : 16;
+}
+
+void
+Upload::Write( const Mat4f* matrices, const unsigned int count, const unsigned int layout, float* destination )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_UPLOAD_WRITE, count );
+
+  WriteAll( matrices, count, layout, destination );
+}
+
+void
+Upload::Write( const Mat4d* matrices, const unsigned int count, const unsigned int layout, float* destination )
+{
+  GEEKMATH_PROFILE_SCOPE( PROFILE_UPLOAD_WRITE, count );
+
+  WriteAll( matrices, count, layout, destination );
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
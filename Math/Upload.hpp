@@ -0,0 +1,71 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Upload.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_UPLOAD_HPP_
+#define MATH_UPLOAD_HPP_
+
+class Mat4f;
+class Mat4d;
+
+enum UploadLayout
+{
+  UPLOAD_ROW_MAJOR_4X4    = 0,
+  UPLOAD_COLUMN_MAJOR_4X4 = 1,
+  UPLOAD_ROW_MAJOR_3X4    = 2,
+  UPLOAD_COLUMN_MAJOR_3X4 = 3
+};
+
+/*
+ * GeekEngine::Upload
+ *
+ * Writes arrays of Mat4f or Mat4d into a float buffer in the layout the
+ * graphics API expects, in a single pass without intermediate matrices.
+ * The 4x4 layouts store all 16 values in row or column major order. The
+ * 3x4 layouts drop the last row, which is ( 0, 0, 0, 1 ) for affine
+ * matrices: row major writes the first three rows like EyeRelative, column
+ * major writes the four columns as three floats each. Size gives the
+ * floats written per matrix. Doubles are rounded to nearest even.
+ *
+ * Destinations aligned to 16 bytes are written with non-temporal SSE2
+ * stores that bypass the cache, meant for mapped or staging buffers the
+ * CPU does not read back. Other destinations use ordinary stores. The
+ * writers run in parallel when compiled with OpenMP.
+ */
+class Upload
+{
+public:
+  static unsigned int
+  Size( const unsigned int layout );
+
+  static void
+  Write( const Mat4f* matrices, const unsigned int count, const unsigned int layout, float* destination );
+  static void
+  Write( const Mat4d* matrices, const unsigned int count, const unsigned int layout, float* destination );
+
+protected:
+private:
+  Upload( void );
+
+};
+
+#endif /* MATH_UPLOAD_HPP_ */
@@ -21,6 +21,7 @@ Created on: Feb 18, 2015
 \author     fkzey
 */
 #include "Vec2d.hpp"
+#include "Vec2f.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -44,6 +45,12 @@ Vec2d::Vec2d( const Vec2d& other )
   m_Values[ 1 ] = other.m_Values[ 1 ];
 }
 
+Vec2d::Vec2d( const Vec2f& vector )
+{
+  m_Values[ 0 ] = vector[ 0 ];
+  m_Values[ 1 ] = vector[ 1 ];
+}
+
 Vec2d::Vec2d( const double x, const double y )
 {
   m_Values[ 0 ] = x;
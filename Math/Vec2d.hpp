@@ -23,12 +23,16 @@ Created on: Feb 18, 2015
 #ifndef VEC2D_H_
 #define VEC2D_H_
 
+class Vec2f;
+
 class Vec2d
 {
 public:
   Vec2d( void );
   Vec2d( const double value );
   Vec2d( const Vec2d& Vec2d );
+  explicit
+  Vec2d( const Vec2f& vector );
   Vec2d( const double x, const double y );
   virtual
   ~Vec2d( void );
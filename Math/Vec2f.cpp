@@ -21,6 +21,7 @@ Created on: Feb 18, 2015
 \author     fkzey
 */
 #include "Vec2f.hpp"
+#include "Vec2d.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -44,6 +45,12 @@ Vec2f::Vec2f( const Vec2f& other )
   m_Values[ 1 ] = other.m_Values[ 1 ];
 }
 
+Vec2f::Vec2f( const Vec2d& vector )
+{
+  m_Values[ 0 ] = (float)vector[ 0 ];
+  m_Values[ 1 ] = (float)vector[ 1 ];
+}
+
 Vec2f::Vec2f( const float x, const float y )
 {
   m_Values[ 0 ] = x;
@@ -23,12 +23,16 @@ Created on: Feb 18, 2015
 #ifndef VEC2F_H_
 #define VEC2F_H_
 
+class Vec2d;
+
 class Vec2f
 {
 public:
   Vec2f( void );
   Vec2f( const float value );
   Vec2f( const Vec2f& vec2f );
+  explicit
+  Vec2f( const Vec2d& vector );
   Vec2f( const float x, const float y );
   virtual
   ~Vec2f( void );
@@ -0,0 +1,144 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec2h.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec2h.hpp"
+
+#include "Vec2f.hpp"
+#include "Precision.hpp"
+
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec2h::Vec2h( void )
+{
+  m_Values[ 0 ] = 0;
+  m_Values[ 1 ] = 0;
+}
+
+Vec2h::Vec2h( const Vec2h& vector )
+{
+  m_Values[ 0 ] = vector.m_Values[ 0 ];
+  m_Values[ 1 ] = vector.m_Values[ 1 ];
+}
+
+Vec2h::Vec2h( const Vec2f& vector )
+{
+  Set( vector );
+}
+
+Vec2h::Vec2h( const float x, const float y )
+{
+  Set( x, y );
+}
+
+Vec2h::~Vec2h( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Vec2h::Set( const float x, const float y )
+{
+  m_Values[ 0 ] = Precision::Half( x );
+  m_Values[ 1 ] = Precision::Half( y );
+}
+
+void
+Vec2h::Set( const Vec2f& vector )
+{
+  m_Values[ 0 ] = Precision::Half( vector[ 0 ] );
+  m_Values[ 1 ] = Precision::Half( vector[ 1 ] );
+}
+
+Vec2f
+Vec2h::Get( void ) const
+{
+  return Vec2f( X(), Y() );
+}
+
+float
+Vec2h::X( void ) const
+{
+  return Precision::Single( m_Values[ 0 ] );
+}
+
+float
+Vec2h::Y( void ) const
+{
+  return Precision::Single( m_Values[ 1 ] );
+}
+
+bool
+Vec2h::operator ==( const Vec2h& expr ) const
+{
+  return  m_Values[ 0 ] == expr.m_Values[ 0 ] &&
+          m_Values[ 1 ] == expr.m_Values[ 1 ];
+}
+
+bool
+Vec2h::operator !=( const Vec2h& expr ) const
+{
+  return !( *this == expr );
+}
+
+unsigned short&
+Vec2h::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+unsigned short
+Vec2h::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Vec2h::Print( void ) const
+{
+  printf( "( %f | %f )\n", Precision::Single( m_Values[ 0 ] ), Precision::Single( m_Values[ 1 ] ) );
+}
+
+const unsigned short*
+Vec2h::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -28,6 +28,7 @@ Created on: Feb 18, 2015
 
 #include "Quaterniond.hpp"
 #include "Vec2d.hpp"
+#include "Vec3f.hpp"
 
 Vec3d::Vec3d( void )
 {
@@ -50,6 +51,13 @@ Vec3d::Vec3d( const Vec3d& other )
   m_Values[ 2 ] = other.m_Values[ 2 ];
 }
 
+Vec3d::Vec3d( const Vec3f& vector )
+{
+  m_Values[ 0 ] = vector[ 0 ];
+  m_Values[ 1 ] = vector[ 1 ];
+  m_Values[ 2 ] = vector[ 2 ];
+}
+
 Vec3d::Vec3d( const double x, const double y, const double z )
 {
   m_Values[ 0 ] = x;
@@ -25,6 +25,7 @@ Created on: Feb 18, 2015
 
 class Vec2d;
 class Quaterniond;
+class Vec3f;
 
 class Vec3d
 {
@@ -32,6 +33,8 @@ public:
   Vec3d( void );
   Vec3d( const double value );
   Vec3d( const Vec3d& );
+  explicit
+  Vec3d( const Vec3f& vector );
   Vec3d( const double x, const double y, const double z );
   virtual
   ~Vec3d( void );
@@ -21,6 +21,7 @@ Created on: Feb 18, 2015
 \author     fkzey
 */
 #include "Vec3f.hpp"
+#include "Profile.hpp"
 
 #include <cmath>
 #include <cstdio>
@@ -28,6 +29,7 @@ Created on: Feb 18, 2015
 
 #include "Quaternion.hpp"
 #include "Vec2f.hpp"
+#include "Vec3d.hpp"
 
 Vec3f::Vec3f( void )
 {
@@ -45,11 +47,20 @@ Vec3f::Vec3f( const float value )
 
 Vec3f::Vec3f( const Vec3f& other )
 {
+  GEEKMATH_PROFILE_SCOPE( PROFILE_VEC3F_COPY, 1 );
+
   m_Values[ 0 ] = other.m_Values[ 0 ];
   m_Values[ 1 ] = other.m_Values[ 1 ];
   m_Values[ 2 ] = other.m_Values[ 2 ];
 }
 
+Vec3f::Vec3f( const Vec3d& vector )
+{
+  m_Values[ 0 ] = (float)vector[ 0 ];
+  m_Values[ 1 ] = (float)vector[ 1 ];
+  m_Values[ 2 ] = (float)vector[ 2 ];
+}
+
 Vec3f::Vec3f( const float x, const float y, const float z )
 {
   m_Values[ 0 ] = x;
@@ -25,6 +25,7 @@ Created on: Feb 18, 2015
 
 class Vec2f;
 class Quaternion;
+class Vec3d;
 
 class Vec3f
 {
@@ -32,6 +33,8 @@ public:
   Vec3f( void );
   Vec3f( const float value );
   Vec3f( const Vec3f& Vec3f );
+  explicit
+  Vec3f( const Vec3d& vector );
   Vec3f( const float x, const float y, const float z );
   virtual
   ~Vec3f( void );
@@ -0,0 +1,474 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3fConstRef.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec3fConstRef.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Vec3fRef.hpp"
+#include "Quaternion.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec3fConstRef::Vec3fConstRef( const float* values ) :
+  m_Values( values )
+{
+  return;
+}
+
+Vec3fConstRef::Vec3fConstRef( const Vec3fConstRef& reference ) :
+  m_Values( reference.m_Values )
+{
+  return;
+}
+
+Vec3fConstRef::Vec3fConstRef( const Vec3fRef& reference ) :
+  m_Values( reference.Values() )
+{
+  return;
+}
+
+Vec3fConstRef::~Vec3fConstRef( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec3f
+Vec3fConstRef::Get( void ) const
+{
+  return Vec3f( m_Values[ 0 ], m_Values[ 1 ], m_Values[ 2 ] );
+}
+
+float
+Vec3fConstRef::LengthSq( void ) const
+{
+  return Dot( Get() );
+}
+
+float
+Vec3fConstRef::Length( void ) const
+{
+  return sqrtf( LengthSq() );
+}
+
+float
+Vec3fConstRef::Dot( const Vec3f& other ) const
+{
+  return  m_Values[ 0 ] * other[ 0 ] +
+          m_Values[ 1 ] * other[ 1 ] +
+          m_Values[ 2 ] * other[ 2 ];
+}
+
+float
+Vec3fConstRef::Max( void ) const
+{
+  return Get().Max();
+}
+
+float
+Vec3fConstRef::Min( void ) const
+{
+  return Get().Min();
+}
+
+Vec3f
+Vec3fConstRef::Clamp( const Vec3f& Min, const Vec3f& Max ) const
+{
+  return Get().Clamp( Min, Max );
+}
+
+Vec3f
+Vec3fConstRef::Normalize( void ) const
+{
+  return Get() / Length();
+}
+
+Vec3f
+Vec3fConstRef::Reflect( const Vec3f& normal ) const
+{
+  return Get().Reflect( normal );
+}
+
+Vec3f
+Vec3fConstRef::Rotate( const Quaternion& quaternion ) const
+{
+  return Get().Rotate( quaternion );
+}
+
+Vec3f
+Vec3fConstRef::Rotate( const Vec3f& Axis, const float Angle ) const
+{
+  return Get().Rotate( Axis, Angle );
+}
+
+Vec3f
+Vec3fConstRef::Cross( const Vec3f& vector ) const
+{
+  return Get().Cross( vector );
+}
+
+Vec3f
+Vec3fConstRef::Lerp( const Vec3f& Destination, float LerpFactor ) const
+{
+  return Get().Lerp( Destination, LerpFactor );
+}
+
+Vec3f
+Vec3fConstRef::Max( const Vec3f& vector ) const
+{
+  return Get().Max( vector );
+}
+
+Vec3f
+Vec3fConstRef::Min( const Vec3f& vector ) const
+{
+  return Get().Min( vector );
+}
+
+Vec3f
+Vec3fConstRef::operator +( const float summand ) const
+{
+  return Get() + summand;
+}
+
+Vec3f
+Vec3fConstRef::operator +( const Vec3f& summand ) const
+{
+  return Get() + summand;
+}
+
+Vec3f
+Vec3fConstRef::operator -( const float subtrahend ) const
+{
+  return Get() - subtrahend;
+}
+
+Vec3f
+Vec3fConstRef::operator -( const Vec3f& subtrahend ) const
+{
+  return Get() - subtrahend;
+}
+
+Vec3f
+Vec3fConstRef::operator *( const float factor ) const
+{
+  return Get() * factor;
+}
+
+Vec3f
+Vec3fConstRef::operator *( const Vec3f& factor ) const
+{
+  return Get() * factor;
+}
+
+Vec3f
+Vec3fConstRef::operator /( const float dividend ) const
+{
+  return Get() / dividend;
+}
+
+bool
+Vec3fConstRef::operator ==( const Vec3f& expr ) const
+{
+  return  m_Values[ 0 ] == expr[ 0 ] &&
+          m_Values[ 1 ] == expr[ 1 ] &&
+          m_Values[ 2 ] == expr[ 2 ];
+}
+
+bool
+Vec3fConstRef::operator !=( const Vec3f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float
+Vec3fConstRef::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+float
+Vec3fConstRef::X( void ) const
+{
+  return m_Values[ 0 ];
+}
+
+float
+Vec3fConstRef::Y( void ) const
+{
+  return m_Values[ 1 ];
+}
+
+float
+Vec3fConstRef::Z( void ) const
+{
+  return m_Values[ 2 ];
+}
+
+Vec2f
+Vec3fConstRef::XX( void ) const
+{
+  return Get().XX();
+}
+
+Vec2f
+Vec3fConstRef::XY( void ) const
+{
+  return Get().XY();
+}
+
+Vec2f
+Vec3fConstRef::XZ( void ) const
+{
+  return Get().XZ();
+}
+
+Vec2f
+Vec3fConstRef::YX( void ) const
+{
+  return Get().YX();
+}
+
+Vec2f
+Vec3fConstRef::YY( void ) const
+{
+  return Get().YY();
+}
+
+Vec2f
+Vec3fConstRef::YZ( void ) const
+{
+  return Get().YZ();
+}
+
+Vec2f
+Vec3fConstRef::ZX( void ) const
+{
+  return Get().ZX();
+}
+
+Vec2f
+Vec3fConstRef::ZY( void ) const
+{
+  return Get().ZY();
+}
+
+Vec2f
+Vec3fConstRef::ZZ( void ) const
+{
+  return Get().ZZ();
+}
+
+Vec3f
+Vec3fConstRef::XXX( void ) const
+{
+  return Get().XXX();
+}
+
+Vec3f
+Vec3fConstRef::XXY( void ) const
+{
+  return Get().XXY();
+}
+
+Vec3f
+Vec3fConstRef::XXZ( void ) const
+{
+  return Get().XXZ();
+}
+
+Vec3f
+Vec3fConstRef::XYX( void ) const
+{
+  return Get().XYX();
+}
+
+Vec3f
+Vec3fConstRef::XYY( void ) const
+{
+  return Get().XYY();
+}
+
+Vec3f
+Vec3fConstRef::XYZ( void ) const
+{
+  return Get().XYZ();
+}
+
+Vec3f
+Vec3fConstRef::XZX( void ) const
+{
+  return Get().XZX();
+}
+
+Vec3f
+Vec3fConstRef::XZY( void ) const
+{
+  return Get().XZY();
+}
+
+Vec3f
+Vec3fConstRef::XZZ( void ) const
+{
+  return Get().XZZ();
+}
+
+Vec3f
+Vec3fConstRef::YXX( void ) const
+{
+  return Get().YXX();
+}
+
+Vec3f
+Vec3fConstRef::YXY( void ) const
+{
+  return Get().YXY();
+}
+
+Vec3f
+Vec3fConstRef::YXZ( void ) const
+{
+  return Get().YXZ();
+}
+
+Vec3f
+Vec3fConstRef::YYX( void ) const
+{
+  return Get().YYX();
+}
+
+Vec3f
+Vec3fConstRef::YYY( void ) const
+{
+  return Get().YYY();
+}
+
+Vec3f
+Vec3fConstRef::YYZ( void ) const
+{
+  return Get().YYZ();
+}
+
+Vec3f
+Vec3fConstRef::YZX( void ) const
+{
+  return Get().YZX();
+}
+
+Vec3f
+Vec3fConstRef::YZY( void ) const
+{
+  return Get().YZY();
+}
+
+Vec3f
+Vec3fConstRef::YZZ( void ) const
+{
+  return Get().YZZ();
+}
+
+Vec3f
+Vec3fConstRef::ZXX( void ) const
+{
+  return Get().ZXX();
+}
+
+Vec3f
+Vec3fConstRef::ZXY( void ) const
+{
+  return Get().ZXY();
+}
+
+Vec3f
+Vec3fConstRef::ZXZ( void ) const
+{
+  return Get().ZXZ();
+}
+
+Vec3f
+Vec3fConstRef::ZYX( void ) const
+{
+  return Get().ZYX();
+}
+
+Vec3f
+Vec3fConstRef::ZYY( void ) const
+{
+  return Get().ZYY();
+}
+
+Vec3f
+Vec3fConstRef::ZYZ( void ) const
+{
+  return Get().ZYZ();
+}
+
+Vec3f
+Vec3fConstRef::ZZX( void ) const
+{
+  return Get().ZZX();
+}
+
+Vec3f
+Vec3fConstRef::ZZY( void ) const
+{
+  return Get().ZZY();
+}
+
+Vec3f
+Vec3fConstRef::ZZZ( void ) const
+{
+  return Get().ZZZ();
+}
+
+void
+Vec3fConstRef::Print( void ) const
+{
+  printf( "( %f | %f | %f )\n", m_Values[ 0 ], m_Values[ 1 ], m_Values[ 2 ] );
+}
+
+const float*
+Vec3fConstRef::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,202 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3fConstRef.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_VEC3FCONSTREF_HPP_
+#define MATH_VEC3FCONSTREF_HPP_
+
+class Vec2f;
+class Vec3f;
+class Vec3fRef;
+class Quaternion;
+
+/*
+ * GeekEngine::Vec3fConstRef
+ *
+ * Read only Vec3fRef over three consecutive floats owned by the caller,
+ * e.g. a vertex in a read only memory mapping. It offers every operation
+ * of Vec3f that leaves the vector unchanged and can not be assigned to.
+ * A Vec3fRef converts to it implicitly.
+ */
+class Vec3fConstRef
+{
+public:
+  explicit
+  Vec3fConstRef( const float* values );
+  Vec3fConstRef( const Vec3fConstRef& reference );
+  Vec3fConstRef( const Vec3fRef& reference );
+  virtual
+  ~Vec3fConstRef( void );
+
+  Vec3f
+  Get( void ) const;
+
+  float
+  LengthSq( void ) const;
+  float
+  Length( void ) const;
+  float
+  Dot( const Vec3f& other ) const;
+  float
+  Max( void ) const;
+  float
+  Min( void ) const;
+
+  Vec3f
+  Clamp( const Vec3f& Min, const Vec3f& Max ) const;
+  Vec3f
+  Normalize( void ) const;
+  Vec3f
+  Reflect( const Vec3f& normal ) const;
+  Vec3f
+  Rotate( const Quaternion& quaternion ) const;
+  Vec3f
+  Rotate( const Vec3f& Axis, const float Angle ) const;
+  Vec3f
+  Cross( const Vec3f& vector ) const;
+  Vec3f
+  Lerp( const Vec3f& Destination, float LerpFactor ) const;
+  Vec3f
+  Max( const Vec3f& vector ) const;
+  Vec3f
+  Min( const Vec3f& vector ) const;
+
+  Vec3f
+  operator +( const float summand ) const;
+  Vec3f
+  operator +( const Vec3f& summand ) const;
+  Vec3f
+  operator -( const float subtrahend ) const;
+  Vec3f
+  operator -( const Vec3f& subtrahend ) const;
+  Vec3f
+  operator *( const float factor ) const;
+  Vec3f
+  operator *( const Vec3f& factor ) const;
+  Vec3f
+  operator /( const float dividend ) const;
+
+  bool
+  operator ==( const Vec3f& expr ) const;
+  bool
+  operator !=( const Vec3f& expr ) const;
+
+  float
+  operator []( unsigned int i ) const;
+
+  float
+  X( void ) const;
+  float
+  Y( void ) const;
+  float
+  Z( void ) const;
+
+  Vec2f
+  XX( void ) const;
+  Vec2f
+  XY( void ) const;
+  Vec2f
+  XZ( void ) const;
+  Vec2f
+  YX( void ) const;
+  Vec2f
+  YY( void ) const;
+  Vec2f
+  YZ( void ) const;
+  Vec2f
+  ZX( void ) const;
+  Vec2f
+  ZY( void ) const;
+  Vec2f
+  ZZ( void ) const;
+
+  Vec3f
+  XXX( void ) const;
+  Vec3f
+  XXY( void ) const;
+  Vec3f
+  XXZ( void ) const;
+  Vec3f
+  XYX( void ) const;
+  Vec3f
+  XYY( void ) const;
+  Vec3f
+  XYZ( void ) const;
+  Vec3f
+  XZX( void ) const;
+  Vec3f
+  XZY( void ) const;
+  Vec3f
+  XZZ( void ) const;
+  Vec3f
+  YXX( void ) const;
+  Vec3f
+  YXY( void ) const;
+  Vec3f
+  YXZ( void ) const;
+  Vec3f
+  YYX( void ) const;
+  Vec3f
+  YYY( void ) const;
+  Vec3f
+  YYZ( void ) const;
+  Vec3f
+  YZX( void ) const;
+  Vec3f
+  YZY( void ) const;
+  Vec3f
+  YZZ( void ) const;
+  Vec3f
+  ZXX( void ) const;
+  Vec3f
+  ZXY( void ) const;
+  Vec3f
+  ZXZ( void ) const;
+  Vec3f
+  ZYX( void ) const;
+  Vec3f
+  ZYY( void ) const;
+  Vec3f
+  ZYZ( void ) const;
+  Vec3f
+  ZZX( void ) const;
+  Vec3f
+  ZZY( void ) const;
+  Vec3f
+  ZZZ( void ) const;
+
+  void
+  Print( void ) const;
+
+  const float*
+  Values( void ) const;
+
+protected:
+private:
+  Vec3fConstRef&
+  operator =( const Vec3fConstRef& );
+
+  const float* m_Values;
+
+};
+
+#endif /* MATH_VEC3FCONSTREF_HPP_ */
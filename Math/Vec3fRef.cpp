@@ -0,0 +1,593 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3fRef.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec3fRef.hpp"
+
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+#include "Quaternion.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec3fRef::Vec3fRef( float* values ) :
+  m_Values( values )
+{
+  return;
+}
+
+Vec3fRef::Vec3fRef( const Vec3fRef& reference ) :
+  m_Values( reference.m_Values )
+{
+  return;
+}
+
+Vec3fRef::~Vec3fRef( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec3fRef&
+Vec3fRef::operator =( const Vec3fRef& vector )
+{
+  Set( vector.m_Values[ 0 ], vector.m_Values[ 1 ], vector.m_Values[ 2 ] );
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator =( const Vec3f& vector )
+{
+  Set( vector );
+
+  return *this;
+}
+
+void
+Vec3fRef::Set( const float& x, const float& y, const float& z )
+{
+  m_Values[ 0 ] = x;
+  m_Values[ 1 ] = y;
+  m_Values[ 2 ] = z;
+}
+
+void
+Vec3fRef::Set( const Vec3f& vector )
+{
+  Set( vector[ 0 ], vector[ 1 ], vector[ 2 ] );
+}
+
+Vec3f
+Vec3fRef::Get( void ) const
+{
+  return Vec3f( m_Values[ 0 ], m_Values[ 1 ], m_Values[ 2 ] );
+}
+
+void
+Vec3fRef::X( const float& x )
+{
+  m_Values[ 0 ] = x;
+}
+
+void
+Vec3fRef::Y( const float& y )
+{
+  m_Values[ 1 ] = y;
+}
+
+void
+Vec3fRef::Z( const float& z )
+{
+  m_Values[ 2 ] = z;
+}
+
+float
+Vec3fRef::LengthSq( void ) const
+{
+  return Dot( Get() );
+}
+
+float
+Vec3fRef::Length( void ) const
+{
+  return sqrtf( LengthSq() );
+}
+
+float
+Vec3fRef::Dot( const Vec3f& other ) const
+{
+  return  m_Values[ 0 ] * other[ 0 ] +
+          m_Values[ 1 ] * other[ 1 ] +
+          m_Values[ 2 ] * other[ 2 ];
+}
+
+float
+Vec3fRef::Max( void ) const
+{
+  return Get().Max();
+}
+
+float
+Vec3fRef::Min( void ) const
+{
+  return Get().Min();
+}
+
+Vec3f
+Vec3fRef::Clamp( const Vec3f& Min, const Vec3f& Max ) const
+{
+  return Get().Clamp( Min, Max );
+}
+
+Vec3f
+Vec3fRef::Normalize( void ) const
+{
+  return Get() / Length();
+}
+
+Vec3f
+Vec3fRef::Reflect( const Vec3f& normal ) const
+{
+  return Get().Reflect( normal );
+}
+
+Vec3f
+Vec3fRef::Rotate( const Quaternion& quaternion ) const
+{
+  return Get().Rotate( quaternion );
+}
+
+Vec3f
+Vec3fRef::Rotate( const Vec3f& Axis, const float Angle ) const
+{
+  return Get().Rotate( Axis, Angle );
+}
+
+Vec3f
+Vec3fRef::Cross( const Vec3f& vector ) const
+{
+  return Get().Cross( vector );
+}
+
+Vec3f
+Vec3fRef::Lerp( const Vec3f& Destination, float LerpFactor ) const
+{
+  return Get().Lerp( Destination, LerpFactor );
+}
+
+Vec3f
+Vec3fRef::Max( const Vec3f& vector ) const
+{
+  return Get().Max( vector );
+}
+
+Vec3f
+Vec3fRef::Min( const Vec3f& vector ) const
+{
+  return Get().Min( vector );
+}
+
+Vec3f
+Vec3fRef::operator +( const float summand ) const
+{
+  return Get() + summand;
+}
+
+Vec3f
+Vec3fRef::operator +( const Vec3f& summand ) const
+{
+  return Get() + summand;
+}
+
+Vec3f
+Vec3fRef::operator -( const float subtrahend ) const
+{
+  return Get() - subtrahend;
+}
+
+Vec3f
+Vec3fRef::operator -( const Vec3f& subtrahend ) const
+{
+  return Get() - subtrahend;
+}
+
+Vec3f
+Vec3fRef::operator *( const float factor ) const
+{
+  return Get() * factor;
+}
+
+Vec3f
+Vec3fRef::operator *( const Vec3f& factor ) const
+{
+  return Get() * factor;
+}
+
+Vec3f
+Vec3fRef::operator /( const float dividend ) const
+{
+  return Get() / dividend;
+}
+
+Vec3fRef&
+Vec3fRef::operator +=( const Vec3f& summand )
+{
+  m_Values[ 0 ] += summand[ 0 ];
+  m_Values[ 1 ] += summand[ 1 ];
+  m_Values[ 2 ] += summand[ 2 ];
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator +=( const float summand )
+{
+  m_Values[ 0 ] += summand;
+  m_Values[ 1 ] += summand;
+  m_Values[ 2 ] += summand;
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator -=( const Vec3f& subtrahend )
+{
+  m_Values[ 0 ] -= subtrahend[ 0 ];
+  m_Values[ 1 ] -= subtrahend[ 1 ];
+  m_Values[ 2 ] -= subtrahend[ 2 ];
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator -=( const float subtrahend )
+{
+  m_Values[ 0 ] -= subtrahend;
+  m_Values[ 1 ] -= subtrahend;
+  m_Values[ 2 ] -= subtrahend;
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator *=( const float factor )
+{
+  m_Values[ 0 ] *= factor;
+  m_Values[ 1 ] *= factor;
+  m_Values[ 2 ] *= factor;
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator *=( const Vec3f& factor )
+{
+  m_Values[ 0 ] *= factor[ 0 ];
+  m_Values[ 1 ] *= factor[ 1 ];
+  m_Values[ 2 ] *= factor[ 2 ];
+
+  return *this;
+}
+
+Vec3fRef&
+Vec3fRef::operator /=( const float dividend )
+{
+  if ( dividend == 0.0f ) return *this;
+
+  m_Values[ 0 ] /= dividend;
+  m_Values[ 1 ] /= dividend;
+  m_Values[ 2 ] /= dividend;
+
+  return *this;
+}
+
+bool
+Vec3fRef::operator ==( const Vec3f& expr ) const
+{
+  return  m_Values[ 0 ] == expr[ 0 ] &&
+          m_Values[ 1 ] == expr[ 1 ] &&
+          m_Values[ 2 ] == expr[ 2 ];
+}
+
+bool
+Vec3fRef::operator !=( const Vec3f& expr ) const
+{
+  return !( *this == expr );
+}
+
+float&
+Vec3fRef::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+float
+Vec3fRef::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+float
+Vec3fRef::X( void ) const
+{
+  return m_Values[ 0 ];
+}
+
+float
+Vec3fRef::Y( void ) const
+{
+  return m_Values[ 1 ];
+}
+
+float
+Vec3fRef::Z( void ) const
+{
+  return m_Values[ 2 ];
+}
+
+Vec2f
+Vec3fRef::XX( void ) const
+{
+  return Get().XX();
+}
+
+Vec2f
+Vec3fRef::XY( void ) const
+{
+  return Get().XY();
+}
+
+Vec2f
+Vec3fRef::XZ( void ) const
+{
+  return Get().XZ();
+}
+
+Vec2f
+Vec3fRef::YX( void ) const
+{
+  return Get().YX();
+}
+
+Vec2f
+Vec3fRef::YY( void ) const
+{
+  return Get().YY();
+}
+
+Vec2f
+Vec3fRef::YZ( void ) const
+{
+  return Get().YZ();
+}
+
+Vec2f
+Vec3fRef::ZX( void ) const
+{
+  return Get().ZX();
+}
+
+Vec2f
+Vec3fRef::ZY( void ) const
+{
+  return Get().ZY();
+}
+
+Vec2f
+Vec3fRef::ZZ( void ) const
+{
+  return Get().ZZ();
+}
+
+Vec3f
+Vec3fRef::XXX( void ) const
+{
+  return Get().XXX();
+}
+
+Vec3f
+Vec3fRef::XXY( void ) const
+{
+  return Get().XXY();
+}
+
+Vec3f
+Vec3fRef::XXZ( void ) const
+{
+  return Get().XXZ();
+}
+
+Vec3f
+Vec3fRef::XYX( void ) const
+{
+  return Get().XYX();
+}
+
+Vec3f
+Vec3fRef::XYY( void ) const
+{
+  return Get().XYY();
+}
+
+Vec3f
+Vec3fRef::XYZ( void ) const
+{
+  return Get().XYZ();
+}
+
+Vec3f
+Vec3fRef::XZX( void ) const
+{
+  return Get().XZX();
+}
+
+Vec3f
+Vec3fRef::XZY( void ) const
+{
+  return Get().XZY();
+}
+
+Vec3f
+Vec3fRef::XZZ( void ) const
+{
+  return Get().XZZ();
+}
+
+Vec3f
+Vec3fRef::YXX( void ) const
+{
+  return Get().YXX();
+}
+
+Vec3f
+Vec3fRef::YXY( void ) const
+{
+  return Get().YXY();
+}
+
+Vec3f
+Vec3fRef::YXZ( void ) const
+{
+  return Get().YXZ();
+}
+
+Vec3f
+Vec3fRef::YYX( void ) const
+{
+  return Get().YYX();
+}
+
+Vec3f
+Vec3fRef::YYY( void ) const
+{
+  return Get().YYY();
+}
+
+Vec3f
+Vec3fRef::YYZ( void ) const
+{
+  return Get().YYZ();
+}
+
+Vec3f
+Vec3fRef::YZX( void ) const
+{
+  return Get().YZX();
+}
+
+Vec3f
+Vec3fRef::YZY( void ) const
+{
+  return Get().YZY();
+}
+
+Vec3f
+Vec3fRef::YZZ( void ) const
+{
+  return Get().YZZ();
+}
+
+Vec3f
+Vec3fRef::ZXX( void ) const
+{
+  return Get().ZXX();
+}
+
+Vec3f
+Vec3fRef::ZXY( void ) const
+{
+  return Get().ZXY();
+}
+
+Vec3f
+Vec3fRef::ZXZ( void ) const
+{
+  return Get().ZXZ();
+}
+
+Vec3f
+Vec3fRef::ZYX( void ) const
+{
+  return Get().ZYX();
+}
+
+Vec3f
+Vec3fRef::ZYY( void ) const
+{
+  return Get().ZYY();
+}
+
+Vec3f
+Vec3fRef::ZYZ( void ) const
+{
+  return Get().ZYZ();
+}
+
+Vec3f
+Vec3fRef::ZZX( void ) const
+{
+  return Get().ZZX();
+}
+
+Vec3f
+Vec3fRef::ZZY( void ) const
+{
+  return Get().ZZY();
+}
+
+Vec3f
+Vec3fRef::ZZZ( void ) const
+{
+  return Get().ZZZ();
+}
+
+void
+Vec3fRef::Print( void ) const
+{
+  printf( "( %f | %f | %f )\n", m_Values[ 0 ], m_Values[ 1 ], m_Values[ 2 ] );
+}
+
+const float*
+Vec3fRef::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,155 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3h.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec3h.hpp"
+
+#include "Vec3f.hpp"
+#include "Precision.hpp"
+
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec3h::Vec3h( void )
+{
+  m_Values[ 0 ] = 0;
+  m_Values[ 1 ] = 0;
+  m_Values[ 2 ] = 0;
+}
+
+Vec3h::Vec3h( const Vec3h& vector )
+{
+  m_Values[ 0 ] = vector.m_Values[ 0 ];
+  m_Values[ 1 ] = vector.m_Values[ 1 ];
+  m_Values[ 2 ] = vector.m_Values[ 2 ];
+}
+
+Vec3h::Vec3h( const Vec3f& vector )
+{
+  Set( vector );
+}
+
+Vec3h::Vec3h( const float x, const float y, const float z )
+{
+  Set( x, y, z );
+}
+
+Vec3h::~Vec3h( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Vec3h::Set( const float x, const float y, const float z )
+{
+  m_Values[ 0 ] = Precision::Half( x );
+  m_Values[ 1 ] = Precision::Half( y );
+  m_Values[ 2 ] = Precision::Half( z );
+}
+
+void
+Vec3h::Set( const Vec3f& vector )
+{
+  m_Values[ 0 ] = Precision::Half( vector[ 0 ] );
+  m_Values[ 1 ] = Precision::Half( vector[ 1 ] );
+  m_Values[ 2 ] = Precision::Half( vector[ 2 ] );
+}
+
+Vec3f
+Vec3h::Get( void ) const
+{
+  return Vec3f( X(), Y(), Z() );
+}
+
+float
+Vec3h::X( void ) const
+{
+  return Precision::Single( m_Values[ 0 ] );
+}
+
+float
+Vec3h::Y( void ) const
+{
+  return Precision::Single( m_Values[ 1 ] );
+}
+
+float
+Vec3h::Z( void ) const
+{
+  return Precision::Single( m_Values[ 2 ] );
+}
+
+bool
+Vec3h::operator ==( const Vec3h& expr ) const
+{
+  return  m_Values[ 0 ] == expr.m_Values[ 0 ] &&
+          m_Values[ 1 ] == expr.m_Values[ 1 ] &&
+          m_Values[ 2 ] == expr.m_Values[ 2 ];
+}
+
+bool
+Vec3h::operator !=( const Vec3h& expr ) const
+{
+  return !( *this == expr );
+}
+
+unsigned short&
+Vec3h::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+unsigned short
+Vec3h::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Vec3h::Print( void ) const
+{
+  printf( "( %f | %f | %f )\n", Precision::Single( m_Values[ 0 ] ), Precision::Single( m_Values[ 1 ] ), Precision::Single( m_Values[ 2 ] ) );
+}
+
+const unsigned short*
+Vec3h::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */
@@ -0,0 +1,332 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3i.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec3i.hpp"
+
+#include <cstdio>
+
+Vec3i::Vec3i( void )
+{
+  m_Values[ 0 ] = 0;
+  m_Values[ 1 ] = 0;
+  m_Values[ 2 ] = 0;
+}
+
+Vec3i::Vec3i( const int value )
+{
+  m_Values[ 0 ] = value;
+  m_Values[ 1 ] = value;
+  m_Values[ 2 ] = value;
+}
+
+Vec3i::Vec3i( const Vec3i& other )
+{
+  m_Values[ 0 ] = other.m_Values[ 0 ];
+  m_Values[ 1 ] = other.m_Values[ 1 ];
+  m_Values[ 2 ] = other.m_Values[ 2 ];
+}
+
+Vec3i::Vec3i( const int x, const int y, const int z )
+{
+  m_Values[ 0 ] = x;
+  m_Values[ 1 ] = y;
+  m_Values[ 2 ] = z;
+}
+
+Vec3i::~Vec3i( void ) { return; }
+
+void
+Vec3i::Set( const int& x, const int& y, const int& z )
+{
+  m_Values[ 0 ] = x;
+  m_Values[ 1 ] = y;
+  m_Values[ 2 ] = z;
+}
+
+void
+Vec3i::X( const int& x )
+{
+  m_Values[ 0 ] = x;
+}
+
+void
+Vec3i::Y( const int& y )
+{
+  m_Values[ 1 ] = y;
+}
+
+void
+Vec3i::Z( const int& z )
+{
+  m_Values[ 2 ] = z;
+}
+
+int
+Vec3i::LengthSq( void ) const
+{
+  return m_Values[ 0 ] * m_Values[ 0 ] +
+         m_Values[ 1 ] * m_Values[ 1 ] +
+         m_Values[ 2 ] * m_Values[ 2 ];
+}
+
+int
+Vec3i::Dot( const Vec3i& other ) const
+{
+  return  m_Values[ 0 ] * other.m_Values[ 0 ] +
+          m_Values[ 1 ] * other.m_Values[ 1 ] +
+          m_Values[ 2 ] * other.m_Values[ 2 ];
+}
+
+int
+Vec3i::Max( void ) const
+{
+  const int max = m_Values[ 0 ] > m_Values[ 1 ] ? m_Values[ 0 ] : m_Values[ 1 ];
+
+  return max > m_Values[ 2 ] ? max : m_Values[ 2 ];
+}
+
+int
+Vec3i::Min( void ) const
+{
+  const int min = m_Values[ 0 ] < m_Values[ 1 ] ? m_Values[ 0 ] : m_Values[ 1 ];
+
+  return min < m_Values[ 2 ] ? min : m_Values[ 2 ];
+}
+
+Vec3i
+Vec3i::Clamp( const Vec3i& Min, const Vec3i& Max ) const
+{
+  Vec3i result;
+
+  for ( unsigned int i = 0; i < 3; i++ )
+  {
+    if      ( m_Values[ i ] < Min.m_Values[ i ] )
+      result.m_Values[ i ] = Min.m_Values[ i ];
+    else if ( m_Values[ i ] > Max.m_Values[ i ] )
+      result.m_Values[ i ] = Max.m_Values[ i ];
+    else
+      result.m_Values[ i ] = m_Values[ i ];
+  }
+
+  return result;
+}
+
+Vec3i
+Vec3i::Max( const Vec3i& vector ) const
+{
+  return Vec3i(
+      m_Values[ 0 ] > vector.m_Values[ 0 ] ? m_Values[ 0 ] : vector.m_Values[ 0 ],
+      m_Values[ 1 ] > vector.m_Values[ 1 ] ? m_Values[ 1 ] : vector.m_Values[ 1 ],
+      m_Values[ 2 ] > vector.m_Values[ 2 ] ? m_Values[ 2 ] : vector.m_Values[ 2 ]
+  );
+}
+
+Vec3i
+Vec3i::Min( const Vec3i& vector ) const
+{
+  return Vec3i(
+      m_Values[ 0 ] < vector.m_Values[ 0 ] ? m_Values[ 0 ] : vector.m_Values[ 0 ],
+      m_Values[ 1 ] < vector.m_Values[ 1 ] ? m_Values[ 1 ] : vector.m_Values[ 1 ],
+      m_Values[ 2 ] < vector.m_Values[ 2 ] ? m_Values[ 2 ] : vector.m_Values[ 2 ]
+  );
+}
+
+Vec3i
+Vec3i::operator +( const int summand ) const
+{
+  return Vec3i( m_Values[ 0 ] + summand, m_Values[ 1 ] + summand, m_Values[ 2 ] + summand );
+}
+
+Vec3i
+Vec3i::operator +( const Vec3i& summand ) const
+{
+  return Vec3i( m_Values[ 0 ] + summand.m_Values[ 0 ],
+                m_Values[ 1 ] + summand.m_Values[ 1 ],
+                m_Values[ 2 ] + summand.m_Values[ 2 ] );
+}
+
+Vec3i
+Vec3i::operator -( const int subtrahend ) const
+{
+  return Vec3i( m_Values[ 0 ] - subtrahend, m_Values[ 1 ] - subtrahend, m_Values[ 2 ] - subtrahend );
+}
+
+Vec3i
+Vec3i::operator -( const Vec3i& subtrahend ) const
+{
+  return Vec3i( m_Values[ 0 ] - subtrahend.m_Values[ 0 ],
+                m_Values[ 1 ] - subtrahend.m_Values[ 1 ],
+                m_Values[ 2 ] - subtrahend.m_Values[ 2 ] );
+}
+
+Vec3i
+Vec3i::operator *( const int factor ) const
+{
+  return Vec3i( m_Values[ 0 ] * factor, m_Values[ 1 ] * factor, m_Values[ 2 ] * factor );
+}
+
+Vec3i
+Vec3i::operator *( const Vec3i& factor ) const
+{
+  return Vec3i( m_Values[ 0 ] * factor.m_Values[ 0 ],
+                m_Values[ 1 ] * factor.m_Values[ 1 ],
+                m_Values[ 2 ] * factor.m_Values[ 2 ] );
+}
+
+Vec3i
+Vec3i::operator /( const int dividend ) const
+{
+  if ( dividend == 0 ) return Vec3i();
+
+  return Vec3i( m_Values[ 0 ] / dividend, m_Values[ 1 ] / dividend, m_Values[ 2 ] / dividend );
+}
+
+Vec3i&
+Vec3i::operator +=( const int summand )
+{
+  m_Values[ 0 ] += summand;
+  m_Values[ 1 ] += summand;
+  m_Values[ 2 ] += summand;
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator +=( const Vec3i& summand )
+{
+  m_Values[ 0 ] += summand.m_Values[ 0 ];
+  m_Values[ 1 ] += summand.m_Values[ 1 ];
+  m_Values[ 2 ] += summand.m_Values[ 2 ];
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator -=( const Vec3i& subtrahend )
+{
+  m_Values[ 0 ] -= subtrahend.m_Values[ 0 ];
+  m_Values[ 1 ] -= subtrahend.m_Values[ 1 ];
+  m_Values[ 2 ] -= subtrahend.m_Values[ 2 ];
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator -=( const int subtrahend )
+{
+  m_Values[ 0 ] -= subtrahend;
+  m_Values[ 1 ] -= subtrahend;
+  m_Values[ 2 ] -= subtrahend;
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator *=( const int factor )
+{
+  m_Values[ 0 ] *= factor;
+  m_Values[ 1 ] *= factor;
+  m_Values[ 2 ] *= factor;
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator *=( const Vec3i& factor )
+{
+  m_Values[ 0 ] *= factor.m_Values[ 0 ];
+  m_Values[ 1 ] *= factor.m_Values[ 1 ];
+  m_Values[ 2 ] *= factor.m_Values[ 2 ];
+
+  return *this;
+}
+
+Vec3i&
+Vec3i::operator /=( const int dividend )
+{
+  if ( dividend == 0 ) return *this;
+
+  m_Values[ 0 ] /= dividend;
+  m_Values[ 1 ] /= dividend;
+  m_Values[ 2 ] /= dividend;
+
+  return *this;
+}
+
+bool
+Vec3i::operator ==( const Vec3i& expr ) const
+{
+  return  m_Values[ 0 ] == expr.m_Values[ 0 ] &&
+          m_Values[ 1 ] == expr.m_Values[ 1 ] &&
+          m_Values[ 2 ] == expr.m_Values[ 2 ];
+}
+
+bool
+Vec3i::operator !=( const Vec3i& expr ) const
+{
+  return  m_Values[ 0 ] != expr.m_Values[ 0 ] ||
+          m_Values[ 1 ] != expr.m_Values[ 1 ] ||
+          m_Values[ 2 ] != expr.m_Values[ 2 ];
+}
+
+int&
+Vec3i::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+int
+Vec3i::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+int
+Vec3i::X( void ) const
+{
+  return m_Values[ 0 ];
+}
+
+int
+Vec3i::Y( void ) const
+{
+  return m_Values[ 1 ];
+}
+
+int
+Vec3i::Z( void ) const
+{
+  return m_Values[ 2 ];
+}
+
+void
+Vec3i::Print( void ) const
+{
+  printf( "( %i | %i | %i )\n", m_Values[ 0 ], m_Values[ 1 ], m_Values[ 2 ] );
+}
+
+const int*
+Vec3i::Values( void ) const
+{
+  return m_Values;
+}
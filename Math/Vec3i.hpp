@@ -0,0 +1,120 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec3i.hpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#ifndef MATH_VEC3I_HPP_
+#define MATH_VEC3I_HPP_
+
+class Vec3i
+{
+public:
+  Vec3i( void );
+  Vec3i( const int value );
+  Vec3i( const Vec3i& Vec3i );
+  Vec3i( const int x, const int y, const int z );
+  virtual
+  ~Vec3i( void );
+
+  int
+  LengthSq( void ) const;
+  int
+  Dot( const Vec3i& other ) const;
+  int
+  Max( void ) const;
+  int
+  Min( void ) const;
+
+  void
+  Set( const int& x, const int& y, const int& z );
+  void
+  X( const int& x );
+  void
+  Y( const int& y );
+  void
+  Z( const int& z );
+
+  Vec3i
+  Clamp( const Vec3i& Min, const Vec3i& Max ) const;
+  Vec3i
+  Max( const Vec3i& vector ) const;
+  Vec3i
+  Min( const Vec3i& vector ) const;
+
+  Vec3i
+  operator +( const int summand ) const;
+  Vec3i
+  operator +( const Vec3i& summand ) const;
+  Vec3i
+  operator -( const int subtrahend ) const;
+  Vec3i
+  operator -( const Vec3i& subtrahend ) const;
+  Vec3i
+  operator *( const int factor ) const;
+  Vec3i
+  operator *( const Vec3i& factor ) const;
+  Vec3i
+  operator /( const int dividend ) const;
+  Vec3i&
+  operator +=( const Vec3i& summand );
+  Vec3i&
+  operator +=( const int summand );
+  Vec3i&
+  operator -=( const Vec3i& subtrahend );
+  Vec3i&
+  operator -=( const int subtrahend );
+  Vec3i&
+  operator *=( const int factor );
+  Vec3i&
+  operator *=( const Vec3i& factor );
+  Vec3i&
+  operator /=( const int dividend );
+
+  bool
+  operator ==( const Vec3i& expr ) const;
+  bool
+  operator !=( const Vec3i& expr ) const;
+
+  int&
+  operator []( unsigned int i );
+  int
+  operator []( unsigned int i ) const;
+
+  int
+  X( void ) const;
+  int
+  Y( void ) const;
+  int
+  Z( void ) const;
+
+  void
+  Print( void ) const;
+
+  const int*
+  Values( void ) const;
+
+protected:
+private:
+  int m_Values[ 3 ];
+
+};
+
+#endif /* MATH_VEC3I_HPP_ */
@@ -29,6 +29,7 @@
 
 #include "Vec2d.hpp"
 #include "Vec3d.hpp"
+#include "Vec4f.hpp"
 
 Vec4d::Vec4d( const Vec2d& vector )
 {
@@ -54,6 +55,14 @@ Vec4d::Vec4d( const Vec4d& vector )
   m_Values[ 3 ] = vector.m_Values[ 3 ];
 }
 
+Vec4d::Vec4d( const Vec4f& vector )
+{
+  m_Values[ 0 ] = vector[ 0 ];
+  m_Values[ 1 ] = vector[ 1 ];
+  m_Values[ 2 ] = vector[ 2 ];
+  m_Values[ 3 ] = vector[ 3 ];
+}
+
 Vec4d::Vec4d( const float x, const float y, const float z, const float w )
 {
   m_Values[ 0 ] = x;
@@ -25,6 +25,7 @@
 
 class Vec2d;
 class Vec3d;
+class Vec4f;
 
 class Vec4d
 {
@@ -32,6 +33,8 @@ public:
   Vec4d( const Vec2d& vector );
   Vec4d( const Vec3d& vector );
   Vec4d( const Vec4d& vector );
+  explicit
+  Vec4d( const Vec4f& vector );
   Vec4d( const float x = 0.0f, const float y = 0.0f, const float z = 0.0f, const float w = 1.0f );
   virtual
   ~Vec4d( void );
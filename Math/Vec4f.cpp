@@ -30,6 +30,7 @@
 #include "Mat4f.hpp"
 #include "Vec2f.hpp"
 #include "Vec3f.hpp"
+#include "Vec4d.hpp"
 
 Vec4f::Vec4f( const Vec2f& vector )
 {
@@ -55,6 +56,14 @@ Vec4f::Vec4f( const Vec4f& vector )
   m_Values[ 3 ] = vector.m_Values[ 3 ];
 }
 
+Vec4f::Vec4f( const Vec4d& vector )
+{
+  m_Values[ 0 ] = vector[ 0 ];
+  m_Values[ 1 ] = vector[ 1 ];
+  m_Values[ 2 ] = vector[ 2 ];
+  m_Values[ 3 ] = vector[ 3 ];
+}
+
 Vec4f::Vec4f( const float x, const float y, const float z, const float w )
 {
   m_Values[ 0 ] = x;
@@ -26,6 +26,7 @@
 class Vec2f;
 class Vec3f;
 class Mat4f;
+class Vec4d;
 
 class Vec4f
 {
@@ -33,6 +34,8 @@ public:
   Vec4f( const Vec2f& vector );
   Vec4f( const Vec3f& vector );
   Vec4f( const Vec4f& vector );
+  explicit
+  Vec4f( const Vec4d& vector );
   Vec4f( const float x = 0.0f, const float y = 0.0f, const float z = 0.0f, const float w = 1.0f );
   virtual
   ~Vec4f( void );
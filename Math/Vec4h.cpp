@@ -0,0 +1,166 @@
+/*
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+
+ \file Vec4h.cpp
+
+ Created on: Oct 19, 2026
+ \author     fkzey
+ */
+
+#include "Vec4h.hpp"
+
+#include "Vec4f.hpp"
+#include "Precision.hpp"
+
+#include <cstdio>
+
+/* ************************************************** */
+/* ************************************************** */
+/* **************** CON-/DESTRUCTORS  *************** */
+/* ************************************************** */
+/* ************************************************** */
+Vec4h::Vec4h( void )
+{
+  m_Values[ 0 ] = 0;
+  m_Values[ 1 ] = 0;
+  m_Values[ 2 ] = 0;
+  m_Values[ 3 ] = 0;
+}
+
+Vec4h::Vec4h( const Vec4h& vector )
+{
+  m_Values[ 0 ] = vector.m_Values[ 0 ];
+  m_Values[ 1 ] = vector.m_Values[ 1 ];
+  m_Values[ 2 ] = vector.m_Values[ 2 ];
+  m_Values[ 3 ] = vector.m_Values[ 3 ];
+}
+
+Vec4h::Vec4h( const Vec4f& vector )
+{
+  Set( vector );
+}
+
+Vec4h::Vec4h( const float x, const float y, const float z, const float w )
+{
+  Set( x, y, z, w );
+}
+
+Vec4h::~Vec4h( void ) { return; }
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PUBLIC  ******************** */
+/* ************************************************** */
+/* ************************************************** */
+void
+Vec4h::Set( const float x, const float y, const float z, const float w )
+{
+  m_Values[ 0 ] = Precision::Half( x );
+  m_Values[ 1 ] = Precision::Half( y );
+  m_Values[ 2 ] = Precision::Half( z );
+  m_Values[ 3 ] = Precision::Half( w );
+}
+
+void
+Vec4h::Set( const Vec4f& vector )
+{
+  m_Values[ 0 ] = Precision::Half( vector[ 0 ] );
+  m_Values[ 1 ] = Precision::Half( vector[ 1 ] );
+  m_Values[ 2 ] = Precision::Half( vector[ 2 ] );
+  m_Values[ 3 ] = Precision::Half( vector[ 3 ] );
+}
+
+Vec4f
+Vec4h::Get( void ) const
+{
+  return Vec4f( X(), Y(), Z(), W() );
+}
+
+float
+Vec4h::X( void ) const
+{
+  return Precision::Single( m_Values[ 0 ] );
+}
+
+float
+Vec4h::Y( void ) const
+{
+  return Precision::Single( m_Values[ 1 ] );
+}
+
+float
+Vec4h::Z( void ) const
+{
+  return Precision::Single( m_Values[ 2 ] );
+}
+
+float
+Vec4h::W( void ) const
+{
+  return Precision::Single( m_Values[ 3 ] );
+}
+
+bool
+Vec4h::operator ==( const Vec4h& expr ) const
+{
+  return  m_Values[ 0 ] == expr.m_Values[ 0 ] &&
+          m_Values[ 1 ] == expr.m_Values[ 1 ] &&
+          m_Values[ 2 ] == expr.m_Values[ 2 ] &&
+          m_Values[ 3 ] == expr.m_Values[ 3 ];
+}
+
+bool
+Vec4h::operator !=( const Vec4h& expr ) const
+{
+  return !( *this == expr );
+}
+
+unsigned short&
+Vec4h::operator []( unsigned int i )
+{
+  return m_Values[ i ];
+}
+
+unsigned short
+Vec4h::operator []( unsigned int i ) const
+{
+  return m_Values[ i ];
+}
+
+void
+Vec4h::Print( void ) const
+{
+  printf( "( %f | %f | %f | %f )\n", Precision::Single( m_Values[ 0 ] ), Precision::Single( m_Values[ 1 ] ), Precision::Single( m_Values[ 2 ] ), Precision::Single( m_Values[ 3 ] ) );
+}
+
+const unsigned short*
+Vec4h::Values( void ) const
+{
+  return m_Values;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* *******************  PROTECTED ******************* */
+/* ************************************************** */
+/* ************************************************** */
+
+/* ************************************************** */
+/* ************************************************** */
+/* ********************* PRIVATE ******************** */
+/* ************************************************** */
+/* ************************************************** */